@@ -209,6 +209,9 @@ namespace base
 		mGUI = new MyGUI::Gui();
 		mGUI->initialise(mResourceFileName);
 
+		// маски для пика декодируются без создания текстур
+		MyGUI::MaskPickManager::getInstance().eventDecodeImage = MyGUI::newDelegate(this, &BaseManager::decodeImage);
+
 		SDL_StartTextInput();
 	}
 
@@ -417,6 +420,29 @@ namespace base
 		return result;
 	}
 
+	void BaseManager::decodeImage(const std::string& _file, MyGUI::IntSize& _size, MyGUI::PixelFormat& _format, std::vector<MyGUI::uint8>& _data)
+	{
+		int width = 0;
+		int height = 0;
+		unsigned char* data = (unsigned char*)loadImage(width, height, _format, _file);
+		if (data == nullptr)
+			return;
+
+		size_t pixelSize = 0;
+		if (_format == MyGUI::PixelFormat::L8)
+			pixelSize = 1;
+		else if (_format == MyGUI::PixelFormat::L8A8)
+			pixelSize = 2;
+		else if (_format == MyGUI::PixelFormat::R8G8B8)
+			pixelSize = 3;
+		else if (_format == MyGUI::PixelFormat::R8G8B8A8)
+			pixelSize = 4;
+
+		_size.set(width, height);
+		_data.assign(data, data + (size_t)width * height * pixelSize);
+		delete[] data;
+	}
+
 	void BaseManager::saveImage(int _width, int _height, MyGUI::PixelFormat _format, void* _texture, const std::string& _filename)
 	{
 
@@ -52,6 +52,8 @@ namespace base
 		virtual void* loadImage(int& _width, int& _height, MyGUI::PixelFormat& _format, const std::string& _filename);
 		virtual void saveImage(int _width, int _height, MyGUI::PixelFormat _format, void* _texture, const std::string& _filename);
 
+		void decodeImage(const std::string& _file, MyGUI::IntSize& _size, MyGUI::PixelFormat& _format, std::vector<MyGUI::uint8>& _data);
+
 	protected:
 		virtual void createScene() { }
 		virtual void destroyScene() { }
@@ -30,6 +30,8 @@
 #include "MyGUI_DDContainer.h"
 #include "MyGUI_Canvas.h"
 #include "MyGUI_MultiListItem.h"
+#include "MyGUI_TreeControl.h"
+#include "MyGUI_TreeControlItem.h"
 #include "MyGUI_DeprecatedWidgets.h"
 
 #include "MyGUI_InputManager.h"
@@ -50,6 +52,10 @@
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_DataManager.h"
 #include "MyGUI_FactoryManager.h"
+#include "MyGUI_TextViewCache.h"
+#include "MyGUI_MaskPickManager.h"
+#include "MyGUI_TweenManager.h"
+#include "MyGUI_TextureMemoryManager.h"
 
 #include "MyGUI_ActionController.h"
 #include "MyGUI_ControllerEdgeHide.h"
@@ -58,6 +64,7 @@
 #include "MyGUI_CoordConverter.h"
 #include "MyGUI_IResource.h"
 #include "MyGUI_Any.h"
+#include "MyGUI_StringId.h"
 #include "MyGUI_MenuItemType.h"
 #include "MyGUI_Version.h"
 #include "MyGUI_XmlDocument.h"
@@ -67,6 +74,7 @@
 
 #include "MyGUI_PolygonalSkin.h"
 #include "MyGUI_RotatingSkin.h"
+#include "MyGUI_RichText.h"
 #include "MyGUI_TextureUtility.h"
 #include "MyGUI_Constants.h"
 #include "MyGUI_Bitwise.h"
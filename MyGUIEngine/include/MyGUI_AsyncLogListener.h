@@ -0,0 +1,79 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_ASYNC_LOG_LISTENER_H_
+#define MYGUI_ASYNC_LOG_LISTENER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_ILogListener.h"
+#include <vector>
+#include <time.h>
+
+namespace MyGUI
+{
+
+	struct AsyncLogThread;
+
+	/** Log listener that queues messages and passes them to other listeners from separate thread.\n
+		Writer thread takes all queued messages at once, writes them and flushes listeners once per batch.
+		Critical messages are written immediately in calling thread.
+	*/
+	class MYGUI_EXPORT AsyncLogListener :
+		public ILogListener
+	{
+	public:
+		AsyncLogListener();
+		virtual ~AsyncLogListener();
+
+		/** Add listener that will receive messages in writer thread. Should be called before open(). */
+		void addLogListener(ILogListener* _listener);
+
+		//! @copydoc ILogListener::open()
+		virtual void open();
+		//! @copydoc ILogListener::close()
+		virtual void close();
+		//! @copydoc ILogListener::flush()
+		virtual void flush();
+		//! @copydoc ILogListener::log(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line)
+		virtual void log(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line);
+
+		/** Set interval in milliseconds between writes of queued messages. */
+		void setWriteInterval(unsigned int _value);
+		/** Get interval in milliseconds between writes of queued messages. */
+		unsigned int getWriteInterval() const;
+
+	/*internal:*/
+		void _threadMain();
+
+	private:
+		struct LogRecord
+		{
+			std::string section;
+			LogLevel level;
+			struct tm time;
+			std::string message;
+			const char* file;
+			int line;
+		};
+		typedef std::vector<LogRecord> VectorLogRecord;
+
+		// забирает очередь и пишет её, вызывается только под mWriteLock
+		void writeQueue();
+
+	private:
+		typedef std::vector<ILogListener*> VectorLogListeners;
+		VectorLogListeners mListeners;
+
+		VectorLogRecord mQueue;
+		VectorLogRecord mWriting;
+
+		AsyncLogThread* mThread;
+		unsigned int mWriteInterval;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_ASYNC_LOG_LISTENER_H_
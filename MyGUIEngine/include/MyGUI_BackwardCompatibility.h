@@ -558,6 +558,8 @@ namespace MyGUI
 	{
 	public:
 		static bool checkProperty(Widget* _owner, std::string& _key, std::string& _value);
+		// свойство не требует checkProperty и может быть применено напрямую
+		static bool isPropertyCurrent(const std::string& _key);
 		static void initialise();
 		static void shutdown();
 		static bool isIgnoreProperty(const std::string& _key);
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_CACHED_LAYER_H_
+#define MYGUI_CACHED_LAYER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_OverlappedLayer.h"
+#include "MyGUI_ITexture.h"
+#include "MyGUI_IVertexBuffer.h"
+
+namespace MyGUI
+{
+
+	/** Overlapped layer that keeps its content in a render target texture.
+		Layer nodes are rendered into the texture only when something inside
+		the layer changed, otherwise the texture is drawn as one quad.
+		If render system can't create render target texture layer behaves
+		like usual OverlappedLayer.
+	*/
+	class MYGUI_EXPORT CachedLayer :
+		public OverlappedLayer
+	{
+		MYGUI_RTTI_DERIVED( CachedLayer )
+
+	public:
+		CachedLayer();
+		virtual ~CachedLayer();
+
+		virtual void deserialization(xml::ElementPtr _node, Version _version);
+
+		// render layer
+		virtual void renderToTarget(IRenderTarget* _target, bool _update);
+
+		virtual void resizeView(const IntSize& _viewSize);
+
+		/** Enable or disable caching, layer without cache renders directly to target */
+		void setCacheEnabled(bool _value);
+		/** Is caching enabled */
+		bool getCacheEnabled() const;
+
+		/** Force render layer content into cache texture on next frame */
+		void invalidateCache();
+
+		/** Get how many times layer content was rendered into cache texture */
+		size_t getCacheUpdateCount() const;
+
+	private:
+		bool createCache();
+		void destroyCache();
+		void updateCache(bool _update);
+		void drawCache(IRenderTarget* _target);
+
+	private:
+		ITexture* mTexture;
+		IVertexBuffer* mVertexBuffer;
+		bool mCacheEnabled;
+		bool mCacheOutOfDate;
+		bool mCacheFailed;
+		size_t mCacheUpdateCount;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_CACHED_LAYER_H_
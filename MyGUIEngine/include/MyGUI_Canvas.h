@@ -104,8 +104,18 @@ namespace MyGUI
 		/// Call user delegate update and removes old texture if it isn't original.
 		void updateTexture();
 
-		/// Locks hardware pixel buffer.
+		/** Locks hardware pixel buffer.
+			If regions were marked with markDirty, write lock uploads only their bounding rect on unlock.
+			In frame snapshot mode write lock of texture used by captured frames returns copy in system memory,
+			written pixels are uploaded at next FrameSnapshot::swap.
+		*/
 		void* lock(TextureUsage _usage = TextureUsage::Write);
+		/** Locks hardware pixel buffer for writing of region, on unlock only this region is uploaded,
+			pixels outside of it keep their content. Returned pointer points to the beginning of texture data.
+		*/
+		void* lock(const IntRect& _rect);
+		/// Marks region of texture that will be written by next lock, regions are merged into one bounding rect.
+		void markDirty(const IntRect& _rect);
 
 		/// Unlocks hardware pixel buffer.
 		void unlock();
@@ -243,6 +253,14 @@ namespace MyGUI
 		bool mFrameAdvise;
 
 		bool mInvalidateData;
+
+		/// Region that will be written by next lock \sa markDirty
+		IntRect mDirtyRect;
+
+		/// Copy of texture for writing while texture is drawn by render thread in frame snapshot mode
+		std::vector<uint8> mStagingData;
+		IntRect mStagingRect;
+		bool mStagingLocked;
 	};
 
 } // namespace MyGUI
@@ -57,6 +57,9 @@ namespace MyGUI
 		typedef std::pair<Widget*, ControllerItem*> PairControllerItem;
 		typedef std::list<PairControllerItem> ListControllerItem;
 		ListControllerItem mListItem;
+		// контроллеры каждого виджета, чтобы не искать по всему списку
+		typedef std::multimap<Widget*, ListControllerItem::iterator> MapWidgetItem;
+		MapWidgetItem mWidgetItems;
 
 		bool mIsInitialise;
 		std::string mCategoryName;
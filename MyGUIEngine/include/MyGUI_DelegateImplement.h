@@ -207,15 +207,17 @@ namespace delegates
 		typedef MYGUI_TYPENAME ListDelegate::iterator ListDelegateIterator;
 		typedef MYGUI_TYPENAME ListDelegate::const_iterator ConstListDelegateIterator;
 
-		MYGUI_C_MULTI_DELEGATE () { }
+		MYGUI_C_MULTI_DELEGATE () : mListDelegates(nullptr) { }
 		~MYGUI_C_MULTI_DELEGATE ()
 		{
 			clear();
+			delete mListDelegates;
 		}
 
 		bool empty() const
 		{
-			for (ConstListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			if (mListDelegates == nullptr) return true;
+			for (ConstListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 			{
 				if (*iter) return false;
 			}
@@ -224,7 +226,8 @@ namespace delegates
 
 		void clear()
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			if (mListDelegates == nullptr) return;
+			for (ListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 			{
 				if (*iter)
 				{
@@ -236,7 +239,8 @@ namespace delegates
 
 		void clear(IDelegateUnlink* _unlink)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			if (mListDelegates == nullptr) return;
+			for (ListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 			{
 				if ((*iter) && (*iter)->compare(_unlink))
 				{
@@ -248,27 +252,34 @@ namespace delegates
 
 		MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& operator+=(IDelegate* _delegate)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			// список создается при первой подписке, на большинство событий никто не подписан
+			if (mListDelegates == nullptr)
+				mListDelegates = new ListDelegate();
+
+			for (ListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 			{
 				if ((*iter) && (*iter)->compare(_delegate))
 				{
 					MYGUI_EXCEPT("Trying to add same delegate twice.");
 				}
 			}
-			mListDelegates.push_back(_delegate);
+			mListDelegates->push_back(_delegate);
 			return *this;
 		}
 
 		MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& operator-=(IDelegate* _delegate)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			if (mListDelegates != nullptr)
 			{
-				if ((*iter) && (*iter)->compare(_delegate))
+				for (ListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 				{
-					// проверяем на идентичность делегатов
-					if ((*iter) != _delegate) delete (*iter);
-					(*iter) = nullptr;
-					break;
+					if ((*iter) && (*iter)->compare(_delegate))
+					{
+						// проверяем на идентичность делегатов
+						if ((*iter) != _delegate) delete (*iter);
+						(*iter) = nullptr;
+						break;
+					}
 				}
 			}
 			delete _delegate;
@@ -277,12 +288,13 @@ namespace delegates
 
 		void operator()(MYGUI_PARAMS)
 		{
-			ListDelegateIterator iter = mListDelegates.begin();
-			while (iter != mListDelegates.end())
+			if (mListDelegates == nullptr) return;
+			ListDelegateIterator iter = mListDelegates->begin();
+			while (iter != mListDelegates->end())
 			{
 				if (nullptr == (*iter))
 				{
-					iter = mListDelegates.erase(iter);
+					iter = mListDelegates->erase(iter);
 				}
 				else
 				{
@@ -292,25 +304,25 @@ namespace delegates
 			}
 		}
 
-		MYGUI_C_MULTI_DELEGATE (const MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& _event)
+		MYGUI_C_MULTI_DELEGATE (const MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& _event) : mListDelegates(nullptr)
 		{
 			// take ownership
-			ListDelegate del = _event.mListDelegates;
-			const_cast< MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates.clear();
-
-			safe_clear(del);
-
-			mListDelegates = del;
+			mListDelegates = _event.mListDelegates;
+			const_cast< MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates = nullptr;
 		}
 
 		MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& operator=(const MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& _event)
 		{
+			if (this == &_event)
+				return *this;
+
 			// take ownership
-			ListDelegate del = _event.mListDelegates;
-			const_cast< MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates.clear();
+			ListDelegate* del = _event.mListDelegates;
+			const_cast< MYGUI_C_MULTI_DELEGATE MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates = nullptr;
 
 			safe_clear(del);
 
+			delete mListDelegates;
 			mListDelegates = del;
 
 			return *this;
@@ -325,9 +337,10 @@ namespace delegates
 		}
 
 	private:
-		void safe_clear(ListDelegate& _delegates)
+		void safe_clear(ListDelegate* _delegates)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			if (mListDelegates == nullptr) return;
+			for (ListDelegateIterator iter = mListDelegates->begin(); iter != mListDelegates->end(); ++iter)
 			{
 				if (*iter)
 				{
@@ -338,13 +351,16 @@ namespace delegates
 			}
 		}
 
-		void delete_is_not_found(IDelegate* _del, ListDelegate& _delegates)
+		void delete_is_not_found(IDelegate* _del, ListDelegate* _delegates)
 		{
-			for (ListDelegateIterator iter = _delegates.begin(); iter != _delegates.end(); ++iter)
+			if (_delegates != nullptr)
 			{
-				if ((*iter) && (*iter)->compare(_del))
+				for (ListDelegateIterator iter = _delegates->begin(); iter != _delegates->end(); ++iter)
 				{
-					return;
+					if ((*iter) && (*iter)->compare(_del))
+					{
+						return;
+					}
 				}
 			}
 
@@ -352,7 +368,8 @@ namespace delegates
 		}
 
 	private:
-		ListDelegate mListDelegates;
+		// nullptr пока нет ни одной подписки
+		ListDelegate* mListDelegates;
 	};
 
 
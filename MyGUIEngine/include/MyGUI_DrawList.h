@@ -0,0 +1,113 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_DRAW_LIST_H_
+#define MYGUI_DRAW_LIST_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_IRenderTarget.h"
+
+namespace MyGUI
+{
+
+	class ILayer;
+	class ITexture;
+	class IVertexBuffer;
+
+	/** One recorded draw call: first count vertexes of buffer drawn with texture.
+		Commands always draw whole buffer from its start, geometry is already cropped.
+	*/
+	struct MYGUI_EXPORT DrawCommand
+	{
+	public:
+		DrawCommand() :
+			buffer(nullptr),
+			count(0),
+			texture(nullptr),
+			layer(nullptr)
+		{
+		}
+
+		DrawCommand(IVertexBuffer* _buffer, size_t _count, ITexture* _texture, ILayer* _layer) :
+			buffer(_buffer),
+			count(_count),
+			texture(_texture),
+			layer(_layer)
+		{
+		}
+
+	public:
+		IVertexBuffer* buffer;
+		size_t count;
+		ITexture* texture;
+		// layer that produced this command
+		ILayer* layer;
+	};
+
+	typedef std::vector<DrawCommand> VectorDrawCommand;
+
+	/** Ordered list of draw commands produced by layers walk.
+		DrawList is render target itself, layers render into it and it records
+		every doRender call instead of drawing. Backend may then sort commands,
+		submit them to real target or pass them to another thread.
+	*/
+	class MYGUI_EXPORT DrawList :
+		public IRenderTarget
+	{
+	public:
+		DrawList();
+		virtual ~DrawList();
+
+		/** Set target which RenderTargetInfo is used while recording */
+		void setTarget(IRenderTarget* _target);
+		/** Get target which RenderTargetInfo is used while recording */
+		IRenderTarget* getTarget() const;
+
+		/** Set layer for next recorded commands */
+		void setCurrentLayer(ILayer* _layer);
+		/** Get layer for next recorded commands */
+		ILayer* getCurrentLayer() const;
+
+		/** Add command to the end of list */
+		void addCommand(const DrawCommand& _command);
+		/** Remove all commands */
+		void clear();
+
+		/** Get commands count */
+		size_t getCommandCount() const;
+		/** Get command by index */
+		const DrawCommand& getCommandAt(size_t _index) const;
+
+		/** Get commands, backend is allowed to reorder them */
+		VectorDrawCommand& getCommands();
+		/** Get commands */
+		const VectorDrawCommand& getCommands() const;
+
+		/** Draw all commands to target in list order */
+		void submit(IRenderTarget* _target) const;
+
+		/** @see IRenderTarget::begin */
+		virtual void begin();
+		/** @see IRenderTarget::end */
+		virtual void end();
+
+		/** @see IRenderTarget::doRender */
+		virtual void doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count);
+
+		/** @see IRenderTarget::getInfo */
+		virtual const RenderTargetInfo& getInfo();
+
+	private:
+		VectorDrawCommand mCommands;
+		IRenderTarget* mTarget;
+		ILayer* mCurrentLayer;
+		RenderTargetInfo mInfo;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_DRAW_LIST_H_
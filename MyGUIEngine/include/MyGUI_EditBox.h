@@ -74,6 +74,8 @@ namespace MyGUI
 
 		/** Set edit text applying tags */
 		virtual void setCaption(const UString& _value);
+		/** @copydoc TextBox::setCaptionUTF8(const std::string& _value) */
+		virtual void setCaptionUTF8(const std::string& _value);
 		/** Get edit text with tags */
 		virtual const UString& getCaption();
 
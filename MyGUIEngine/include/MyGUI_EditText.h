@@ -16,6 +16,7 @@
 #include "MyGUI_RenderFormat.h"
 #include "MyGUI_TextView.h"
 #include "MyGUI_VertexData.h"
+#include "MyGUI_VertexUtility.h"
 
 namespace MyGUI
 {
@@ -40,6 +41,7 @@ namespace MyGUI
 		virtual void doRender();
 
 		void setCaption(const UString& _value);
+		void setCaptionUTF8(const std::string& _value);
 		const UString& getCaption() const;
 
 		void setTextColour(const Colour& _value);
@@ -116,18 +118,8 @@ namespace MyGUI
 		void _setTextColour(const Colour& _value);
 		void checkVertexSize();
 
-		void drawQuad(
-			Vertex*& _vertex,
-			size_t& _vertexCount,
-			const FloatRect& _vertexRect,
-			float _vertexZ,
-			const FloatRect& _textureRect,
-			uint32 _colour) const;
-
 		void drawGlyph(
-			const RenderTargetInfo& renderTargetInfo,
-			Vertex*& _vertex,
-			size_t& _vertexCount,
+			vertex_utility::QuadBatch& _batch,
 			FloatRect _vertexRect,
 			FloatRect _textureRect,
 			uint32 _colour) const;
@@ -140,7 +132,11 @@ namespace MyGUI
 		uint32 mShadowColourNative;
 		IntCoord mCurrentCoord;
 
-		UString mCaption;
+		// для текста в UTF-8 заполняется только при запросе
+		mutable UString mCaption;
+		std::string mCaptionUTF8;
+		bool mUTF8Caption;
+		mutable bool mCaptionOutDate;
 		bool mTextOutDate;
 		Align mTextAlign;
 
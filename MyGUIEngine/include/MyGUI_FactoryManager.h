@@ -11,6 +11,7 @@
 #include "MyGUI_Singleton.h"
 #include "MyGUI_IObject.h"
 #include "MyGUI_GenericFactory.h"
+#include "MyGUI_StringId.h"
 
 namespace MyGUI
 {
@@ -71,11 +72,23 @@ namespace MyGUI
 		/** Destroy object */
 		void destroyObject(IObject* _object);
 
+		/** Get factory delegate for specified _category and _type, obsolete type names are renamed.
+			Return nullptr if there's no registered factory.
+			Pointer is valid while getChangeCount is not changed.
+		*/
+		Delegate* getFactory(const std::string& _category, const std::string& _type);
+
+		/** Get number of factory registrations and unregistrations, used to check cached factory delegates */
+		size_t getChangeCount() const;
+
 	private:
-		typedef std::map<std::string, Delegate> MapFactoryItem;
-		typedef std::map<std::string, MapFactoryItem> MapRegisterFactoryItem;
+		// имена категорий и типов интернированы, сравнение ключей по указателю
+		typedef std::map<StringId, Delegate> MapFactoryItem;
+		typedef std::map<StringId, MapFactoryItem> MapRegisterFactoryItem;
 		MapRegisterFactoryItem mRegisterFactoryItems;
 
+		size_t mChangeCount;
+
 		bool mIsInitialise;
 	};
 
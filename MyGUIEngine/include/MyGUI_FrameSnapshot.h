@@ -0,0 +1,145 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_FRAME_SNAPSHOT_H_
+#define MYGUI_FRAME_SNAPSHOT_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexData.h"
+#include "MyGUI_DrawList.h"
+
+namespace MyGUI
+{
+
+	typedef std::vector<Vertex> VectorVertex;
+
+	/** Vertex buffer in system memory, used for render items in frame snapshot mode. */
+	class MYGUI_EXPORT FrameSnapshotVertexBuffer :
+		public IVertexBuffer
+	{
+	public:
+		FrameSnapshotVertexBuffer();
+		virtual ~FrameSnapshotVertexBuffer();
+
+		virtual void setVertexCount(size_t _value);
+		virtual size_t getVertexCount();
+
+		virtual Vertex* lock();
+		virtual void unlock();
+
+		/** Content version, changes on every write lock and is unique among all buffers */
+		size_t getVersion() const;
+		/** Vertexes for reading without changing version */
+		const VectorVertex& getVertexes() const;
+
+	private:
+		VectorVertex mVertexes;
+		VectorVertex mUnlockedVertexes;
+		size_t mVersion;
+		size_t mUnlockedVersion;
+
+		static size_t msLastVersion;
+	};
+
+	/** Double buffered frame of recorded draw commands with own copy of vertexes.
+		UI thread captures frame N while render thread submits frame N-1.
+		Requires RenderManager::setFrameSnapshotMode(true) before Gui initialisation,
+		in this mode layers generate vertexes into system memory and never touch
+		render system from UI thread. Textures are still created by UI thread.
+
+		Each frame UI thread calls Gui::frameEvent and capture, render thread
+		calls submit, and at sync point between frames one of them calls swap.
+
+		Textures used by captured frames are pinned in RenderManager until the frame
+		is replaced on swap: engine destroys pinned textures only after that and
+		Canvas writes into them are applied at swap. Render buffers are kept
+		between frames, vertexes are copied and uploaded only for changed render items.
+	*/
+	class MYGUI_EXPORT FrameSnapshot
+	{
+	public:
+		FrameSnapshot();
+		/** Destroy render system buffers, call from render thread */
+		~FrameSnapshot();
+
+		/** UI thread. Record all layers into back frame.
+			@param _target Render target, only its RenderTargetInfo is used.
+			@param _update Regenerate all vertexes.
+		*/
+		void capture(IRenderTarget* _target, bool _update);
+
+		/** Make captured frame available for submit. Neither capture nor submit should run during swap. */
+		void swap();
+
+		/** Render thread. Upload front frame vertexes and draw them to _target. */
+		void submit(IRenderTarget* _target);
+
+		/** Get commands of frame that will be submitted */
+		const DrawList& getFrontDrawList() const;
+
+	private:
+		struct SourceState
+		{
+			SourceState() : version(0), count(0) { }
+			SourceState(size_t _version, size_t _count) : version(_version), count(_count) { }
+			size_t version;
+			size_t count;
+		};
+
+		struct CommandSource
+		{
+			// nullptr для буферов не из режима снимков, их вершины копируются всегда
+			const IVertexBuffer* buffer;
+			// начало вершин команды в Frame::vertexes
+			size_t offset;
+			SourceState state;
+			// вершины скопированы в кадр, иначе они уже есть в буфере рендера
+			bool copied;
+			// после submit буфер рендера содержит эту версию вершин
+			bool resident;
+		};
+		typedef std::vector<CommandSource> VectorCommandSource;
+		typedef std::vector<const IVertexBuffer*> VectorConstVertexBuffer;
+
+		struct Frame
+		{
+			Frame() : submitted(false) { }
+			DrawList drawList;
+			VectorVertex vertexes;
+			VectorCommandSource sources;
+			VectorConstVertexBuffer released;
+			std::vector<ITexture*> textures;
+			bool submitted;
+		};
+
+		struct RenderBuffer
+		{
+			RenderBuffer() : buffer(nullptr) { }
+			IVertexBuffer* buffer;
+			SourceState state;
+		};
+
+		void releaseFrame(Frame& _frame);
+
+	private:
+		Frame mFrames[2];
+		size_t mBackFrame;
+
+		// что лежит в буферах рендера после последнего отрисованного кадра, только поток UI
+		typedef std::map<const IVertexBuffer*, SourceState> MapSourceState;
+		MapSourceState mUploaded;
+
+		// буферы рендер системы, создаются и используются только в потоке рендера
+		typedef std::map<const IVertexBuffer*, RenderBuffer> MapRenderBuffer;
+		MapRenderBuffer mItemBuffers;
+		typedef std::vector<IVertexBuffer*> VectorVertexBuffer;
+		VectorVertexBuffer mRenderBuffers;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_FRAME_SNAPSHOT_H_
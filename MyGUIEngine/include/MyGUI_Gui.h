@@ -153,9 +153,13 @@ namespace MyGUI
 		void _linkChildWidget(Widget* _widget);
 		void _unlinkChildWidget(Widget* _widget);
 
+		// создает виджет по заранее найденным фабрике и скину
+		Widget* _createWidget(const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name);
+
 	private:
 		// создает виджет
 		Widget* baseCreateWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name);
+		Widget* baseCreateWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name);
 
 		// удяляет неудачника
 		void _destroyChildWidget(Widget* _widget);
@@ -186,6 +190,10 @@ namespace MyGUI
 		ResourceManager* mResourceManager;
 		FactoryManager* mFactoryManager;
 		ToolTipManager* mToolTipManager;
+		TextViewCache* mTextViewCache;
+		MaskPickManager* mMaskPickManager;
+		TweenManager* mTweenManager;
+		TextureMemoryManager* mTextureMemoryManager;
 
 		bool mIsInitialise;
 	};
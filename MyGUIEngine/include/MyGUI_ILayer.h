@@ -12,6 +12,7 @@
 #include "MyGUI_IRenderTarget.h"
 #include "MyGUI_ILayerNode.h"
 #include "MyGUI_ISerializable.h"
+#include "MyGUI_StringId.h"
 
 namespace MyGUI
 {
@@ -28,6 +29,11 @@ namespace MyGUI
 		virtual ~ILayer() { }
 
 		const std::string& getName() const
+		{
+			return mName.toString();
+		}
+
+		StringId getNameId() const
 		{
 			return mName;
 		}
@@ -65,7 +71,7 @@ namespace MyGUI
 		virtual void resizeView(const IntSize& _viewSize) = 0;
 
 	protected:
-		std::string mName;
+		StringId mName;
 	};
 
 } // namespace MyGUI
@@ -23,6 +23,11 @@ namespace MyGUI
 
 		virtual ILayerItem* getLayerItemByPoint(int _left, int _top) const = 0;
 		virtual const IntCoord& getLayerItemCoord() const = 0;
+		/** Absolute position that geometry of this item is relative to when layer node is translated on render target */
+		virtual IntPoint getLayerItemOrigin() const
+		{
+			return IntPoint();
+		}
 
 		virtual void resizeLayerItemView(const IntSize& _oldView, const IntSize& _newView) = 0;
 
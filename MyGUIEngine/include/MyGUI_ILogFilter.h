@@ -25,6 +25,14 @@ namespace MyGUI
 		{
 			return true;
 		}
+
+		/** Check if messages with specific level could be logged at all.\n
+			Called before message text is formatted, so filter that reject message only by level should override it.
+		*/
+		virtual bool isLevelEnabled(LogLevel _level)
+		{
+			return true;
+		}
 	};
 
 } // namespace MyGUI
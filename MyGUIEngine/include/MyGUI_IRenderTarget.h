@@ -29,6 +29,14 @@ namespace MyGUI
 		virtual void doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count) = 0;
 
 		virtual const RenderTargetInfo& getInfo() = 0;
+
+		/** Can render target move geometry by setTranslation, so that moved layer nodes are drawn without vertex regeneration */
+		virtual bool isTranslationSupported()
+		{
+			return false;
+		}
+		/** Set translation added to positions of all following doRender calls, in render target coordinates ([-1, 1] range is whole target) */
+		virtual void setTranslation(float _left, float _top) { }
 	};
 
 } // namespace MyGUI
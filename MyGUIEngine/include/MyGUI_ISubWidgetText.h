@@ -121,6 +121,11 @@ namespace MyGUI
 		}
 
 		virtual void setCaption(const UString& _value) { }
+		// текст в UTF-8, хранится и раскладывается без конвертации, если сабскин это умеет
+		virtual void setCaptionUTF8(const std::string& _value)
+		{
+			setCaption(UString(_value));
+		}
 		virtual const UString& getCaption() const
 		{
 			return Constants::getEmptyUString();
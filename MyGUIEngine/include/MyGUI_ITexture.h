@@ -10,6 +10,7 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IRenderTarget.h"
 #include "MyGUI_RenderFormat.h"
+#include "MyGUI_Types.h"
 #include <string>
 
 namespace MyGUI
@@ -43,6 +44,15 @@ namespace MyGUI
 		virtual void unlock() = 0;
 		virtual bool isLocked() = 0;
 
+		/** Lock texture for writing of region, on unlock only this region is uploaded and pixels outside of it keep their content.
+			Returned pointer points to the beginning of texture data, only pixels inside of region should be written.
+			Default implementation locks whole texture for write, content outside of region is undefined then.
+		*/
+		virtual void* lockRegion(const IntRect& _rect)
+		{
+			return lock(TextureUsage::Write);
+		}
+
 		virtual int getWidth() = 0;
 		virtual int getHeight() = 0;
 
@@ -23,6 +23,11 @@ namespace MyGUI
 
 		virtual Vertex* lock() = 0;
 		virtual void unlock() = 0;
+
+		/** Set number of vertexes written since lock, called before unlock.
+			Render system can upload only them and send quads as four vertexes with shared index buffer (see vertex_utility::packQuads).
+		*/
+		virtual void setWrittenVertexCount(size_t /*_value*/) { }
 	};
 
 } // namespace MyGUI
@@ -14,6 +14,7 @@
 #include "MyGUI_IUnlinkWidget.h"
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_ILayer.h"
+#include "MyGUI_DrawList.h"
 #include "MyGUI_BackwardCompatibility.h"
 
 namespace MyGUI
@@ -39,6 +40,8 @@ namespace MyGUI
 			@param _item Widget pointer
 		*/
 		void attachToLayerNode(const std::string& _name, Widget* _item);
+		/** Attach widget to specific layer, layer is found without string comparisons */
+		void attachToLayerNode(StringId _name, Widget* _item);
 		/** Detach widget from layer
 			@param _item Widget pointer
 		*/
@@ -63,6 +66,8 @@ namespace MyGUI
 
 		/** Get layer by name */
 		ILayer* getByName(const std::string& _name, bool _throw = true) const;
+		/** Get layer by interned name, nullptr if not found */
+		ILayer* getByName(StringId _name) const;
 
 		size_t getLayerCount() const;
 
@@ -74,6 +79,31 @@ namespace MyGUI
 		/** Render all layers to specified target */
 		void renderToTarget(IRenderTarget* _target, bool _update);
 
+		/** Record draw commands of all layers into draw list instead of rendering them.
+			RenderTargetInfo of _list target is used for vertexes generation.
+		*/
+		void renderToDrawList(DrawList* _list, bool _update);
+
+		/** Get count of layer nodes visited during last renderToTarget call.
+			Nodes without changes are drawn without visiting their child nodes.
+		*/
+		size_t getVisitedNodeCount() const;
+
+		/** Get count of vertexes generated during last renderToTarget call */
+		size_t getGeneratedVertexCount() const;
+
+		/** Enable drawing of moved layer nodes with render target translation instead of vertexes regeneration.
+			Used only when render target supports translation. All sub widgets must use
+			RenderItem::getRenderTargetInfo for vertexes generation. Disabled by default.
+		*/
+		void setNodeTranslation(bool _value);
+		/** Is drawing of moved layer nodes with translation enabled */
+		bool getNodeTranslation() const;
+
+		/*internal:*/
+		void _notifyNodeVisited();
+		void _notifyVertexesGenerated(size_t _count);
+
 		void resizeView(const IntSize& _viewSize);
 
 		const std::string& getCategoryName() const;
@@ -94,6 +124,9 @@ namespace MyGUI
 
 		bool mIsInitialise;
 		std::string mCategoryName;
+		size_t mVisitedNodeCount;
+		size_t mGeneratedVertexCount;
+		bool mNodeTranslation;
 	};
 
 } // namespace MyGUI
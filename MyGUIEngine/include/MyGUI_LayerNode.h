@@ -69,10 +69,24 @@ namespace MyGUI
 
 		virtual float getNodeDepth();
 
+		/** Is anything in this node or its child nodes changed since last render */
 		bool isOutOfDate() const;
 
+		/** Absolute position of root widget if it is the only one in node, otherwise zero */
+		IntPoint getOrigin() const;
+		/** Is _item the only item of node, so that moving it moves whole node */
+		bool isOriginItem(const ILayerItem* _item) const;
+		/** Sum of all offsets passed to _notifyOriginChanged, render items compare it to offset at their last update */
+		const IntPoint& getOriginShift() const;
+
+	/*internal:*/
+		/** Origin item was moved by _offset without any changes inside node */
+		void _notifyOriginChanged(const IntPoint& _offset);
+
 	protected:
+		void markOutOfDate();
 		void updateCompression();
+		RenderItem* createRenderItem(ITexture* _texture, bool _manualRender);
 		RenderItem* addToRenderItemFirstQueue(ITexture* _texture, bool _manualRender);
 		RenderItem* addToRenderItemSecondQueue(ITexture* _texture, bool _manualRender);
 	protected:
@@ -89,10 +103,18 @@ namespace MyGUI
 		// список такиж как мы, для построения дерева
 		VectorILayerNode mChildItems;
 
+		// рендер айтемы нода и всех дочерних нодов в порядке отрисовки,
+		// если ничего не менялось, то рисуем по нему без обхода дерева
+		VectorRenderItem mRenderQueue;
+		IRenderTarget* mRenderTarget;
+
 		ILayerNode* mParent;
 		ILayer* mLayer;
+		// изменения поднимаются вверх до корневого нода
 		bool mOutOfDate;
 		float mDepth;
+		// на сколько сдвигался нод целиком
+		IntPoint mOriginShift;
 	};
 
 } // namespace MyGUI
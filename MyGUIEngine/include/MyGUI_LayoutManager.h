@@ -13,16 +13,41 @@
 #include "MyGUI_WidgetDefines.h"
 #include "MyGUI_ResourceLayout.h"
 #include "MyGUI_BackwardCompatibility.h"
+#include "MyGUI_IUnlinkWidget.h"
 
 namespace MyGUI
 {
 
 	typedef delegates::CMultiDelegate3<Widget*, const std::string&, const std::string&> EventHandle_AddUserStringDelegate;
+	typedef delegates::CMultiDelegate2<size_t, const VectorWidgetPtr&> EventHandle_SizeTVectorWidgetPtr;
 
 	class MYGUI_EXPORT LayoutManager :
 		public Singleton<LayoutManager>,
+		public IUnlinkWidget,
 		public MemberObsolete<LayoutManager>
 	{
+	public:
+		/** Statistics of layout instance pools */
+		struct LayoutPoolStatistics
+		{
+			LayoutPoolStatistics() :
+				hitCount(0),
+				missCount(0),
+				releaseCount(0),
+				destroyCount(0)
+			{
+			}
+
+			/** Number of loadLayout calls that reused pooled instance */
+			size_t hitCount;
+			/** Number of loadLayout calls of pooled layouts that created new instance */
+			size_t missCount;
+			/** Number of instances returned to pool by unloadLayout */
+			size_t releaseCount;
+			/** Number of instances destroyed by unloadLayout because pool was full */
+			size_t destroyCount;
+		};
+
 	public:
 		LayoutManager();
 
@@ -37,9 +62,54 @@ namespace MyGUI
 		*/
 		VectorWidgetPtr loadLayout(const std::string& _file, const std::string& _prefix = "", Widget* _parent = nullptr);
 
-		/** Unload layout (actually deletes vector of widgets returned by loadLayout) */
+		/** Unload layout (actually deletes vector of widgets returned by loadLayout, or returns them to pool) */
 		void unloadLayout(VectorWidgetPtr& _widgets);
 
+		/** Keep up to _count unloaded instances of layout for reuse, 0 disables pooling (default).\n
+			Pooled instance is hidden by unloadLayout instead of destroying. loadLayout with same prefix and parent
+			resets its widgets to layer, align, coordinates, properties, user strings and controllers from layout,
+			clears user data, enables and shows them.
+			@note State that layout doesn't set is not reset: event delegates, children created by code, widget
+			content changed by user or code (caption, edit text, list items, scroll position, button state etc.)
+			when layout has no property for it, and properties set by code that layout doesn't mention.
+			Subscribe to events of pooled layouts once.
+		*/
+		void setLayoutPoolSize(const std::string& _file, size_t _count);
+		/** Get number of unloaded instances of layout kept for reuse */
+		size_t getLayoutPoolSize(const std::string& _file) const;
+		/** Destroy all unloaded instances kept for reuse */
+		void clearLayoutPools();
+
+		/** Get statistics of layout instance pools */
+		const LayoutPoolStatistics& getLayoutPoolStatistics() const;
+		/** Reset statistics of layout instance pools */
+		void resetLayoutPoolStatistics();
+
+		/** Load layout file over several frames.\n
+			Widgets are created on frame start while time set by setLoadingFrameBudget is not spent,
+			root widgets are hidden until loading is complete and eventLayoutLoaded is called.
+			Loading is stopped without event if _parent is destroyed.
+			@param _file name of layout
+			@param _prefix will be added to all loaded widgets names
+			@param _parent widget to load on
+			@return Handle of loading or 0 if layout couldn't be loaded
+		*/
+		size_t loadLayoutIncremental(const std::string& _file, const std::string& _prefix = "", Widget* _parent = nullptr);
+
+		/** Create all widgets of incremental loading right now, eventLayoutLoaded is called */
+		void finishLayoutLoading(size_t _handle);
+		/** Stop incremental loading and destroy already created widgets */
+		void cancelLayoutLoading(size_t _handle);
+		/** Is incremental loading in progress */
+		bool isLayoutLoading(size_t _handle) const;
+
+		/** Set time in milliseconds for creating widgets of incremental loadings on each frame.
+			At least one widget is created on each frame, so 0 means one widget per frame.
+		*/
+		void setLoadingFrameBudget(unsigned long _value);
+		/** Get time in milliseconds for creating widgets of incremental loadings on each frame */
+		unsigned long getLoadingFrameBudget() const;
+
 		/** Get ResourceLayout by name */
 		ResourceLayout* getByName(const std::string& _name, bool _throw = true) const;
 
@@ -55,15 +125,91 @@ namespace MyGUI
 		*/
 		EventHandle_AddUserStringDelegate eventAddUserString;
 
+		/** Event : Multidelegate. Incremental loading is complete.\n
+			signature : void method(size_t _handle, const MyGUI::VectorWidgetPtr& _widgets)
+			@param _handle Handle returned by loadLayoutIncremental.
+			@param _widgets Loaded root widgets, same as loadLayout returns.
+		*/
+		EventHandle_SizeTVectorWidgetPtr eventLayoutLoaded;
+
 		const std::string& getCurrentLayout() const;
 
 	private:
 		void _load(xml::ElementPtr _node, const std::string& _file, Version _version);
 
+		ResourceLayout* findLayout(const std::string& _file);
+
+		struct LoadingItem
+		{
+			const WidgetInfo* info;
+			Widget* widget;
+			size_t child;
+		};
+
+		struct Loading
+		{
+			size_t handle;
+			std::string file;
+			std::string prefix;
+			Widget* parent;
+			// копия, ресурс могут выгрузить во время загрузки
+			VectorWidgetInfo data;
+			size_t root;
+			// путь от рута к создаваемому виджету
+			std::vector<LoadingItem> stack;
+			VectorWidgetPtr widgets;
+			std::vector<bool> visible;
+		};
+
+		struct PoolInstance
+		{
+			std::string prefix;
+			Widget* parent;
+			VectorWidgetPtr widgets;
+			// виджеты и их описание в порядке создания
+			std::vector<std::pair<Widget*, const WidgetInfo*> > items;
+			bool pooled;
+		};
+		typedef std::vector<PoolInstance*> VectorPoolInstance;
+
+		struct LayoutPool
+		{
+			size_t size;
+			// копия, ресурс могут выгрузить пока живут экземпляры
+			VectorWidgetInfo data;
+			VectorPoolInstance instances;
+		};
+		typedef std::map<std::string, LayoutPool*> MapLayoutPool;
+		typedef std::map<Widget*, std::pair<LayoutPool*, PoolInstance*> > MapPoolWidget;
+
+		virtual void _unlinkWidget(Widget* _widget);
+		void frameEntered(float _time);
+
+		VectorWidgetPtr loadPooledLayout(LayoutPool* _pool, const std::string& _prefix, Widget* _parent);
+		void createPooledWidget(PoolInstance* _instance, const WidgetInfo& _info, const std::string& _prefix, Widget* _parent, bool _root);
+		void forgetPoolInstance(LayoutPool* _pool, PoolInstance* _instance);
+		void shrinkPool(LayoutPool* _pool);
+
+		bool stepLoading(Loading* _loading);
+		void completeLoading(Loading* _loading);
+		size_t findLoading(size_t _handle) const;
+		void updateFrameSubscription();
+
 	private:
 		bool mIsInitialise;
 		std::string mCurrentLayoutName;
 		std::string mXmlLayoutTagName;
+
+		typedef std::vector<Loading*> VectorLoading;
+		VectorLoading mLoadings;
+		size_t mLastLoadingHandle;
+		unsigned long mLoadingFrameBudget;
+		bool mFrameSubscribed;
+
+		MapLayoutPool mPools;
+		// руты всех экземпляров из пулов, и загруженных и скрытых
+		MapPoolWidget mPoolWidgets;
+		LayoutPoolStatistics mPoolStatistics;
 	};
 
 } // namespace MyGUI
@@ -22,6 +22,8 @@ namespace MyGUI
 
 		//! @copydoc ILogFilter::shouldLog(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line)
 		virtual bool shouldLog(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line);
+		//! @copydoc ILogFilter::isLevelEnabled(LogLevel _level)
+		virtual bool isLevelEnabled(LogLevel _level);
 
 		/** Set logging level.
 			@param _value messages with this or higher level will be logged.
@@ -12,13 +12,20 @@
 #include "MyGUI_LogSource.h"
 #include "MyGUI_Diagnostic.h"
 #include <vector>
+#include <time.h>
 
 namespace MyGUI
 {
 
+// текст форматируется только если уровень сообщения проходит хотя бы через один фильтр
 #define MYGUI_LOGGING(section, level, text) \
-		MyGUI::LogManager::getInstance().log(section, MyGUI::LogLevel::level, MyGUI::LogStream() << text << MyGUI::LogStream::End(), __FILE__, __LINE__)
+		do \
+		{ \
+			if (MyGUI::LogManager::getInstance().isLevelEnabled(MyGUI::LogLevel::level)) \
+				MyGUI::LogManager::getInstance().log(section, MyGUI::LogLevel::level, MyGUI::LogStream() << text << MyGUI::LogStream::End(), __FILE__, __LINE__); \
+		} while (false)
 
+	class AsyncLogListener;
 	class ConsoleLogListener;
 	class FileLogListener;
 	class LevelLogFilter;
@@ -36,6 +43,8 @@ namespace MyGUI
 		void flush();
 		/** Call LogSource::log for all log sources. */
 		void log(const std::string& _section, LogLevel _level, const std::string& _message, const char* _file, int _line);
+		/** Check if messages with specific level pass filter of at least one log source. */
+		bool isLevelEnabled(LogLevel _level) const;
 
 		/** Create default LevelLogFilter, FileLogListener and ConsoleLogListener. */
 		void createDefaultSource(const std::string& _logname);
@@ -52,6 +61,13 @@ namespace MyGUI
 		/** Get default LevelLogFilter level. */
 		LogLevel getLoggingLevel() const;
 
+		/** Enable or disable writing of default log source in separate thread (AsyncLogListener).\n
+			Should be called before createDefaultSource. Disabled (false) by default.
+		*/
+		void setAsyncOutputEnabled(bool _value);
+		/** Is default log source written in separate thread. */
+		bool getAsyncOutputEnabled() const;
+
 		/** Add log source. */
 		void addLogSource(LogSource* _source);
 
@@ -67,10 +83,15 @@ namespace MyGUI
 		ConsoleLogListener* mConsole;
 		FileLogListener* mFile;
 		LevelLogFilter* mFilter;
+		AsyncLogListener* mAsync;
 		LogSource* mDefaultSource;
 
 		LogLevel mLevel;
 		bool mConsoleEnable;
+		bool mAsyncEnable;
+
+		time_t mLastTime;
+		struct tm mCurrentTime;
 	};
 
 } // namespace MyGUI
@@ -34,6 +34,8 @@ namespace MyGUI
 		void flush();
 		/** Call ILogListener::log for all listeners for messages that match LogSource filter (@see void setLogFilter(ILogFilter* _filter)). */
 		void log(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line);
+		/** Check if messages with specific level pass LogSource filter. */
+		bool isLevelEnabled(LogLevel _level) const;
 
 	private:
 		typedef std::vector<ILogListener*> VectorLogListeners;
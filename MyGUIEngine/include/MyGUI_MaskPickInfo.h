@@ -13,21 +13,73 @@
 namespace MyGUI
 {
 
+	/** Picking mask, white pixels of mask image are pickable.\n
+		Mask data is shared between copies and between all masks loaded from same file (see MaskPickManager).
+	*/
 	class MYGUI_EXPORT MaskPickInfo
 	{
 	public:
 		MaskPickInfo();
+		MaskPickInfo(const MaskPickInfo& _other);
+		~MaskPickInfo();
 
+		MaskPickInfo& operator = (const MaskPickInfo& _other);
+
+		/** Load mask from image file, same file is loaded once and shared */
 		bool load(const std::string& _file);
 
 		bool pick(const IntPoint& _point, const IntCoord& _coord) const;
 
 		bool empty() const;
 
+		/** Get mask width in pixels */
+		int getWidth() const;
+		/** Get mask height in pixels */
+		int getHeight() const;
+
+	/*internal:*/
+		enum
+		{
+			// размер ячейки грубой сетки, степень двойки
+			CellShift = 4,
+			CellSize = 1 << CellShift
+		};
+
+		enum CellState
+		{
+			CellEmpty,
+			CellFull,
+			CellMixed
+		};
+
+		struct Data
+		{
+			std::string file;
+			int width;
+			int height;
+			// строки по 32 пикселя в слове
+			size_t rowWords;
+			std::vector<uint32> bits;
+			// грубая сетка, пустые и полные ячейки отвечают без чтения битов
+			int gridWidth;
+			int gridHeight;
+			std::vector<uint8> cells;
+			size_t refCount;
+			// менеджер уже удален, освобождается последней маской
+			bool orphan;
+		};
+
+		/** Create mask that shares _data, takes reference */
+		explicit MaskPickInfo(Data* _data);
+
+		/** Get shared mask data, nullptr if mask is empty */
+		const Data* _getData() const;
+
+	private:
+		void release();
+
 	private:
-		std::vector<uint8> mData;
-		int mWidth;
-		int mHeight;
+		Data* mData;
 	};
 
 } // namespace MyGUI
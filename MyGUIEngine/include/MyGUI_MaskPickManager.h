@@ -0,0 +1,76 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_MASK_PICK_MANAGER_H_
+#define MYGUI_MASK_PICK_MANAGER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Singleton.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_RenderFormat.h"
+#include "MyGUI_MaskPickInfo.h"
+#include "MyGUI_Delegate.h"
+
+namespace MyGUI
+{
+
+	typedef delegates::CDelegate4<const std::string&, IntSize&, PixelFormat&, std::vector<uint8>&> EventHandle_StringIntSizeRefPixelFormatRefVectorUint8Ref;
+
+	/** Shared picking masks.\n
+		Masks are loaded once per file name and shared by all widgets that use them while they are used.
+		Mask is stored as one bit per pixel with coarse grid of empty and full cells.
+	*/
+	class MYGUI_EXPORT MaskPickManager :
+		public Singleton<MaskPickManager>
+	{
+	public:
+		MaskPickManager();
+
+		void initialise();
+		void shutdown();
+
+		/** Get mask for image file, empty mask if file can't be loaded */
+		MaskPickInfo getMaskPick(const std::string& _file);
+
+		/** Get number of loaded masks */
+		size_t getMaskCount() const;
+		/** Get memory used by all loaded masks in bytes */
+		size_t getDataSize() const;
+		/** Get number of image decodes since start, shared masks are decoded once */
+		size_t getLoadCount() const;
+
+		/** Event : Decode image file into pixels without creating texture.\n
+			Mask is loaded through texture if event is not set or _data is left empty.\n
+			signature : void method(const std::string& _file, MyGUI::IntSize& _size, MyGUI::PixelFormat& _format, std::vector<MyGUI::uint8>& _data)\n
+			@param _file Image file name, read it through DataManager.
+			@param _size Size of image to fill.
+			@param _format Format of pixels to fill.
+			@param _data Pixels to fill, rows without padding.
+		*/
+		EventHandle_StringIntSizeRefPixelFormatRefVectorUint8Ref eventDecodeImage;
+
+	/*internal:*/
+		/** Release data of mask that is not used anymore, can be called after manager shutdown */
+		static void _release(MaskPickInfo::Data* _data);
+
+	private:
+		MaskPickInfo::Data* loadData(const std::string& _file);
+		void removeData(MaskPickInfo::Data* _data);
+
+		static MaskPickInfo::Data* createData(const uint8* _pixels, int _width, int _height, size_t _pixelSize);
+
+	private:
+		typedef std::map<std::string, MaskPickInfo::Data*> MapData;
+		MapData mData;
+
+		size_t mLoadCount;
+
+		bool mIsInitialise;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_MASK_PICK_MANAGER_H_
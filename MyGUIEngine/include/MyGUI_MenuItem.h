@@ -30,6 +30,8 @@ namespace MyGUI
 
 		/** @copydoc TextBox::setCaption(const UString& _value) */
 		virtual void setCaption(const UString& _value);
+		/** @copydoc TextBox::setCaptionUTF8(const std::string& _value) */
+		virtual void setCaptionUTF8(const std::string& _value);
 
 		/** @copydoc TextBox::setFontName(const std::string& _value) */
 		virtual void setFontName(const std::string& _value);
@@ -28,6 +28,8 @@ namespace MyGUI
 
 		/** Set item caption */
 		virtual void setCaption(const UString& _value);
+		/** @copydoc TextBox::setCaptionUTF8(const std::string& _value) */
+		virtual void setCaptionUTF8(const std::string& _value);
 		/** Get item caption */
 		virtual const UString& getCaption();
 
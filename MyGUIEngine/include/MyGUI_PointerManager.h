@@ -93,7 +93,7 @@ namespace MyGUI
 		Widget* mWidgetOwner;
 		ImageBox* mMousePointer;
 		IPointer* mPointer;
-		std::string mCurrentMousePointer;
+		StringId mCurrentMousePointer;
 
 		bool mIsInitialise;
 		std::string mXmlPointerTagName;
@@ -46,6 +46,11 @@ namespace MyGUI
 	class FactoryManager;
 	class TextureManager;
 	class ToolTipManager;
+	class TextViewCache;
+	class MaskPickManager;
+	class TweenManager;
+	class TextureMemoryManager;
+	struct ResolvedWidgetType;
 
 	class Widget;
 	class Button;
@@ -69,6 +74,8 @@ namespace MyGUI
 	class ScrollView;
 	class DDContainer;
 	class Canvas;
+	class TreeControl;
+	class TreeControlItem;
 
 	// Define version
 #define MYGUI_VERSION_MAJOR 3
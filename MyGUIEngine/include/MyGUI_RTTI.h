@@ -41,6 +41,8 @@ namespace MyGUI
 			MYGUI_DECLARE_TYPE_NAME(BaseType) \
 			/** Compare with selected type */ \
 			virtual bool isType(MYGUI_RTTI_TYPE _type) const { return MYGUI_RTTI_GET_TYPE(BaseType) == _type; } \
+			/** Get size of object type in bytes */ \
+			virtual size_t getTypeSize() const { return sizeof(BaseType); } \
 			/** Compare with selected type */ \
 			template<typename Type> bool isType() const { return isType(MYGUI_RTTI_GET_TYPE(Type)); } \
 			/** Try to cast pointer to selected type. \
@@ -69,6 +71,8 @@ namespace MyGUI
 			typedef DerivedType RTTIBase; \
 			/** Compare with selected type */ \
 			virtual bool isType(MYGUI_RTTI_TYPE _type) const { return MYGUI_RTTI_GET_TYPE(DerivedType) == _type || Base::isType(_type); } \
+			/** Get size of object type in bytes */ \
+			virtual size_t getTypeSize() const { return sizeof(DerivedType); } \
 			/** Compare with selected type */ \
 			template<typename Type> bool isType() const { return isType(MYGUI_RTTI_GET_TYPE(Type)); }
 
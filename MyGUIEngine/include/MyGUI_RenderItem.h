@@ -16,13 +16,14 @@
 namespace MyGUI
 {
 
+	class LayerNode;
 	typedef std::pair<ISubWidget*, size_t> DrawItemInfo;
 	typedef std::vector<DrawItemInfo> VectorDrawItem;
 
 	class MYGUI_EXPORT RenderItem
 	{
 	public:
-		RenderItem();
+		explicit RenderItem(LayerNode* _owner = nullptr);
 		virtual ~RenderItem();
 
 		void renderToTarget(IRenderTarget* _target, bool _update);
@@ -50,9 +51,17 @@ namespace MyGUI
 
 		IRenderTarget* getRenderTarget();
 
+		/** Render target info for vertexes generation, offsets include origin of vertexes when layer node is translated */
+		const RenderTargetInfo& getRenderTargetInfo() const;
+		/** Absolute position that generated vertexes are relative to, zero if node is not translated */
+		const IntPoint& getVertexOrigin() const;
+
 		void setNeedCompression(bool _compression);
 		bool getNeedCompression() const;
 
+	private:
+		void correctDrawItems();
+
 	private:
 #if MYGUI_DEBUG_MODE == 1
 		std::string mTextureName;
@@ -74,9 +83,18 @@ namespace MyGUI
 
 		IVertexBuffer* mVertexBuffer;
 		IRenderTarget* mRenderTarget;
+		RenderTargetInfo mRenderTargetInfo;
+
+		// вершины построены относительно этой точки
+		IntPoint mVertexOrigin;
+		// сдвиг нода на момент построения вершин
+		IntPoint mOriginShift;
 
 		bool mNeedCompression;
 		bool mManualRender;
+
+		// нод, которому сообщаем об изменениях
+		LayerNode* mOwner;
 	};
 
 } // namespace MyGUI
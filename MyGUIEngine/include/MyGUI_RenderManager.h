@@ -13,6 +13,7 @@
 #include "MyGUI_ITexture.h"
 #include "MyGUI_IVertexBuffer.h"
 #include "MyGUI_IRenderTarget.h"
+#include "MyGUI_DrawList.h"
 
 namespace MyGUI
 {
@@ -21,6 +22,7 @@ namespace MyGUI
 		public Singleton<RenderManager>
 	{
 	public:
+		RenderManager();
 
 		/** Create vertex buffer.
 			This method should create vertex buffer with triangles list type,
@@ -51,10 +53,63 @@ namespace MyGUI
 		virtual bool checkTexture(ITexture* _texture);
 #endif
 
+		/** Enable frame snapshot mode, render items keep vertexes in system memory
+			and frames are drawn through FrameSnapshot. Must be set before Gui is created.
+		*/
+		void setFrameSnapshotMode(bool _value);
+		/** Is frame snapshot mode enabled */
+		bool getFrameSnapshotMode() const;
+
+		/*internal:*/
+		IVertexBuffer* _createItemVertexBuffer();
+		void _destroyItemVertexBuffer(IVertexBuffer* _buffer);
+		/** Get and clear list of render item buffers destroyed since last call, used by FrameSnapshot */
+		void _takeReleasedItemVertexBuffers(std::vector<const IVertexBuffer*>& _result);
+
+		/** Texture is used by captured frame that may be drawn by render thread right now. */
+		void _pinTexture(ITexture* _texture);
+		/** Frame stopped using texture, deferred destroy is done when texture is not pinned anymore. */
+		void _unpinTexture(ITexture* _texture);
+		/** Is texture used by frames in flight */
+		bool _isTexturePinned(ITexture* _texture) const;
+		/** Destroy texture, if texture is pinned destroy is deferred until last frame that uses it is finished. */
+		void _destroyTextureDeferred(ITexture* _texture);
+		/** Write pixels of _rect from _data (texture sized image) into pinned texture at next frames sync point. */
+		void _writeTextureDeferred(ITexture* _texture, const IntRect& _rect, const uint8* _data);
+		/** Apply deferred writes, called at frames sync point when render thread doesn't draw. */
+		void _flushDeferredTextureWrites();
+
 	protected:
 		virtual void onResizeView(const IntSize& _viewSize);
 		virtual void onRenderToTarget(IRenderTarget* _target, bool _update);
+		virtual void onRenderToDrawList(DrawList* _list, bool _update);
 		virtual void onFrameEvent(float _time);
+
+	private:
+		bool mFrameSnapshotMode;
+
+		typedef std::vector<const IVertexBuffer*> VectorConstVertexBuffer;
+		VectorConstVertexBuffer mReleasedItemBuffers;
+
+		struct PinnedTexture
+		{
+			PinnedTexture() : pins(0), destroy(false) { }
+			size_t pins;
+			bool destroy;
+		};
+		typedef std::map<ITexture*, PinnedTexture> MapPinnedTexture;
+		MapPinnedTexture mPinnedTextures;
+
+		struct TextureWrite
+		{
+			ITexture* texture;
+			IntRect rect;
+			std::vector<uint8> data;
+		};
+		typedef std::vector<TextureWrite> VectorTextureWrite;
+		VectorTextureWrite mTextureWrites;
+
+		void applyTextureWrite(const TextureWrite& _write);
 	};
 
 } // namespace MyGUI
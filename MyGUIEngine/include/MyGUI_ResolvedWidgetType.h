@@ -0,0 +1,40 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_RESOLVED_WIDGET_TYPE_H_
+#define MYGUI_RESOLVED_WIDGET_TYPE_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_FactoryManager.h"
+
+namespace MyGUI
+{
+
+	class ResourceSkin;
+	class ResourceLayout;
+
+	/** Widget factory and skin found by names once, see WidgetManager::resolveWidgetType.
+		Valid while FactoryManager::getChangeCount and ResourceManager::getChangeCount are not changed.
+	*/
+	struct ResolvedWidgetType
+	{
+		ResolvedWidgetType() :
+			factory(nullptr),
+			skin(nullptr),
+			templateLayout(nullptr)
+		{
+		}
+
+		std::string type;
+		FactoryManager::Delegate* factory;
+		// скин или шаблон, одно из двух
+		ResourceSkin* skin;
+		ResourceLayout* templateLayout;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_RESOLVED_WIDGET_TYPE_H_
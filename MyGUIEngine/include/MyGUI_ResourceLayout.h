@@ -10,6 +10,7 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IResource.h"
 #include "MyGUI_LayoutData.h"
+#include "MyGUI_ResolvedWidgetType.h"
 
 namespace MyGUI
 {
@@ -32,15 +33,63 @@ namespace MyGUI
 		/** Create widgets described in layout */
 		VectorWidgetPtr createLayout(const std::string& _prefix = "", Widget* _parent = nullptr);
 
+		/** Compile layout into construction plan used by createLayout.
+			Widget factories, skins and property checks are resolved once instead of on every created widget.
+			Plan is rebuilt automatically when factories or resources are changed.
+		*/
+		void compile();
+		/** Is layout compiled */
+		bool isCompiled() const;
+
 		// widget info -> Widget
 		Widget* createWidget(const WidgetInfo& _widgetInfo, const std::string& _prefix = "", Widget* _parent = nullptr, bool _template = false);
 
+	/*internal:*/
+		// widget info -> Widget without children and controllers
+		static Widget* _createWidgetItem(const WidgetInfo& _widgetInfo, const std::string& _prefix, Widget* _parent, bool _template);
+		// controllers are added after children are created
+		static void _createControllers(const WidgetInfo& _widgetInfo, Widget* _widget);
+		// widget created from _widgetInfo -> state right after creation, children are not changed
+		static void _resetWidgetItem(const WidgetInfo& _widgetInfo, Widget* _widget, Widget* _parent);
+		// coordinates of widget in _parent
+		static IntCoord _getWidgetCoord(const WidgetInfo& _widgetInfo, Widget* _parent);
+
 	protected:
 		// xml -> widget info
 		WidgetInfo parseWidget(xml::ElementEnumerator& _widget);
 
+	private:
+		struct CompiledProperty
+		{
+			const PairString* property;
+			// ключ уже проверен, применяется без BackwardCompatibility
+			bool checked;
+		};
+		typedef std::vector<CompiledProperty> VectorCompiledProperty;
+
+		struct CompiledWidget
+		{
+			const WidgetInfo* info;
+			ResolvedWidgetType type;
+			VectorCompiledProperty properties;
+			// число всех потомков, виджеты лежат в порядке обхода в глубину
+			size_t descendants;
+		};
+		typedef std::vector<CompiledWidget> VectorCompiledWidget;
+
+		void compileWidget(const WidgetInfo& _widgetInfo);
+		void updateCompiled();
+		Widget* createCompiledWidget(size_t& _index, const std::string& _prefix, Widget* _parent);
+
 	protected:
 		VectorWidgetInfo mLayoutData;
+
+	private:
+		VectorCompiledWidget mCompiledWidgets;
+		bool mCompiled;
+		bool mCompiledActual;
+		size_t mFactoryChangeCount;
+		size_t mResourceChangeCount;
 	};
 
 } // namespace MyGUI
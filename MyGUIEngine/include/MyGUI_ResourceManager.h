@@ -68,6 +68,11 @@ namespace MyGUI
 
 		size_t getCount() const;
 
+		/** Get number of changes of resources list, it is increased on every add, remove or replace of resource.
+			Used to check if resource pointers cached by name are still valid.
+		*/
+		size_t getChangeCount() const;
+
 		const std::string& getCategoryName() const;
 
 	private:
@@ -84,6 +89,8 @@ namespace MyGUI
 		typedef std::vector<IResource*> VectorResource;
 		VectorResource mRemovedResoures;
 
+		size_t mChangeCount;
+
 		bool mIsInitialise;
 		std::string mCategoryName;
 		std::string mXmlListTagName;
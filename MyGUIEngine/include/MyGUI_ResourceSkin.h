@@ -12,6 +12,7 @@
 #include "MyGUI_ChildSkinInfo.h"
 #include "MyGUI_MaskPickInfo.h"
 #include "MyGUI_IResource.h"
+#include "MyGUI_StringId.h"
 #include "MyGUI_SubWidgetInfo.h"
 
 namespace MyGUI
@@ -31,6 +32,7 @@ namespace MyGUI
 
 		const IntSize& getSize() const;
 		const std::string& getTextureName() const;
+		StringId getTextureNameId() const;
 		const VectorSubWidgetInfo& getBasisInfo() const;
 		const MapWidgetStateInfo& getStateInfo() const;
 		const MapString& getProperties() const;
@@ -51,7 +53,7 @@ namespace MyGUI
 
 	private:
 		IntSize mSize;
-		std::string mTexture;
+		StringId mTexture;
 		VectorSubWidgetInfo mBasis;
 		MapWidgetStateInfo mStates;
 		// дополнительные параметры скина
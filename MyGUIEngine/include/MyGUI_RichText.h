@@ -0,0 +1,191 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_RICH_TEXT_H_
+#define MYGUI_RICH_TEXT_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_ISubWidgetText.h"
+#include "MyGUI_IFont.h"
+#include "MyGUI_FontData.h"
+#include "MyGUI_RenderFormat.h"
+#include "MyGUI_VertexData.h"
+#include "MyGUI_VertexUtility.h"
+
+namespace MyGUI
+{
+
+	class RenderItem;
+	class RichTextBatch;
+
+	/** Text sub widget that draws formatted text with several fonts, colours and links.\n
+		Caption is markup with tags <b>, <i>, <h1>, <h2>, <h3> (font is set by setTagFont),
+		<font name='...'>, <color value='#FF0000'>, <url value='...'>, <u>, <s>, <p>, <br/>.\n
+		All glyphs of one font texture are drawn by one draw item, links are found by getLinkAt.
+	*/
+	class MYGUI_EXPORT RichText :
+		public ISubWidgetText
+	{
+		MYGUI_RTTI_DERIVED( RichText )
+
+	public:
+		RichText();
+		virtual ~RichText();
+
+		virtual void setVisible(bool _value);
+		virtual void setAlpha(float _value);
+		virtual void setStateData(IStateInfo* _data);
+
+		virtual void createDrawItem(ITexture* _texture, ILayerNode* _node);
+		virtual void destroyDrawItem();
+
+		// рисуют пачки, сам текст ничего не рисует
+		virtual void doRender();
+
+		virtual void _updateView();
+		virtual void _correctView();
+		virtual void _setAlign(const IntSize& _oldsize);
+
+		virtual void setCaption(const UString& _value);
+		virtual const UString& getCaption() const;
+
+		virtual void setTextColour(const Colour& _value);
+		virtual const Colour& getTextColour() const;
+
+		virtual void setFontName(const std::string& _value);
+		virtual const std::string& getFontName() const;
+
+		virtual int getFontHeight() const;
+
+		virtual void setTextAlign(Align _value);
+		virtual Align getTextAlign() const;
+
+		virtual void setWordWrap(bool _value);
+
+		virtual IntSize getTextSize();
+
+		virtual void setViewOffset(const IntPoint& _point);
+		virtual IntPoint getViewOffset() const;
+
+		/** Set font for text inside tag, for example setTagFont("b", "Bold.14"). */
+		void setTagFont(const std::string& _tag, const std::string& _font);
+		/** Get font for text inside tag or empty string if tag uses default font. */
+		const std::string& getTagFont(const std::string& _tag) const;
+
+		/** Get url of link under point in absolute coordinates or empty string. */
+		const std::string& getLinkAt(const IntPoint& _point) const;
+
+		/** Get number of quads in laid out text. */
+		size_t getQuadCount() const;
+		/** Get number of draw items (one per font texture). */
+		size_t getBatchCount() const;
+
+	/*internal:*/
+		void _renderBatch(size_t _index);
+
+	private:
+		struct Quad
+		{
+			FloatRect rect;
+			FloatRect uv;
+			float lineTop;
+			uint32 colour;
+			bool customColour;
+		};
+		typedef std::vector<Quad> VectorQuad;
+
+		struct Batch
+		{
+			ITexture* texture;
+			RenderItem* renderItem;
+			RichTextBatch* item;
+			VectorQuad quads;
+			size_t vertexCount;
+		};
+		typedef std::vector<Batch> VectorBatch;
+
+		struct Link
+		{
+			IntRect rect;
+			size_t index;
+		};
+		typedef std::vector<Link> VectorLink;
+
+		struct Style
+		{
+			IFont* font;
+			uint32 colour;
+			bool customColour;
+			bool underline;
+			bool strike;
+			size_t link;
+		};
+		typedef std::vector<Style> VectorStyle;
+
+		struct LineGlyph
+		{
+			GlyphInfo* info;
+			IFont* font;
+			float left;
+			float advance;
+			bool visible;
+			Style style;
+		};
+		typedef std::vector<LineGlyph> VectorLineGlyph;
+
+		enum TagBreak
+		{
+			BreakNone,
+			BreakLine,
+			BreakParagraph
+		};
+
+		void updateLayout();
+		TagBreak parseTag(const UString& _tag, VectorStyle& _styles);
+		void addLine(VectorLineGlyph& _line, float _width, int& _top);
+		size_t getBatch(ITexture* _texture);
+		void addQuad(IFont* _font, const FloatRect& _rect, const FloatRect& _uv, float _lineTop, const Style& _style);
+		// сдвиг всего текста по вертикали для mTextAlign
+		int getAlignTop() const;
+
+		void attachBatches();
+		void detachBatches();
+		void markOutOfDate();
+
+		void drawQuad(vertex_utility::QuadBatch& _quads, FloatRect _rect, FloatRect _uv, uint32 _colour) const;
+
+	private:
+		UString mCaption;
+		std::string mFontName;
+		IFont* mFont;
+		MapString mTagFonts;
+
+		Colour mColour;
+		uint32 mColourNative;
+		uint32 mAlphaNative;
+		float mAlpha;
+		Align mTextAlign;
+		bool mWordWrap;
+		bool mManualColour;
+		VertexColourType mVertexFormat;
+
+		IntPoint mViewOffset;
+		IntSize mTextSize;
+		IntCoord mCurrentCoord;
+		bool mEmptyView;
+		int mLayoutWidth;
+
+		VectorBatch mBatches;
+		VectorLink mLinkAreas;
+		VectorString mLinks;
+
+		ILayerNode* mNode;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_RICH_TEXT_H_
@@ -30,6 +30,9 @@ namespace MyGUI
 		void _setTextureName(const std::string& _texture);
 		const std::string& _getTextureName() const;
 
+		/** Get memory used by sub widgets of skin in bytes */
+		size_t _getSkinItemMemoryUsage() const;
+
 	protected:
 		void _createSkinItem(ResourceSkin* _info);
 		void _deleteSkinItem();
@@ -51,10 +54,10 @@ namespace MyGUI
 		ISubWidgetText* mText;
 		// указатель на первый не текстовой сабскин
 		ISubWidgetRect* mMainSkin;
-		// список всех стейтов
-		MapWidgetStateInfo mStateInfo;
+		// стейты скина, общие для всех виджетов с этим скином
+		const MapWidgetStateInfo* mStateInfo;
 
-		std::string mTextureName;
+		StringId mTextureName;
 		ITexture* mTexture;
 
 		bool mSubSkinsVisible;
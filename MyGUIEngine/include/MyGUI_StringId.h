@@ -0,0 +1,82 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_STRING_ID_H_
+#define MYGUI_STRING_ID_H_
+
+#include "MyGUI_Prerequest.h"
+#include <string>
+
+namespace MyGUI
+{
+
+	/** Interned string. Every distinct string is stored once in global table and never freed,
+		StringId is pointer to it, so ids are compared, copied and hashed in constant time.
+		Used for type, layer, pointer, texture names and user string keys that repeat in many widgets.
+		@note Table is not thread safe, ids should be created in GUI thread.
+	*/
+	class MYGUI_EXPORT StringId
+	{
+	public:
+		/** Empty string id */
+		StringId() :
+			mValue(nullptr)
+		{
+		}
+
+		/** Intern string */
+		explicit StringId(const std::string& _value);
+		/** Intern string */
+		explicit StringId(const char* _value);
+
+		StringId& operator = (const std::string& _value);
+
+		const std::string& toString() const;
+
+		bool empty() const
+		{
+			return mValue == nullptr;
+		}
+
+		/** Hash in constant time, equal for equal strings */
+		size_t getHash() const
+		{
+			return reinterpret_cast<size_t>(mValue);
+		}
+
+		friend bool operator == (const StringId& _left, const StringId& _right)
+		{
+			return _left.mValue == _right.mValue;
+		}
+
+		friend bool operator != (const StringId& _left, const StringId& _right)
+		{
+			return _left.mValue != _right.mValue;
+		}
+
+		/** Order of ids is stable but not alphabetical */
+		friend bool operator < (const StringId& _left, const StringId& _right)
+		{
+			return _left.mValue < _right.mValue;
+		}
+
+		/** Find id of already interned string without adding it to table.
+			@return false if string was never interned, then no id is equal to it.
+		*/
+		static bool find(const std::string& _value, StringId& _result);
+
+		/** Get number of interned strings */
+		static size_t getInternedCount();
+		/** Get approximate memory used by interned strings table in bytes */
+		static size_t getInternedBytes();
+
+	private:
+		const std::string* mValue;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_STRING_ID_H_
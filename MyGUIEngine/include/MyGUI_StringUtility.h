@@ -22,6 +22,13 @@ namespace MyGUI
 			if (_left) _str.erase(0, _str.find_first_not_of(" \t\r"));
 		}
 
+		// память строки в куче, короткие строки хранятся внутри объекта
+		inline size_t getHeapSize(const std::string& _str)
+		{
+			static const size_t local = std::string().capacity();
+			return _str.capacity() > local ? _str.capacity() + 1 : 0;
+		}
+
 		// конвертирование в строку
 		template<typename T>
 		inline std::string toString (T p)
@@ -32,6 +32,11 @@ namespace MyGUI
 
 		/** Set widget caption */
 		virtual void setCaption(const UString& _value);
+		/** Set widget caption from UTF-8 text.\n
+			Plain text sub widget keeps UTF-8 and lays it out without conversion to UString,
+			conversion happens only if caption is requested.
+		*/
+		virtual void setCaptionUTF8(const std::string& _value);
 		/** Get widget caption */
 		virtual const UString& getCaption();
 
@@ -19,9 +19,22 @@ namespace MyGUI
 	{
 	public:
 		TextView();
+		~TextView();
 
+		/** Lay out text, layout is shared through TextViewCache when cache is enabled */
 		void update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
 
+		/** Lay out UTF-8 text decoding it in place, without conversion to UString.
+			Layout is not shared through TextViewCache. Characters outside of BMP are one character here,
+			while UString layout counts them as two UTF-16 code units.
+		*/
+		void updateUTF8(const std::string& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
+
+		/** Lay out text into _layout without cache */
+		static void updateLayout(TextViewLayout& _layout, const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
+		/** Lay out UTF-8 text into _layout without cache and conversion to UString */
+		static void updateLayoutUTF8(TextViewLayout& _layout, const std::string& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
+
 		size_t getCursorPosition(const IntPoint& _value);
 
 		IntPoint getCursorPoint(size_t _position);
@@ -33,9 +46,18 @@ namespace MyGUI
 		const VectorLineInfo& getData() const;
 
 	private:
-		IntSize mViewSize;
-		size_t mLength;
-		VectorLineInfo mLineInfo;
+		TextView(const TextView& _other);
+		TextView& operator = (const TextView& _other);
+
+		void releaseLayout();
+
+		template <typename Iterator>
+		static void layoutText(TextViewLayout& _layout, Iterator _index, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth);
+
+	private:
+		TextViewLayout mLocalLayout;
+		// текущая раскладка, своя или общая из кеша
+		const TextViewLayout* mLayout;
 		int mFontHeight;
 	};
 
@@ -0,0 +1,120 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TEXT_VIEW_CACHE_H_
+#define MYGUI_TEXT_VIEW_CACHE_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Singleton.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_UString.h"
+#include "MyGUI_RenderFormat.h"
+#include "MyGUI_TextViewData.h"
+#include "MyGUI_IFont.h"
+#include <list>
+
+namespace MyGUI
+{
+
+	/** Shared cache of text layouts.\n
+		Text with same caption, font, height, align and max width is laid out once and
+		shared between all TextView's that show it (button captions, column headers, list rows).
+		Cache is disabled by default.
+	*/
+	class MYGUI_EXPORT TextViewCache :
+		public Singleton<TextViewCache>
+	{
+	public:
+		TextViewCache();
+
+		void initialise();
+		void shutdown();
+
+		/** Enable or disable cache, disabling cache drops all unused layouts */
+		void setEnabled(bool _value);
+		/** Is cache enabled */
+		bool getEnabled() const;
+
+		/** Set maximum number of layouts in cache, layouts that are not used by any TextView are dropped first */
+		void setMaxSize(size_t _value);
+		/** Get maximum number of layouts in cache */
+		size_t getMaxSize() const;
+
+		/** Set maximum length of cached text, longer text (for example in EditBox) is laid out by TextView itself */
+		void setMaxTextLength(size_t _value);
+		/** Get maximum length of cached text */
+		size_t getMaxTextLength() const;
+
+		/** Drop all layouts that are not used, must be called when font is unloaded */
+		void clear();
+
+		/** Get number of layouts in cache */
+		size_t getSize() const;
+		/** Get number of requests that were served from cache */
+		size_t getHitCount() const;
+		/** Get number of requests that were laid out */
+		size_t getMissCount() const;
+		/** Get part of requests that were served from cache in [0, 1] range */
+		float getHitRate() const;
+		/** Reset hit and miss counters */
+		void resetStatistics();
+
+	/*internal:*/
+		/** Get shared layout, nullptr if text can't be cached */
+		const TextViewLayout* _acquire(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth);
+		/** Release layout returned by _acquire, can be called after cache shutdown */
+		static void _release(const TextViewLayout* _layout);
+
+	private:
+		struct Key
+		{
+			bool operator < (const Key& _other) const;
+
+			const UString* text;
+			IFont* font;
+			int height;
+			int maxWidth;
+			Align align;
+			VertexColourType format;
+		};
+
+		struct Entry;
+		typedef std::map<Key, Entry*> MapEntry;
+		typedef std::list<Entry*> ListEntry;
+
+		struct Entry :
+			public TextViewLayout
+		{
+			UString text;
+			MapEntry::iterator position;
+			ListEntry::iterator unused;
+			size_t refCount;
+			// кеш уже удален, освобождается последним TextView
+			bool orphan;
+		};
+
+		void addUnused(Entry* _entry);
+		void removeEntry(Entry* _entry);
+		void trim(size_t _size);
+
+	private:
+		MapEntry mEntries;
+		// неиспользуемые раскладки, от старых к новым
+		ListEntry mUnused;
+
+		bool mEnabled;
+		size_t mMaxSize;
+		size_t mMaxTextLength;
+
+		size_t mHitCount;
+		size_t mMissCount;
+
+		bool mIsInitialise;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TEXT_VIEW_CACHE_H_
@@ -8,6 +8,7 @@
 #define MYGUI_TEXT_VIEW_DATA_H_
 
 #include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
 
 namespace MyGUI
 {
@@ -136,6 +137,19 @@ namespace MyGUI
 
 	typedef std::vector<LineInfo> VectorLineInfo;
 
+	// разложенный по строкам текст, результат TextView::update
+	struct TextViewLayout
+	{
+		TextViewLayout() :
+			length(0)
+		{
+		}
+
+		VectorLineInfo lineInfo;
+		IntSize viewSize;
+		size_t length;
+	};
+
 } // namespace MyGUI
 
 #endif // MYGUI_TEXT_VIEW_DATA_H_
@@ -0,0 +1,121 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TEXTURE_MEMORY_MANAGER_H_
+#define MYGUI_TEXTURE_MEMORY_MANAGER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Singleton.h"
+#include "MyGUI_ITexture.h"
+#include <map>
+
+namespace MyGUI
+{
+
+	/** Accounting of memory used by textures and memory budget.\n
+		Textures are tracked when they are drawn or loaded from file by MyGUI. Textures loaded from file with
+		the same name as texture are reloadable: when memory of resident textures is over budget, reloadable
+		textures that were not drawn in the last frame are unloaded at frame start in least recently used order,
+		and loaded again from file as soon as they are drawn or their size is requested.
+		Other textures (Canvas, fonts, render targets) are only counted.
+	*/
+	class MYGUI_EXPORT TextureMemoryManager :
+		public Singleton<TextureMemoryManager>
+	{
+	public:
+		/** Information about tracked texture */
+		struct TextureInfo
+		{
+			TextureInfo() :
+				texture(nullptr),
+				bytes(0),
+				lastUsedFrame(0),
+				reloadable(false),
+				resident(false)
+			{
+			}
+
+			ITexture* texture;
+			std::string name;
+			/** Size of texture data in bytes when texture is loaded */
+			size_t bytes;
+			/** Frame when texture was drawn last time, see getFrame */
+			size_t lastUsedFrame;
+			/** Texture is loaded from file with its name and can be unloaded */
+			bool reloadable;
+			/** Texture data is loaded now */
+			bool resident;
+		};
+
+		typedef std::vector<TextureInfo> VectorTextureInfo;
+
+		TextureMemoryManager();
+
+		void initialise();
+		void shutdown();
+
+		/** Set memory budget for all tracked textures in bytes, 0 means no limit (default) */
+		void setBudget(size_t _bytes);
+		/** Get memory budget for all tracked textures in bytes */
+		size_t getBudget() const;
+
+		/** Start tracking texture, texture must be loaded.
+			@param _reloadable Texture is loaded from file with its name and can be unloaded.
+		*/
+		void registerTexture(ITexture* _texture, bool _reloadable);
+		/** Mark texture as used in current frame, unloaded texture is loaded again.
+			Not tracked texture is tracked from now as not reloadable.
+		*/
+		void touchTexture(ITexture* _texture);
+
+		/** Unload reloadable texture right now.
+			@return false if texture is not tracked, not reloadable or already unloaded.
+		*/
+		bool evictTexture(ITexture* _texture);
+		/** Unload all reloadable textures that were not drawn in the last frame, regardless of budget.
+			@return number of unloaded textures.
+		*/
+		size_t evictUnusedTextures();
+
+		/** Get bytes of all currently loaded tracked textures */
+		size_t getUsedBytes();
+		/** Get number of tracked textures */
+		size_t getTextureCount();
+		/** Get information about all tracked textures */
+		void getTexturesInfo(VectorTextureInfo& _result);
+
+		/** Get number of frames since initialisation */
+		size_t getFrame() const;
+		/** Get number of textures unloaded since initialisation */
+		size_t getEvictCount() const;
+		/** Get number of textures loaded again since initialisation */
+		size_t getReloadCount() const;
+
+	private:
+		typedef std::map<ITexture*, TextureInfo> MapTextureInfo;
+
+		void frameEntered(float _time);
+		void validate();
+		void evictOverBudget();
+		void evict(TextureInfo& _info);
+		static size_t getTextureBytes(ITexture* _texture);
+		static bool compareLastUsedFrame(const TextureInfo* _left, const TextureInfo* _right);
+
+	private:
+		MapTextureInfo mTextures;
+		size_t mBudget;
+		size_t mUsedBytes;
+		size_t mFrame;
+		size_t mEvictCount;
+		size_t mReloadCount;
+		// число текстур после последней проверки
+		size_t mValidatedCount;
+		bool mIsInitialise;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TEXTURE_MEMORY_MANAGER_H_
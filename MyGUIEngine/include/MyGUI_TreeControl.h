@@ -0,0 +1,252 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TREE_CONTROL_H_
+#define MYGUI_TREE_CONTROL_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Widget.h"
+#include "MyGUI_Any.h"
+
+namespace MyGUI
+{
+
+	/** \brief @wpage{TreeControl}
+		TreeControl widget description should be here.\n
+		Only children of expanded nodes are flattened into rows, nodes are prepared (eventTreeNodePrepare)
+		when they are expanded or shown first time. Widgets are created only for lines visible in client
+		and reused on scroll like in ListBox, so scroll costs do not depend on tree size.
+	*/
+	class MYGUI_EXPORT TreeControl :
+		public Widget
+	{
+		MYGUI_RTTI_DERIVED( TreeControl )
+
+	public:
+		class Node;
+		typedef std::vector<Node*> VectorNodePtr;
+
+		typedef delegates::CMultiDelegate2<TreeControl*, Node*> EventHandle_TreeControlPtrNodePtr;
+		typedef delegates::CMultiDelegate2<TreeControl*, size_t> EventHandle_TreeControlPtrSizeT;
+
+		class MYGUI_EXPORT Node
+		{
+		public:
+			Node();
+			Node(const UString& _text, Node* _parent = nullptr);
+			Node(const UString& _text, const UString& _image, Node* _parent = nullptr);
+			virtual ~Node();
+
+			/** Add child node, node is removed from previous parent */
+			void add(Node* _node);
+			/** Remove child node */
+			void remove(Node* _node, bool _delete = true);
+			/** Remove all child nodes */
+			void removeAll(bool _delete = true);
+
+			bool hasAncestor(const Node* _node) const;
+			bool hasDescendant(const Node* _node) const;
+			bool hasChildren() const;
+			const VectorNodePtr& getChildren() const;
+
+			Node* getParent() const;
+			TreeControl* getOwner() const;
+
+			const UString& getText() const;
+			void setText(const UString& _value);
+
+			const UString& getImage() const;
+			void setImage(const UString& _value);
+
+			/** Node is prepared when its children are filled, see TreeControl::eventTreeNodePrepare */
+			bool isPrepared() const;
+			void setPrepared(bool _value);
+			void prepare();
+
+			bool isExpanded() const;
+			void setExpanded(bool _value);
+
+			void setData(Any _data);
+			template <typename ValueType>
+			ValueType* getData(bool _throw = true) const
+			{
+				return mData.castType<ValueType>(_throw);
+			}
+
+		private:
+			friend class TreeControl;
+
+			explicit Node(TreeControl* _owner);
+
+			void setOwner(TreeControl* _owner);
+			void detach(Node* _node);
+
+		private:
+			Node* mParent;
+			VectorNodePtr mChildren;
+			TreeControl* mOwner;
+			UString mText;
+			UString mImage;
+			bool mPrepared;
+			bool mExpanded;
+			Any mData;
+		};
+
+		TreeControl();
+
+		/** Get invisible root node, top level nodes are its children */
+		Node* getRoot() const;
+
+		/** Show root node as first line */
+		void setRootVisible(bool _value);
+		/** Is root node shown as first line */
+		bool isRootVisible() const;
+
+		/** Get selected node or nullptr */
+		Node* getSelection() const;
+		/** Select node, all its parents are expanded */
+		void setSelection(Node* _value);
+
+		/** Get number of lines, it is number of nodes with all parents expanded */
+		size_t getRowCount();
+		/** Get node shown on line or nullptr */
+		Node* getNodeAt(size_t _row);
+		/** Scroll so line becomes first visible line */
+		void beginToRow(size_t _row);
+
+		/** Redraw lines at next frame */
+		void invalidate();
+
+		//! @copydoc Widget::setPosition(const IntPoint& _value)
+		virtual void setPosition(const IntPoint& _value);
+		//! @copydoc Widget::setSize(const IntSize& _value)
+		virtual void setSize(const IntSize& _value);
+		//! @copydoc Widget::setCoord(const IntCoord& _value)
+		virtual void setCoord(const IntCoord& _value);
+
+		/** @copydoc Widget::setPosition(int _left, int _top) */
+		void setPosition(int _left, int _top);
+		/** @copydoc Widget::setSize(int _width, int _height) */
+		void setSize(int _width, int _height);
+		/** @copydoc Widget::setCoord(int _left, int _top, int _width, int _height) */
+		void setCoord(int _left, int _top, int _width, int _height);
+
+		/*events:*/
+		/** Event : Mouse is over node line.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodeMouseSetFocus;
+
+		/** Event : Mouse left node line.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodeMouseLostFocus;
+
+		/** Event : Selected node changed.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodeSelected;
+
+		/** Event : Double click on node line.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodeActivated;
+
+		/** Event : Right click on node line.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodeContextMenu;
+
+		/** Event : Node children are requested first time, fill them here.\n
+			signature : void method(MyGUI::TreeControl* _sender, MyGUI::TreeControl::Node* _node)
+		*/
+		EventHandle_TreeControlPtrNodePtr eventTreeNodePrepare;
+
+		/** Event : Position of scroll changed.\n
+			signature : void method(MyGUI::TreeControl* _sender, size_t _position)
+		*/
+		EventHandle_TreeControlPtrSizeT eventTreeScrolled;
+
+	/*internal:*/
+		void _notifyNodeChanged(Node* _node, bool _structure);
+		void _notifyNodeRemoved(Node* _node);
+
+	protected:
+		virtual void initialiseOverride();
+		virtual void shutdownOverride();
+
+		virtual void onMouseWheel(int _rel);
+
+		void notifyMousePressed(Widget* _sender, int _left, int _top, MouseButton _id);
+		void notifyMouseWheel(Widget* _sender, int _rel);
+		void notifyMouseDoubleClick(Widget* _sender);
+		void notifyMouseSetFocus(Widget* _sender, Widget* _old);
+		void notifyMouseLostFocus(Widget* _sender, Widget* _new);
+		void notifyScrollChangePosition(ScrollBar* _sender, size_t _position);
+		void notifyExpandCollapse(Widget* _sender);
+		void notifyFrameEntered(float _time);
+
+	private:
+		struct Row
+		{
+			Row(Node* _node, size_t _level) :
+				node(_node),
+				level(_level)
+			{
+			}
+
+			Node* node;
+			size_t level;
+		};
+		typedef std::vector<Row> VectorRow;
+
+		// пересобирает строки развернутых узлов
+		void updateRows();
+		void flattenChildren(Node* _node, size_t _level, VectorRow& _rows);
+		bool isNodeShown(Node* _node) const;
+
+		void updateTree();
+		void updateScroll();
+		void updateLines();
+		void redrawLines();
+
+		void scrollTo(size_t _position);
+		void sendScrollingEvents(size_t _position);
+
+		Node* getLineNode(Widget* _line);
+
+	private:
+		ScrollBar* mWidgetScroll;
+		Widget* mClient;
+
+		typedef std::vector<TreeControlItem*> VectorTreeItemPtr;
+		VectorTreeItemPtr mWidgetLines;
+
+		std::string mSkinLine;
+		int mHeightLine;
+		int mLevelOffset;
+		bool mScrollAlwaysVisible;
+
+		bool mRootVisible;
+		Node* mRoot;
+		Node* mSelection;
+
+		VectorRow mRows;
+		bool mRowsDirty;
+		bool mUpdatingRows;
+		VectorNodePtr mChangedNodes;
+
+		int mRangeIndex;
+		int mTopIndex;
+		int mOffsetTop;
+		size_t mFocusIndex;
+
+		bool mInvalidated;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TREE_CONTROL_H_
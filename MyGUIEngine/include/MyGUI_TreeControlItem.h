@@ -0,0 +1,49 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TREE_CONTROL_ITEM_H_
+#define MYGUI_TREE_CONTROL_ITEM_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Button.h"
+#include "MyGUI_TreeControl.h"
+
+namespace MyGUI
+{
+
+	/** \brief @wpage{TreeControlItem}
+		Line of TreeControl, it is reused for different nodes when tree is scrolled.
+	*/
+	class MYGUI_EXPORT TreeControlItem :
+		public Button
+	{
+		MYGUI_RTTI_DERIVED( TreeControlItem )
+
+	public:
+		TreeControlItem();
+
+		/** Get node shown by this line */
+		TreeControl::Node* getNode() const;
+
+		Button* getButtonExpandCollapse() const;
+		ImageBox* getIcon() const;
+
+	protected:
+		virtual void initialiseOverride();
+		virtual void shutdownOverride();
+
+		void notifyMouseSetFocus(Widget* _sender, Widget* _old);
+		void notifyMouseLostFocus(Widget* _sender, Widget* _new);
+		void notifyMouseWheel(Widget* _sender, int _rel);
+
+	private:
+		Button* mButtonExpandCollapse;
+		ImageBox* mIcon;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TREE_CONTROL_ITEM_H_
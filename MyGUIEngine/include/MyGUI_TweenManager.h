@@ -0,0 +1,174 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TWEEN_MANAGER_H_
+#define MYGUI_TWEEN_MANAGER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Singleton.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_IUnlinkWidget.h"
+#include "MyGUI_Delegate.h"
+
+namespace MyGUI
+{
+
+	typedef size_t TweenHandle;
+	const TweenHandle TWEEN_NONE = 0;
+
+	typedef delegates::CMultiDelegate2<Widget*, TweenHandle> EventHandle_WidgetPtrTweenHandle;
+
+	/** Batched animation of widget alpha, position and coordinate.\n
+		Tracks of each kind are kept in contiguous array and updated in one pass every frame inside
+		WidgetManager::beginUpdate/endUpdate. Tracks are added and removed through handles in constant time.
+		Unlike ControllerManager there are no per frame events, only eventTrackFinished.
+	*/
+	class MYGUI_EXPORT TweenManager :
+		public Singleton<TweenManager>,
+		public IUnlinkWidget
+	{
+	public:
+		enum Function
+		{
+			Linear,
+			/** Speed is increasing */
+			Accelerated,
+			/** Speed is decreasing */
+			Slowed,
+			/** Speed is increasing half time and then decreasing to zero */
+			Inertional
+		};
+
+		TweenManager();
+
+		void initialise();
+		void shutdown();
+
+		/** Animate widget alpha from _from to _to in _time seconds.
+			Previous alpha track of widget is removed.
+		*/
+		TweenHandle addAlpha(Widget* _widget, float _from, float _to, float _time, Function _function = Linear);
+		/** Animate widget position from _from to _to in _time seconds.
+			Previous position and coordinate tracks of widget are removed.
+		*/
+		TweenHandle addPosition(Widget* _widget, const IntPoint& _from, const IntPoint& _to, float _time, Function _function = Linear);
+		/** Animate widget coordinate from _from to _to in _time seconds.
+			Previous position and coordinate tracks of widget are removed.
+		*/
+		TweenHandle addCoord(Widget* _widget, const IntCoord& _from, const IntCoord& _to, float _time, Function _function = Linear);
+
+		/** Stop track, widget is left as is.
+			@return false if track is already finished or removed.
+		*/
+		bool removeTrack(TweenHandle _handle);
+		/** Stop all tracks of widget */
+		void removeAllTracks(Widget* _widget);
+
+		/** Is track still running */
+		bool isTrackActive(TweenHandle _handle) const;
+
+		/** Get number of running tracks */
+		size_t getTrackCount() const;
+
+		/** Update all tracks, called on every frame start while there are tracks */
+		void update(float _time);
+
+		/** Event : Track reached its end value and was removed.\n
+			signature : void method(MyGUI::Widget* _sender, MyGUI::TweenHandle _handle)
+			@param _sender widget of track
+			@param _handle handle of track
+		*/
+		EventHandle_WidgetPtrTweenHandle eventTrackFinished;
+
+	private:
+		enum TrackType
+		{
+			TrackAlpha,
+			TrackPosition,
+			TrackCoord,
+			TrackTypeCount
+		};
+
+		enum
+		{
+			// младшие биты хендла номер слота, старшие поколение слота
+			SlotBits = 20,
+			SlotMask = (1 << SlotBits) - 1
+		};
+
+		struct Slot
+		{
+			uint32 type;
+			uint32 index;
+			uint32 generation;
+			Widget* widget;
+			// список слотов одного виджета, SlotMask если нет
+			uint32 prevWidgetSlot;
+			uint32 nextWidgetSlot;
+		};
+
+		struct AlphaTrack
+		{
+			Widget* widget;
+			float from;
+			float delta;
+			float elapsed;
+			float time;
+			Function function;
+			uint32 slot;
+		};
+
+		struct CoordTrack
+		{
+			Widget* widget;
+			IntCoord from;
+			IntCoord to;
+			float elapsed;
+			float time;
+			Function function;
+			uint32 slot;
+		};
+
+		typedef std::vector<AlphaTrack> VectorAlphaTrack;
+		typedef std::vector<CoordTrack> VectorCoordTrack;
+		typedef std::map<Widget*, uint32> MapWidgetSlot;
+
+	private:
+		virtual void _unlinkWidget(Widget* _widget);
+		void frameEntered(float _time);
+
+		uint32 createSlot(Widget* _widget, TrackType _type, size_t _index);
+		void removeSlot(uint32 _slot);
+		void removeWidgetTracks(Widget* _widget, TrackType _type);
+		void moveTrack(uint32 _type, size_t _from, size_t _to);
+		TweenHandle getHandle(uint32 _slot) const;
+		bool findSlot(TweenHandle _handle, uint32& _slot) const;
+		void updateFrameSubscription();
+
+		TweenHandle addCoordTrack(TrackType _type, Widget* _widget, const IntCoord& _from, const IntCoord& _to, float _time, Function _function);
+
+		static float getFactor(Function _function, float _k);
+
+	private:
+		VectorAlphaTrack mAlphaTracks;
+		VectorCoordTrack mPositionTracks;
+		VectorCoordTrack mCoordTracks;
+
+		std::vector<Slot> mSlots;
+		std::vector<uint32> mFreeSlots;
+		// первый слот каждого анимируемого виджета
+		MapWidgetSlot mWidgetSlots;
+
+		// закончившиеся за кадр треки, события вызываются после обновления
+		std::vector<TweenHandle> mFinished;
+
+		bool mFrameSubscribed;
+		bool mIsInitialise;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TWEEN_MANAGER_H_
@@ -537,6 +537,24 @@ namespace MyGUI
 
 		//////////////////////////////////////////////////////////////////////////
 
+		//!\name Conversion statistics
+		//@{
+		//! number of conversions between internal UTF-16 data and other encodings since last reset
+		struct ConversionStatistics {
+			size_t fromUTF8; //!< assignments from UTF-8 std::string or char array
+			size_t fromWStr; //!< assignments from std::wstring or wchar_t array
+			size_t toUTF8; //!< asUTF8() and asUTF8_c_str() calls
+			size_t toUTF32; //!< asUTF32() and asUTF32_c_str() calls
+			size_t toWStr; //!< asWStr() and asWStr_c_str() calls
+		};
+		//! returns conversion counters, they are counted only in builds with MYGUI_USTRING_STATISTICS defined and are not synchronized between threads
+		static const ConversionStatistics& getConversionStatistics();
+		//! resets all conversion counters to zero
+		static void resetConversionStatistics();
+		//@}
+
+		//////////////////////////////////////////////////////////////////////////
+
 		//!\name Single Character Access
 		//@{
 		//! returns a reference to the element in the string at index \c loc
@@ -957,6 +975,8 @@ namespace MyGUI
 		//template<class ITER_TYPE> friend class _iterator;
 		dstring mData;
 
+		static ConversionStatistics ms_conversionStatistics;
+
 		//! buffer data type identifier
 		enum BufferType {
 			bt_none,
@@ -0,0 +1,112 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_UTF8_ITERATOR_H_
+#define MYGUI_UTF8_ITERATOR_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+
+namespace MyGUI
+{
+
+	/** Forward iterator that decodes UTF-8 string into unicode characters in place, without intermediate buffers.\n
+		Invalid or truncated sequence is returned as its first byte, like UString does.
+	*/
+	class UTF8Iterator
+	{
+	public:
+		UTF8Iterator(const char* _begin, const char* _end) :
+			mCurrent(reinterpret_cast<const unsigned char*>(_begin)),
+			mEnd(reinterpret_cast<const unsigned char*>(_end))
+		{
+		}
+
+		explicit UTF8Iterator(const std::string& _value) :
+			mCurrent(reinterpret_cast<const unsigned char*>(_value.data())),
+			mEnd(reinterpret_cast<const unsigned char*>(_value.data()) + _value.size())
+		{
+		}
+
+		bool isEnd() const
+		{
+			return mCurrent == mEnd;
+		}
+
+		/** Number of bytes left */
+		size_t getRemaining() const
+		{
+			return mEnd - mCurrent;
+		}
+
+		/** Decode next character and move to the one after it */
+		Char getNext()
+		{
+			unsigned char lead = *mCurrent;
+			// большая часть текста в ASCII
+			if (lead < 0x80)
+			{
+				++mCurrent;
+				return lead;
+			}
+
+			size_t length = 0;
+			Char result = 0;
+			if ((lead & 0xE0) == 0xC0)
+			{
+				length = 2;
+				result = lead & 0x1F;
+			}
+			else if ((lead & 0xF0) == 0xE0)
+			{
+				length = 3;
+				result = lead & 0x0F;
+			}
+			else if ((lead & 0xF8) == 0xF0)
+			{
+				length = 4;
+				result = lead & 0x07;
+			}
+			else if ((lead & 0xFC) == 0xF8)
+			{
+				length = 5;
+				result = lead & 0x03;
+			}
+			else if ((lead & 0xFE) == 0xFC)
+			{
+				length = 6;
+				result = lead & 0x01;
+			}
+
+			if (length == 0 || length > getRemaining())
+			{
+				++mCurrent;
+				return lead;
+			}
+
+			for (size_t index = 1; index < length; ++index)
+			{
+				unsigned char next = mCurrent[index];
+				if ((next & 0xC0) != 0x80)
+				{
+					++mCurrent;
+					return lead;
+				}
+				result = (result << 6) | (next & 0x3F);
+			}
+
+			mCurrent += length;
+			return result;
+		}
+
+	private:
+		const unsigned char* mCurrent;
+		const unsigned char* mEnd;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_UTF8_ITERATOR_H_
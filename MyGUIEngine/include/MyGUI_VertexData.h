@@ -30,6 +30,16 @@ namespace MyGUI
 		float u, v;
 	};
 
+	/** Vertex of half size for render systems that support it, see vertex_utility::compactVertexes.
+		Position is normalized int16 in render target coordinates, texture coordinates are normalized uint16, depth is 0.
+	*/
+	struct CompactVertex
+	{
+		int16 x, y;
+		uint32 colour;
+		uint16 u, v;
+	};
+
 	struct VertexQuad
 	{
 		enum Enum
@@ -0,0 +1,151 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_VERTEX_UTILITY_H_
+#define MYGUI_VERTEX_UTILITY_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_VertexData.h"
+#include "MyGUI_RenderTargetInfo.h"
+
+namespace MyGUI
+{
+
+	namespace vertex_utility
+	{
+
+		/** Write quad as VertexQuad::VertexCount vertexes, _rect is already in render target coordinates.
+			Uses SSE2 or NEON when available.
+		*/
+		MYGUI_EXPORT void writeQuad(Vertex* _vertex, const FloatRect& _rect, float _z, const FloatRect& _uv, uint32 _colour);
+
+		/** Name of instruction set used by writeQuad and QuadBatch: "SSE2", "NEON" or "Scalar" */
+		MYGUI_EXPORT const char* getInstructionSet();
+
+		/** Statistics of vertexes passed through packQuads and compactVertexes */
+		struct UploadStatistics
+		{
+			UploadStatistics() :
+				writtenCount(0),
+				uploadedCount(0),
+				packedBufferCount(0),
+				plainBufferCount(0),
+				compactCount(0),
+				compactBufferCount(0)
+			{
+			}
+
+			/** Number of vertexes written by engine, all of them are uploaded without indexes */
+			size_t writtenCount;
+			/** Number of vertexes left after packing */
+			size_t uploadedCount;
+			/** Number of buffers that were packed */
+			size_t packedBufferCount;
+			/** Number of buffers that have other triangles than quads and were left as is */
+			size_t plainBufferCount;
+			/** Number of uploaded vertexes that were converted to CompactVertex, they take half of the size */
+			size_t compactCount;
+			/** Number of buffers that were converted to CompactVertex */
+			size_t compactBufferCount;
+		};
+
+		enum
+		{
+			/** Number of vertexes in quad packed by packQuads */
+			PackedQuadVertexCount = 4,
+			/** Number of indexes in packed quad */
+			PackedQuadIndexCount = 6
+		};
+
+		/** Pack quads written as VertexQuad::VertexCount vertexes into four vertexes LT, RT, LB, RB in place,
+			packed quads are drawn with indexes from writeQuadIndexes.
+			Vertexes are left as is if they are not all such quads (for example PolygonalSkin triangles).
+			@return Number of vertexes after packing, _count if vertexes were left as is.
+		*/
+		MYGUI_EXPORT size_t packQuads(Vertex* _vertex, size_t _count);
+
+		/** Write indexes of _quadCount packed quads: 0, 1, 2, 2, 1, 3 for first quad and so on. */
+		MYGUI_EXPORT void writeQuadIndexes(uint32* _index, size_t _quadCount);
+
+		/** Convert vertexes to CompactVertex.
+			Nothing is written if any vertex does not fit: position out of [-1, 1] (geometry that
+			is partly outside of render target), texture coordinates out of [0, 1] or depth out of [-1, 1].
+			@return true if vertexes were converted.
+		*/
+		MYGUI_EXPORT bool compactVertexes(const Vertex* _source, size_t _count, CompactVertex* _destination);
+
+		/** Get statistics of packQuads and compactVertexes calls */
+		MYGUI_EXPORT const UploadStatistics& getUploadStatistics();
+		/** Reset statistics of packQuads and compactVertexes calls */
+		MYGUI_EXPORT void resetUploadStatistics();
+
+		/** Collects quads in pixels and writes them into vertex buffer in bulk, transforming to render target
+			coordinates several quads at once.
+		*/
+		class MYGUI_EXPORT QuadBatch
+		{
+		public:
+			/**
+				@param _vertex Vertex buffer to write to.
+				@param _info Render target info.
+				@param _left Absolute left of quad coordinates origin.
+				@param _top Absolute top of quad coordinates origin.
+				@param _z Depth of all quads.
+			*/
+			QuadBatch(Vertex* _vertex, const RenderTargetInfo& _info, float _left, float _top, float _z);
+
+			/** Add quad, _rect is in pixels relative to origin */
+			void add(const FloatRect& _rect, const FloatRect& _uv, uint32 _colour)
+			{
+				Quad& quad = mQuads[mCount];
+				quad.rect = _rect;
+				quad.uv = _uv;
+				quad.colour = _colour;
+
+				if (++mCount == QuadCount)
+					flush();
+			}
+
+			/** Write added quads into vertex buffer */
+			void flush();
+
+			/** Get number of written vertexes, call flush first */
+			size_t getVertexCount() const;
+
+		private:
+			struct Quad
+			{
+				FloatRect rect;
+				FloatRect uv;
+				uint32 colour;
+			};
+
+			enum
+			{
+				QuadCount = 64
+			};
+
+		private:
+			Quad mQuads[QuadCount];
+			size_t mCount;
+
+			Vertex* mVertex;
+			size_t mVertexCount;
+
+			// пиксели в координаты рендер таргета: x * scale + offset
+			float mScaleX;
+			float mScaleY;
+			float mOffsetX;
+			float mOffsetY;
+			float mZ;
+		};
+
+	} // namespace vertex_utility
+
+} // namespace MyGUI
+
+#endif // MYGUI_VERTEX_UTILITY_H_
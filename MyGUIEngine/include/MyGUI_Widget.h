@@ -21,6 +21,8 @@
 namespace MyGUI
 {
 
+	class LayerNode;
+
 	typedef delegates::CMultiDelegate3<Widget*, const std::string&, const std::string&> EventHandle_WidgetStringString;
 
 	/** \brief @wpage{Widget}
@@ -279,6 +281,8 @@ namespace MyGUI
 		void _forcePick(Widget* _widget);
 
 		void _initialise(WidgetStyle _style, const IntCoord& _coord, const std::string& _skinName, Widget* _parent, ICroppedRectangle* _croppedParent, const std::string& _name);
+		// скин или шаблон уже найдены по имени
+		void _initialise(WidgetStyle _style, const IntCoord& _coord, ResourceSkin* _skinInfo, ResourceLayout* _templateInfo, Widget* _parent, ICroppedRectangle* _croppedParent, const std::string& _name);
 		void _shutdown();
 
 		// удяляет неудачника
@@ -292,6 +296,15 @@ namespace MyGUI
 
 		Widget* _createSkinWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer = "", const std::string& _name = "");
 
+		// создает виджет по заранее найденным фабрике и скину
+		Widget* _createWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name);
+
+		// примерная память виджета в байтах, без дочерних виджетов
+		size_t _getMemoryUsage() const;
+
+		// применяет свойство, ключ которого уже проверен BackwardCompatibility::isPropertyCurrent
+		void _setPropertyChecked(const std::string& _key, const std::string& _value);
+
 		// сброс всех данных контейнера, тултипы и все остальное
 		virtual void _resetContainer(bool _update);
 
@@ -300,6 +313,14 @@ namespace MyGUI
 		// перерисовывает детей
 		void _updateChilds();
 
+		// применяет изменения, отложенные WidgetManager::beginUpdate
+		void _commitDeferredUpdate();
+		// вызывается после применения изменений всех виджетов
+		void _resetDeferredUpdate();
+
+		// виджет полностью вне вьюпорта отца, его иерархия скрыта и не обновляется
+		bool _isCulled() const;
+
 	protected:
 		// все создание только через фабрику
 		virtual ~Widget();
@@ -311,6 +332,7 @@ namespace MyGUI
 
 		// создает виджет
 		Widget* baseCreateWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name, bool _template);
+		Widget* baseCreateWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name, bool _template);
 
 		// удаляет всех детей
 		void _destroyAllChildWidget();
@@ -323,6 +345,7 @@ namespace MyGUI
 		// наследуемся он LayerInfo
 		virtual ILayerItem* getLayerItemByPoint(int _left, int _top) const;
 		virtual const IntCoord& getLayerItemCoord() const;
+		virtual IntPoint getLayerItemOrigin() const;
 
 		template <typename T>
 		void assignWidget(T*& _widget, const std::string& _name)
@@ -358,6 +381,10 @@ namespace MyGUI
 
 		void _updateAlpha();
 		void _updateAbsolutePoint();
+		// сдвигает абсолютные координаты детей без пересчета сабскинов
+		void _shiftAbsolutePoint();
+		// нод, который можно сдвинуть целиком, если мы в нем единственный рутовый виджет
+		LayerNode* _getOriginLayerNode() const;
 
 		// для внутреннего использования
 		void _updateVisible();
@@ -381,7 +408,19 @@ namespace MyGUI
 
 		void addWidget(Widget* _widget);
 
+		bool deferUpdate(unsigned char _flag);
+		IntCoord takeDeferredCoord();
+
 	private:
+		enum DeferredFlag
+		{
+			DeferredCoord = 1 << 0,
+			DeferredAlpha = 1 << 1,
+			DeferredVisible = 1 << 2,
+			// координаты заданы явно, отец выравнивает их только от размера на момент установки
+			DeferredParentSize = 1 << 3
+		};
+
 		// клиентская зона окна
 		// если виджет имеет пользовательские окна не в себе
 		// то обязательно проинициализировать Client
@@ -416,6 +455,18 @@ namespace MyGUI
 		Align mAlign;
 		bool mVisible;
 		int mDepth;
+
+		// изменения, отложенные до WidgetManager::endUpdate
+		unsigned char mDeferredUpdate;
+		// координаты до первого отложенного изменения
+		IntCoord mDeferredCoord;
+		// размер отца при последней явной установке координат
+		IntSize mDeferredParentSize;
+		// позиция в списке отложенных виджетов менеджера
+		size_t mDeferredIndex;
+
+		// виджет и вся его иерархия уже скрыты как вышедшие за границу
+		bool mCulled;
 	};
 
 } // namespace MyGUI
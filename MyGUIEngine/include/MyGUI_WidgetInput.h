@@ -16,6 +16,7 @@
 #include "MyGUI_MaskPickInfo.h"
 #include "MyGUI_Delegate.h"
 #include "MyGUI_EventPair.h"
+#include "MyGUI_StringId.h"
 
 namespace MyGUI
 {
@@ -227,6 +228,8 @@ namespace MyGUI
 		EventHandle_WidgetToolTip eventToolTip;
 
 		/*internal:*/
+		StringId _getPointerId() const;
+
 		void _riseMouseLostFocus(Widget* _new);
 		void _riseMouseSetFocus(Widget* _old);
 		void _riseMouseDrag(int _left, int _top, MouseButton _id);
@@ -264,7 +267,7 @@ namespace MyGUI
 		virtual void onKeyChangeRootFocus(bool _focus);
 
 	private:
-		std::string mPointer;
+		StringId mPointer;
 		MaskPickInfo mOwnMaskPickInfo;
 
 		bool mNeedToolTip;
@@ -12,6 +12,7 @@
 #include "MyGUI_IUnlinkWidget.h"
 #include "MyGUI_ICroppedRectangle.h"
 #include "MyGUI_Widget.h"
+#include "MyGUI_ResolvedWidgetType.h"
 #include <set>
 #include "MyGUI_BackwardCompatibility.h"
 
@@ -22,12 +23,46 @@ namespace MyGUI
 		public MemberObsolete<WidgetManager>
 	{
 	public:
+		/** Memory used by widgets, see getMemoryReport */
+		struct MemoryReport
+		{
+			struct Item
+			{
+				Item() :
+					count(0),
+					bytes(0)
+				{
+				}
+
+				/** Number of widgets */
+				size_t count;
+				/** Estimated bytes of widget objects, their sub skins, children lists, names and user data */
+				size_t bytes;
+			};
+
+			typedef std::map<std::string, Item> MapItem;
+
+			/** Widgets by type name */
+			MapItem types;
+			/** Widgets by layer name, widgets that are not attached to layer are in "" */
+			MapItem layers;
+			/** All widgets */
+			Item total;
+		};
+
 		WidgetManager();
 
 		void initialise();
 		void shutdown();
 
 		Widget* createWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Widget* _parent, ICroppedRectangle* _cropeedParent, const std::string& _name);
+		/** Create widget with factory and skin resolved by resolveWidgetType */
+		Widget* createWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Widget* _parent, ICroppedRectangle* _cropeedParent, const std::string& _name);
+
+		/** Find widget factory and skin (or layout template) by names.
+			Throw exception if factory not found, missing skin is replaced in the same way as on widget creation.
+		*/
+		void resolveWidgetType(const std::string& _type, const std::string& _skin, ResolvedWidgetType& _result);
 
 		/** Destroy _widget */
 		void destroyWidget(Widget* _widget);
@@ -46,15 +81,45 @@ namespace MyGUI
 		/** Check if factory with specified widget type exist */
 		bool isFactoryExist(const std::string& _type);
 
+		/** Begin batched widget update.
+			Until matching endUpdate call coordinate, alpha and visibility changes of widgets are only stored,
+			and each changed widget updates its skin and children once when update ends.
+			Calls can be nested, changes are applied when outermost update ends.
+			@note Widgets creation inside update applies all previously deferred changes first.
+		*/
+		void beginUpdate();
+		/** End batched widget update and apply deferred changes if this is outermost update */
+		void endUpdate();
+		/** Is batched widget update active */
+		bool isUpdating() const;
+
+		/** Collect memory used by all widgets including skin widgets.
+			Size of widget is estimated from its type, sub skins, children lists, name and user data,
+			resources shared between widgets (skins, fonts, textures) are not included.
+		*/
+		void getMemoryReport(MemoryReport& _report) const;
+		/** Write memory report to log */
+		void logMemoryReport() const;
+
 		/*internal:*/
 		void _deleteWidget(Widget* _widget);
 		void _deleteDelayWidgets();
 
+		// возвращает позицию виджета в списке для _removeDeferredWidget
+		size_t _addDeferredWidget(Widget* _widget);
+		void _removeDeferredWidget(Widget* _widget, size_t _index);
+		// применяет отложенные изменения и приостанавливает отложенное обновление
+		size_t _pauseUpdate();
+		void _resumeUpdate(size_t _depth);
+
 		const std::string& getCategoryName() const;
 
 	private:
 		void notifyEventFrameStart(float _time);
 
+		void commitDeferredWidgets();
+		void addMemoryReport(Widget* _widget, const std::string& _layer, MemoryReport& _report) const;
+
 	private:
 		bool mIsInitialise;
 		std::string mCategoryName;
@@ -64,6 +129,11 @@ namespace MyGUI
 
 		// список виджетов для удаления
 		VectorWidgetPtr mDestroyWidgets;
+
+		// вложенность beginUpdate
+		size_t mUpdateDepth;
+		// виджеты с отложенными изменениями
+		VectorWidgetPtr mDeferredWidgets;
 	};
 
 } // namespace MyGUI
@@ -9,6 +9,7 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_Any.h"
+#include "MyGUI_StringId.h"
 
 namespace MyGUI
 {
@@ -18,15 +19,26 @@ namespace MyGUI
 	{
 	public:
 		UserData();
+		UserData(const UserData& _other);
 		virtual ~UserData();
 
+		UserData& operator = (const UserData& _other);
+
 		/** Set user string */
 		void setUserString(const std::string& _key, const std::string& _value);
 
 		/** Get user string or "" if not found */
 		const std::string& getUserString(const std::string& _key) const;
 
-		/** Get map of all user strings */
+		/** Set user string with interned key, faster than string version when key is reused */
+		void setUserString(StringId _key, const std::string& _value);
+
+		/** Get user string or "" if not found */
+		const std::string& getUserString(StringId _key) const;
+
+		/** Get map of all user strings.
+			@note Map is built on demand and is valid until user strings are changed.
+		*/
 		const MapString& getUserStrings() const;
 
 		/** Delete user string */
@@ -45,12 +57,16 @@ namespace MyGUI
 		template <typename ValueType>
 		ValueType* getUserData(bool _throw = true) const
 		{
-			return mUserData.castType<ValueType>(_throw);
+			return _getUserDataAny().castType<ValueType>(_throw);
 		}
 
 		/*internal:*/
 		void _setInternalData(Any _data);
 
+		const Any& _getUserDataAny() const;
+		/** Get memory used by user strings and user data in bytes */
+		size_t _getUserDataMemoryUsage() const;
+
 		template <typename ValueType>
 		ValueType* _getInternalData(bool _throw = true) const
 		{
@@ -58,9 +74,32 @@ namespace MyGUI
 		}
 
 	private:
-		// пользовательские данные
-		MapString mMapUserString;
-		Any mUserData;
+		typedef std::pair<StringId, std::string> PairUserString;
+		typedef std::vector<PairUserString> VectorUserString;
+
+		struct Storage
+		{
+			Storage() :
+				userStringsMap(nullptr)
+			{
+			}
+
+			// пользовательские данные, отсортированы по ключу
+			VectorUserString userStrings;
+			// строится только для getUserStrings
+			MapString* userStringsMap;
+			Any userData;
+		};
+
+		Storage& getStorage();
+		VectorUserString::iterator findUserString(StringId _key);
+		VectorUserString::const_iterator findUserString(StringId _key) const;
+		void resetUserStringsMap() const;
+		void deleteStorage();
+
+	private:
+		// создается при первой пользовательской строке или данных, у большинства виджетов их нет
+		Storage* mStorage;
 
 		// для внутренниего использования
 		Any mInternalData;
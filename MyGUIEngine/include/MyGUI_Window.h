@@ -48,6 +48,8 @@ namespace MyGUI
 
 		/** Set window caption */
 		virtual void setCaption(const UString& _value);
+		/** @copydoc TextBox::setCaptionUTF8(const std::string& _value) */
+		virtual void setCaptionUTF8(const std::string& _value);
 		/** Get window caption */
 		virtual const UString& getCaption();
 
@@ -0,0 +1,320 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_AsyncLogListener.h"
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#	include <windows.h>
+#else
+#	include <pthread.h>
+#	include <sys/time.h>
+#endif
+
+namespace MyGUI
+{
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+
+	namespace
+	{
+		DWORD WINAPI asyncLogThreadEntry(LPVOID _data)
+		{
+			static_cast<AsyncLogListener*>(_data)->_threadMain();
+			return 0;
+		}
+	}
+
+	struct AsyncLogThread
+	{
+		AsyncLogThread() :
+			mHandle(nullptr),
+			mStop(false)
+		{
+			InitializeCriticalSection(&mQueueLock);
+			InitializeCriticalSection(&mWriteLock);
+			mWake = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		}
+
+		~AsyncLogThread()
+		{
+			CloseHandle(mWake);
+			DeleteCriticalSection(&mWriteLock);
+			DeleteCriticalSection(&mQueueLock);
+		}
+
+		void start(AsyncLogListener* _owner)
+		{
+			mHandle = CreateThread(nullptr, 0, asyncLogThreadEntry, _owner, 0, nullptr);
+		}
+
+		void join()
+		{
+			if (mHandle != nullptr)
+			{
+				WaitForSingleObject(mHandle, INFINITE);
+				CloseHandle(mHandle);
+				mHandle = nullptr;
+			}
+		}
+
+		void lockQueue() { EnterCriticalSection(&mQueueLock); }
+		void unlockQueue() { LeaveCriticalSection(&mQueueLock); }
+		void lockWrite() { EnterCriticalSection(&mWriteLock); }
+		void unlockWrite() { LeaveCriticalSection(&mWriteLock); }
+
+		void wake(bool _stop)
+		{
+			if (_stop)
+			{
+				lockQueue();
+				mStop = true;
+				unlockQueue();
+			}
+			SetEvent(mWake);
+		}
+
+		// ждёт пробуждения или таймаута, возвращает true если поток должен завершиться
+		bool wait(unsigned int _milliseconds)
+		{
+			WaitForSingleObject(mWake, _milliseconds);
+			lockQueue();
+			bool result = mStop;
+			unlockQueue();
+			return result;
+		}
+
+		HANDLE mHandle;
+		HANDLE mWake;
+		CRITICAL_SECTION mQueueLock;
+		CRITICAL_SECTION mWriteLock;
+		bool mStop;
+	};
+
+#else
+
+	namespace
+	{
+		void* asyncLogThreadEntry(void* _data)
+		{
+			static_cast<AsyncLogListener*>(_data)->_threadMain();
+			return nullptr;
+		}
+	}
+
+	struct AsyncLogThread
+	{
+		AsyncLogThread() :
+			mStarted(false),
+			mStop(false),
+			mWakeRequested(false)
+		{
+			pthread_mutex_init(&mQueueLock, nullptr);
+			pthread_mutex_init(&mWriteLock, nullptr);
+			pthread_cond_init(&mWake, nullptr);
+		}
+
+		~AsyncLogThread()
+		{
+			pthread_cond_destroy(&mWake);
+			pthread_mutex_destroy(&mWriteLock);
+			pthread_mutex_destroy(&mQueueLock);
+		}
+
+		void start(AsyncLogListener* _owner)
+		{
+			mStarted = pthread_create(&mHandle, nullptr, asyncLogThreadEntry, _owner) == 0;
+		}
+
+		void join()
+		{
+			if (mStarted)
+			{
+				pthread_join(mHandle, nullptr);
+				mStarted = false;
+			}
+		}
+
+		void lockQueue() { pthread_mutex_lock(&mQueueLock); }
+		void unlockQueue() { pthread_mutex_unlock(&mQueueLock); }
+		void lockWrite() { pthread_mutex_lock(&mWriteLock); }
+		void unlockWrite() { pthread_mutex_unlock(&mWriteLock); }
+
+		void wake(bool _stop)
+		{
+			lockQueue();
+			if (_stop)
+				mStop = true;
+			mWakeRequested = true;
+			pthread_cond_signal(&mWake);
+			unlockQueue();
+		}
+
+		// ждёт пробуждения или таймаута, возвращает true если поток должен завершиться
+		bool wait(unsigned int _milliseconds)
+		{
+			struct timeval now;
+			gettimeofday(&now, nullptr);
+			long long nanoseconds = (long long)now.tv_usec * 1000 + (long long)_milliseconds * 1000000;
+
+			struct timespec deadline;
+			deadline.tv_sec = now.tv_sec + (time_t)(nanoseconds / 1000000000);
+			deadline.tv_nsec = (long)(nanoseconds % 1000000000);
+
+			lockQueue();
+			if (!mWakeRequested && !mStop)
+				pthread_cond_timedwait(&mWake, &mQueueLock, &deadline);
+			mWakeRequested = false;
+			bool result = mStop;
+			unlockQueue();
+			return result;
+		}
+
+		pthread_t mHandle;
+		pthread_mutex_t mQueueLock;
+		pthread_mutex_t mWriteLock;
+		pthread_cond_t mWake;
+		bool mStarted;
+		bool mStop;
+		bool mWakeRequested;
+	};
+
+#endif
+
+	AsyncLogListener::AsyncLogListener() :
+		mThread(nullptr),
+		mWriteInterval(100)
+	{
+	}
+
+	AsyncLogListener::~AsyncLogListener()
+	{
+		close();
+	}
+
+	void AsyncLogListener::addLogListener(ILogListener* _listener)
+	{
+		mListeners.push_back(_listener);
+	}
+
+	void AsyncLogListener::open()
+	{
+		if (mThread != nullptr)
+			return;
+
+		for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+			(*listener)->open();
+
+		mThread = new AsyncLogThread();
+		mThread->start(this);
+	}
+
+	void AsyncLogListener::close()
+	{
+		if (mThread == nullptr)
+			return;
+
+		// поток дописывает очередь перед выходом
+		mThread->wake(true);
+		mThread->join();
+
+		writeQueue();
+
+		delete mThread;
+		mThread = nullptr;
+
+		for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+			(*listener)->close();
+	}
+
+	void AsyncLogListener::flush()
+	{
+		if (mThread == nullptr)
+		{
+			for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+				(*listener)->flush();
+			return;
+		}
+
+		mThread->lockWrite();
+		writeQueue();
+		mThread->unlockWrite();
+	}
+
+	void AsyncLogListener::log(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line)
+	{
+		if (mThread == nullptr)
+		{
+			for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+				(*listener)->log(_section, _level, _time, _message, _file, _line);
+			return;
+		}
+
+		mThread->lockQueue();
+		mQueue.push_back(LogRecord());
+		LogRecord& record = mQueue.back();
+		record.section = _section;
+		record.level = _level;
+		record.time = *_time;
+		record.message = _message;
+		record.file = _file;
+		record.line = _line;
+		mThread->unlockQueue();
+
+		// после критического сообщения обычно летит исключение, поэтому пишем сразу
+		if (_level >= LogLevel::Critical)
+			flush();
+		else if (_level >= LogLevel::Error)
+			mThread->wake(false);
+	}
+
+	void AsyncLogListener::setWriteInterval(unsigned int _value)
+	{
+		mWriteInterval = _value;
+	}
+
+	unsigned int AsyncLogListener::getWriteInterval() const
+	{
+		return mWriteInterval;
+	}
+
+	void AsyncLogListener::_threadMain()
+	{
+		while (true)
+		{
+			bool stop = mThread->wait(mWriteInterval);
+
+			mThread->lockWrite();
+			writeQueue();
+			mThread->unlockWrite();
+
+			if (stop)
+				break;
+		}
+	}
+
+	void AsyncLogListener::writeQueue()
+	{
+		mThread->lockQueue();
+		mWriting.swap(mQueue);
+		mThread->unlockQueue();
+
+		if (mWriting.empty())
+			return;
+
+		for (VectorLogRecord::const_iterator record = mWriting.begin(); record != mWriting.end(); ++record)
+		{
+			for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+				(*listener)->log(record->section, record->level, &record->time, record->message, record->file, record->line);
+		}
+
+		for (VectorLogListeners::iterator listener = mListeners.begin(); listener != mListeners.end(); ++listener)
+			(*listener)->flush();
+
+		mWriting.clear();
+	}
+
+} // namespace MyGUI
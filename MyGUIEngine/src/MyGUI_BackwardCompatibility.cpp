@@ -1158,6 +1158,24 @@ namespace MyGUI
 		return true;
 	}
 
+	bool BackwardCompatibility::isPropertyCurrent(const std::string& _key)
+	{
+		//     Widget::setProperty
+		if (_key.find('_') != std::string::npos)
+			return false;
+
+#ifndef MYGUI_DONT_USE_OBSOLETE
+		if (mPropertyIgnore.find(_key) != mPropertyIgnore.end())
+			return false;
+		if (mPropertyRename.find(_key) != mPropertyRename.end())
+			return false;
+		if (_key == "ImageRect" || _key == "StartPoint")
+			return false;
+#endif // MYGUI_DONT_USE_OBSOLETE
+
+		return true;
+	}
+
 	void BackwardCompatibility::initialise()
 	{
 #ifndef MYGUI_DONT_USE_OBSOLETE
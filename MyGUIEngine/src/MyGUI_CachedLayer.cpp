@@ -0,0 +1,176 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_CachedLayer.h"
+#include "MyGUI_LayerNode.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_IRenderTarget.h"
+#include "MyGUI_VertexData.h"
+
+namespace MyGUI
+{
+
+	CachedLayer::CachedLayer() :
+		mTexture(nullptr),
+		mVertexBuffer(nullptr),
+		mCacheEnabled(true),
+		mCacheOutOfDate(true),
+		mCacheFailed(false),
+		mCacheUpdateCount(0)
+	{
+	}
+
+	CachedLayer::~CachedLayer()
+	{
+		destroyCache();
+	}
+
+	void CachedLayer::deserialization(xml::ElementPtr _node, Version _version)
+	{
+		Base::deserialization(_node, _version);
+
+		MyGUI::xml::ElementEnumerator propert = _node->getElementEnumerator();
+		while (propert.next("Property"))
+		{
+			const std::string& key = propert->findAttribute("key");
+			const std::string& value = propert->findAttribute("value");
+			if (key == "Cache")
+				setCacheEnabled(utility::parseValue<bool>(value));
+		}
+	}
+
+	void CachedLayer::renderToTarget(IRenderTarget* _target, bool _update)
+	{
+		if (!mCacheEnabled || (mTexture == nullptr && !createCache()))
+		{
+			Base::renderToTarget(_target, _update);
+			return;
+		}
+
+		updateCache(_update);
+		drawCache(_target);
+	}
+
+	void CachedLayer::resizeView(const IntSize& _viewSize)
+	{
+		Base::resizeView(_viewSize);
+
+		// текстура пересоздастся при следующем рендере
+		destroyCache();
+		mCacheFailed = false;
+	}
+
+	void CachedLayer::setCacheEnabled(bool _value)
+	{
+		if (mCacheEnabled == _value)
+			return;
+
+		mCacheEnabled = _value;
+		if (!mCacheEnabled)
+			destroyCache();
+	}
+
+	bool CachedLayer::getCacheEnabled() const
+	{
+		return mCacheEnabled;
+	}
+
+	void CachedLayer::invalidateCache()
+	{
+		mCacheOutOfDate = true;
+	}
+
+	size_t CachedLayer::getCacheUpdateCount() const
+	{
+		return mCacheUpdateCount;
+	}
+
+	bool CachedLayer::createCache()
+	{
+		if (mCacheFailed || mViewSize.width <= 0 || mViewSize.height <= 0)
+			return false;
+
+		// в режиме снимков кадра рендерить в текстуру из потока UI нельзя
+		RenderManager& render = RenderManager::getInstance();
+		if (render.getFrameSnapshotMode())
+			return false;
+
+		if (render.isFormatSupported(PixelFormat::R8G8B8A8, TextureUsage::RenderTarget))
+		{
+			mTexture = render.createTexture(utility::toString((size_t)this, getClassTypeName()));
+			if (mTexture != nullptr)
+			{
+				mTexture->createManual(mViewSize.width, mViewSize.height, TextureUsage::RenderTarget, PixelFormat::R8G8B8A8);
+				if (mTexture->getRenderTarget() != nullptr)
+					mVertexBuffer = render.createVertexBuffer();
+			}
+		}
+
+		if (mVertexBuffer == nullptr)
+		{
+			// рендер систем не умеет рендерить в текстуру, больше не пытаемся
+			destroyCache();
+			mCacheFailed = true;
+			return false;
+		}
+
+		mVertexBuffer->setVertexCount(VertexQuad::VertexCount);
+		mCacheOutOfDate = true;
+		return true;
+	}
+
+	void CachedLayer::destroyCache()
+	{
+		RenderManager& render = RenderManager::getInstance();
+		if (mVertexBuffer != nullptr)
+		{
+			render.destroyVertexBuffer(mVertexBuffer);
+			mVertexBuffer = nullptr;
+		}
+		if (mTexture != nullptr)
+		{
+			render.destroyTexture(mTexture);
+			mTexture = nullptr;
+		}
+		mCacheOutOfDate = true;
+	}
+
+	void CachedLayer::updateCache(bool _update)
+	{
+		if (!mCacheOutOfDate && !mOutOfDate && !_update && !isOutOfDate())
+			return;
+
+		IRenderTarget* target = mTexture->getRenderTarget();
+		target->begin();
+
+		for (VectorILayerNode::iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
+			(*iter)->renderToTarget(target, _update);
+
+		target->end();
+
+		mOutOfDate = false;
+		mCacheOutOfDate = false;
+		mCacheUpdateCount ++;
+	}
+
+	void CachedLayer::drawCache(IRenderTarget* _target)
+	{
+		const RenderTargetInfo& info = _target->getInfo();
+
+		float vertex_left = ((info.pixScaleX * (float)(-info.leftOffset) + info.hOffset) * 2) - 1;
+		float vertex_right = vertex_left + (info.pixScaleX * (float)mViewSize.width * 2);
+		float vertex_top = -(((info.pixScaleY * (float)(-info.topOffset) + info.vOffset) * 2) - 1);
+		float vertex_bottom = vertex_top - (info.pixScaleY * (float)mViewSize.height * 2);
+
+		VertexQuad* quad = reinterpret_cast<VertexQuad*>(mVertexBuffer->lock());
+		quad->set(vertex_left, vertex_top, vertex_right, vertex_bottom, 0, 0, 0, 1, 1, 0xFFFFFFFF);
+		mVertexBuffer->unlock();
+
+		_target->doRender(mVertexBuffer, mTexture, VertexQuad::VertexCount);
+	}
+
+} // namespace MyGUI
@@ -20,7 +20,8 @@ namespace MyGUI
 		mTexData( 0 ),
 		mTexManaged( true ),
 		mFrameAdvise( false ),
-		mInvalidateData(false)
+		mInvalidateData(false),
+		mStagingLocked(false)
 	{
 		mGenTexName = utility::toString((size_t)this, "_Canvas");
 	}
@@ -48,11 +49,17 @@ namespace MyGUI
 
 		destroyTexture();
 
-		mTexture = RenderManager::getInstance().createTexture(mGenTexName);
+		// в режиме снимков кадра старая текстура живет, пока ее рисует поток рендера
+		RenderManager& render = RenderManager::getInstance();
+		for (size_t index = 1; render.getTexture(mGenTexName) != nullptr; ++index)
+			mGenTexName = utility::toString((size_t)this, "_Canvas_", index);
+
+		mTexture = render.createTexture(mGenTexName);
 		mTexture->setInvalidateListener(this);
 		mTexture->createManual( width, height, _usage, _format );
 
 		mTexManaged = true;
+		mDirtyRect.clear();
 
 		_setTextureName( mGenTexName );
 		correctUV();
@@ -168,8 +175,9 @@ namespace MyGUI
 				eventPreTextureChanges( this );
 			}
 
-			RenderManager::getInstance().destroyTexture( mTexture );
+			RenderManager::getInstance()._destroyTextureDeferred( mTexture );
 			mTexture = nullptr;
+			mStagingLocked = false;
 		}
 
 	}
@@ -194,16 +202,72 @@ namespace MyGUI
 
 	void* Canvas::lock(TextureUsage _usage)
 	{
-		void* data = mTexture->lock(_usage);
+		void* data = nullptr;
+
+		// текстуру может рисовать поток рендера, пишем в копию и отдаем ее в момент синхронизации кадров
+		if (_usage == TextureUsage::Write && RenderManager::getInstance()._isTexturePinned(mTexture))
+		{
+			mStagingRect = mDirtyRect.empty() ? IntRect(0, 0, getTextureRealWidth(), getTextureRealHeight()) : mDirtyRect;
+			mStagingData.resize((size_t)getTextureRealWidth() * (size_t)getTextureRealHeight() * mTexture->getNumElemBytes());
+			mStagingLocked = true;
+			mDirtyRect.clear();
+
+			mTexData = &mStagingData[0];
+			return mTexData;
+		}
+
+		// при записи части текстуры грузим в видеопамять только измененную область
+		if (_usage == TextureUsage::Write && !mDirtyRect.empty())
+			data = mTexture->lockRegion(mDirtyRect);
+		else
+			data = mTexture->lock(_usage);
+		mDirtyRect.clear();
 
 		mTexData = reinterpret_cast< uint8* >( data );
 
 		return data;
 	}
 
+	void* Canvas::lock(const IntRect& _rect)
+	{
+		markDirty(_rect);
+		return lock(TextureUsage::Write);
+	}
+
+	void Canvas::markDirty(const IntRect& _rect)
+	{
+		IntRect rect(
+			std::max(0, _rect.left),
+			std::max(0, _rect.top),
+			std::min(getTextureRealWidth(), _rect.right),
+			std::min(getTextureRealHeight(), _rect.bottom));
+		if (rect.width() <= 0 || rect.height() <= 0)
+			return;
+
+		if (mDirtyRect.empty())
+		{
+			mDirtyRect = rect;
+		}
+		else
+		{
+			mDirtyRect.left = std::min(mDirtyRect.left, rect.left);
+			mDirtyRect.top = std::min(mDirtyRect.top, rect.top);
+			mDirtyRect.right = std::max(mDirtyRect.right, rect.right);
+			mDirtyRect.bottom = std::max(mDirtyRect.bottom, rect.bottom);
+		}
+	}
+
 	void Canvas::unlock()
 	{
-		mTexture->unlock();
+		if (mStagingLocked)
+		{
+			mStagingLocked = false;
+			RenderManager::getInstance()._writeTextureDeferred(mTexture, mStagingRect, &mStagingData[0]);
+		}
+		else
+		{
+			mTexture->unlock();
+		}
 	}
 
 	bool Canvas::isTextureSrcSize() const
@@ -273,7 +337,7 @@ namespace MyGUI
 
 	bool Canvas::isLocked() const
 	{
-		return mTexture->isLocked();
+		return mStagingLocked || mTexture->isLocked();
 	}
 
 	int Canvas::getTextureRealWidth() const
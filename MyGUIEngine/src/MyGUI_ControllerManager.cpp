@@ -67,6 +67,7 @@ namespace MyGUI
 			delete (*iter).second;
 		}
 		mListItem.clear();
+		mWidgetItems.clear();
 	}
 
 	ControllerItem* ControllerManager::createItem(const std::string& _type)
@@ -84,31 +85,32 @@ namespace MyGUI
 		// подготавливаем
 		_item->prepareItem(_widget);
 
-		for (ListControllerItem::iterator iter = mListItem.begin(); iter != mListItem.end(); ++iter)
+		// ищем только среди контроллеров этого виджета, а не по всему списку
+		std::pair<MapWidgetItem::iterator, MapWidgetItem::iterator> range = mWidgetItems.equal_range(_widget);
+		for (MapWidgetItem::iterator item = range.first; item != range.second; ++item)
 		{
+			ListControllerItem::iterator iter = item->second;
 			// такой уже в списке есть
-			if ((*iter).first == _widget)
+			if ((*iter).second->getTypeName() == _item->getTypeName())
 			{
-				if ((*iter).second->getTypeName() == _item->getTypeName())
-				{
-					delete (*iter).second;
-					(*iter).second = _item;
-					return;
-				}
+				delete (*iter).second;
+				(*iter).second = _item;
+				return;
 			}
 		}
 
 		// вставляем в самый конец
 		mListItem.push_back(PairControllerItem(_widget, _item));
+		mWidgetItems.insert(range.second, MapWidgetItem::value_type(_widget, --mListItem.end()));
 	}
 
 	void ControllerManager::removeItem(Widget* _widget)
 	{
 		// не удаляем из списка, а обнуляем, в цикле он будет удален
-		for (ListControllerItem::iterator iter = mListItem.begin(); iter != mListItem.end(); ++iter)
-		{
-			if ((*iter).first == _widget) (*iter).first = nullptr;
-		}
+		std::pair<MapWidgetItem::iterator, MapWidgetItem::iterator> range = mWidgetItems.equal_range(_widget);
+		for (MapWidgetItem::iterator item = range.first; item != range.second; ++item)
+			(*item->second).first = nullptr;
+		mWidgetItems.erase(range.first, range.second);
 	}
 
 	void ControllerManager::_unlinkWidget(Widget* _widget)
@@ -134,6 +136,20 @@ namespace MyGUI
 				continue;
 			}
 
+			// контроллер мог удалить виджет или сам себя в событии
+			if (nullptr != (*iter).first)
+			{
+				std::pair<MapWidgetItem::iterator, MapWidgetItem::iterator> range = mWidgetItems.equal_range((*iter).first);
+				for (MapWidgetItem::iterator item = range.first; item != range.second; ++item)
+				{
+					if (item->second == iter)
+					{
+						mWidgetItems.erase(item);
+						break;
+					}
+				}
+			}
+
 			// на следующей итерации виджет вылетит из списка
 			(*iter).first = nullptr;
 		}
@@ -0,0 +1,103 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_DrawList.h"
+
+namespace MyGUI
+{
+
+	DrawList::DrawList() :
+		mTarget(nullptr),
+		mCurrentLayer(nullptr)
+	{
+	}
+
+	DrawList::~DrawList()
+	{
+	}
+
+	void DrawList::setTarget(IRenderTarget* _target)
+	{
+		mTarget = _target;
+	}
+
+	IRenderTarget* DrawList::getTarget() const
+	{
+		return mTarget;
+	}
+
+	void DrawList::setCurrentLayer(ILayer* _layer)
+	{
+		mCurrentLayer = _layer;
+	}
+
+	ILayer* DrawList::getCurrentLayer() const
+	{
+		return mCurrentLayer;
+	}
+
+	void DrawList::addCommand(const DrawCommand& _command)
+	{
+		mCommands.push_back(_command);
+	}
+
+	void DrawList::clear()
+	{
+		mCommands.clear();
+	}
+
+	size_t DrawList::getCommandCount() const
+	{
+		return mCommands.size();
+	}
+
+	const DrawCommand& DrawList::getCommandAt(size_t _index) const
+	{
+		MYGUI_ASSERT_RANGE(_index, mCommands.size(), "DrawList::getCommandAt");
+		return mCommands[_index];
+	}
+
+	VectorDrawCommand& DrawList::getCommands()
+	{
+		return mCommands;
+	}
+
+	const VectorDrawCommand& DrawList::getCommands() const
+	{
+		return mCommands;
+	}
+
+	void DrawList::submit(IRenderTarget* _target) const
+	{
+		for (VectorDrawCommand::const_iterator iter = mCommands.begin(); iter != mCommands.end(); ++iter)
+			_target->doRender((*iter).buffer, (*iter).texture, (*iter).count);
+	}
+
+	void DrawList::begin()
+	{
+	}
+
+	void DrawList::end()
+	{
+	}
+
+	void DrawList::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
+	{
+		if (_buffer == nullptr || _count == 0)
+			return;
+
+		mCommands.push_back(DrawCommand(_buffer, _count, _texture, mCurrentLayer));
+	}
+
+	const RenderTargetInfo& DrawList::getInfo()
+	{
+		if (mTarget != nullptr)
+			return mTarget->getInfo();
+		return mInfo;
+	}
+
+} // namespace MyGUI
@@ -1553,6 +1553,11 @@ namespace MyGUI
 		setText(_value, false);
 	}
 
+	void EditBox::setCaptionUTF8(const std::string& _value)
+	{
+		setCaption(UString(_value));
+	}
+
 	const UString& EditBox::getCaption()
 	{
 		return getRealString();
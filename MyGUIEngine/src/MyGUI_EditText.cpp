@@ -28,6 +28,8 @@ namespace MyGUI
 		mInverseColourNative(0x00000000),
 		mCurrentAlphaNative(0xFF000000),
 		mShadowColourNative(0x00000000),
+		mUTF8Caption(false),
+		mCaptionOutDate(false),
 		mTextOutDate(false),
 		mTextAlign(Align::Default),
 		mColour(Colour::White),
@@ -188,6 +190,24 @@ namespace MyGUI
 	void EditText::setCaption(const UString& _value)
 	{
 		mCaption = _value;
+		mCaptionUTF8.clear();
+		mUTF8Caption = false;
+		mCaptionOutDate = false;
+		mTextOutDate = true;
+
+		checkVertexSize();
+
+		if (nullptr != mNode)
+			mNode->outOfDate(mRenderItem);
+	}
+
+	void EditText::setCaptionUTF8(const std::string& _value)
+	{
+		// текст раскладывается прямо из UTF-8, UString нужен только для getCaption
+		mCaptionUTF8 = _value;
+		mCaption.clear();
+		mUTF8Caption = true;
+		mCaptionOutDate = true;
 		mTextOutDate = true;
 
 		checkVertexSize();
@@ -199,7 +219,9 @@ namespace MyGUI
 	void EditText::checkVertexSize()
 	{
 		// если вершин не хватит, делаем реалок, с учетом выделения * 2 и курсора
-		size_t need = (mCaption.size() * (mShadow ? 3 : 2) + 2) * VERTEX_IN_QUAD;
+		// байт UTF-8 не меньше, чем символов
+		size_t length = mUTF8Caption ? mCaptionUTF8.size() : mCaption.size();
+		size_t need = (length * (mShadow ? 3 : 2) + 2) * VERTEX_IN_QUAD;
 		if (mCountVertex < need)
 		{
 			mCountVertex = need + SIMPLETEXT_COUNT_VERTEX;
@@ -210,6 +232,11 @@ namespace MyGUI
 
 	const UString& EditText::getCaption() const
 	{
+		if (mCaptionOutDate)
+		{
+			mCaption = mCaptionUTF8;
+			mCaptionOutDate = false;
+		}
 		return mCaption;
 	}
 
@@ -521,7 +548,10 @@ namespace MyGUI
 				width -= 2;
 		}
 
-		mTextView.update(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+		if (mUTF8Caption)
+			mTextView.updateUTF8(mCaptionUTF8, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+		else
+			mTextView.update(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
 	}
 
 	void EditText::setStateData(IStateInfo* _data)
@@ -540,12 +570,15 @@ namespace MyGUI
 		if (mRenderItem->getCurrentUpdate() || mTextOutDate)
 			updateRawData();
 
-		Vertex* vertex = mRenderItem->getCurrentVertexBuffer();
-
-		const RenderTargetInfo& renderTargetInfo = mRenderItem->getRenderTarget()->getInfo();
+		const RenderTargetInfo& renderTargetInfo = mRenderItem->getRenderTargetInfo();
 
-		// колличество отрисованных вершин
-		size_t vertexCount = 0;
+		// квады копятся и пишутся в буфер пачками
+		vertex_utility::QuadBatch batch(
+			mRenderItem->getCurrentVertexBuffer(),
+			renderTargetInfo,
+			(float)mCroppedParent->getAbsoluteLeft(),
+			(float)mCroppedParent->getAbsoluteTop() + (mShiftText ? 1.0f : 0.0f),
+			mNode->getNodeDepth());
 
 		// текущие цвета
 		uint32 colour = mCurrentColourNative;
@@ -586,7 +619,7 @@ namespace MyGUI
 				{
 					vertexRect.set(left, top, left + fullAdvance, top + (float)mFontHeight);
 
-					drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, selectedUVRect, selectedColour);
+					drawGlyph(batch, vertexRect, selectedUVRect, selectedColour);
 				}
 
 				// Render the glyph shadow, if any.
@@ -597,7 +630,7 @@ namespace MyGUI
 					vertexRect.right = vertexRect.left + sim->getWidth();
 					vertexRect.bottom = vertexRect.top + sim->getHeight();
 
-					drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, sim->getUVRect(), mShadowColourNative);
+					drawGlyph(batch, vertexRect, sim->getUVRect(), mShadowColourNative);
 				}
 
 				// Render the glyph itself.
@@ -606,7 +639,7 @@ namespace MyGUI
 				vertexRect.right = vertexRect.left + sim->getWidth();
 				vertexRect.bottom = vertexRect.top + sim->getHeight();
 
-				drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, sim->getUVRect(), (!select || !mInvertSelect) ? colour : inverseColour);
+				drawGlyph(batch, vertexRect, sim->getUVRect(), (!select || !mInvertSelect) ? colour : inverseColour);
 
 				left += fullAdvance;
 				++index;
@@ -623,11 +656,13 @@ namespace MyGUI
 			GlyphInfo* cursorGlyph = mFont->getGlyphInfo(static_cast<Char>(FontCodeType::Cursor));
 			vertexRect.set((float)point.left, (float)point.top, (float)point.left + cursorGlyph->width, (float)(point.top + mFontHeight));
 
-			drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, cursorGlyph->uvRect, mCurrentColourNative | 0x00FFFFFF);
+			drawGlyph(batch, vertexRect, cursorGlyph->uvRect, mCurrentColourNative | 0x00FFFFFF);
 		}
 
+		batch.flush();
+
 		// колличество реально отрисованных вершин
-		mRenderItem->setLastVertexCount(vertexCount);
+		mRenderItem->setLastVertexCount(batch.getVertexCount());
 	}
 
 	void EditText::setInvertSelected(bool _value)
@@ -679,64 +714,8 @@ namespace MyGUI
 		return mShadowColour;
 	}
 
-	void EditText::drawQuad(
-		Vertex*& _vertex,
-		size_t& _vertexCount,
-		const FloatRect& _vertexRect,
-		float _vertexZ,
-		const FloatRect& _textureRect,
-		uint32 _colour) const
-	{
-		_vertex[0].x = _vertexRect.left;
-		_vertex[0].y = _vertexRect.top;
-		_vertex[0].z = _vertexZ;
-		_vertex[0].colour = _colour;
-		_vertex[0].u = _textureRect.left;
-		_vertex[0].v = _textureRect.top;
-
-		_vertex[2].x = _vertexRect.left;
-		_vertex[2].y = _vertexRect.bottom;
-		_vertex[2].z = _vertexZ;
-		_vertex[2].colour = _colour;
-		_vertex[2].u = _textureRect.left;
-		_vertex[2].v = _textureRect.bottom;
-
-		_vertex[1].x = _vertexRect.right;
-		_vertex[1].y = _vertexRect.top;
-		_vertex[1].z = _vertexZ;
-		_vertex[1].colour = _colour;
-		_vertex[1].u = _textureRect.right;
-		_vertex[1].v = _textureRect.top;
-
-		_vertex[3].x = _vertexRect.right;
-		_vertex[3].y = _vertexRect.top;
-		_vertex[3].z = _vertexZ;
-		_vertex[3].colour = _colour;
-		_vertex[3].u = _textureRect.right;
-		_vertex[3].v = _textureRect.top;
-
-		_vertex[5].x = _vertexRect.left;
-		_vertex[5].y = _vertexRect.bottom;
-		_vertex[5].z = _vertexZ;
-		_vertex[5].colour = _colour;
-		_vertex[5].u = _textureRect.left;
-		_vertex[5].v = _textureRect.bottom;
-
-		_vertex[4].x = _vertexRect.right;
-		_vertex[4].y = _vertexRect.bottom;
-		_vertex[4].z = _vertexZ;
-		_vertex[4].colour = _colour;
-		_vertex[4].u = _textureRect.right;
-		_vertex[4].v = _textureRect.bottom;
-
-		_vertex += VERTEX_IN_QUAD;
-		_vertexCount += VERTEX_IN_QUAD;
-	}
-
 	void EditText::drawGlyph(
-		const RenderTargetInfo& _renderTargetInfo,
-		Vertex*& _vertex,
-		size_t& _vertexCount,
+		vertex_utility::QuadBatch& _batch,
 		FloatRect _vertexRect,
 		FloatRect _textureRect,
 		uint32 _colour) const
@@ -801,16 +780,7 @@ namespace MyGUI
 			}
 		}
 
-		float pix_left = mCroppedParent->getAbsoluteLeft() - _renderTargetInfo.leftOffset + _vertexRect.left;
-		float pix_top = mCroppedParent->getAbsoluteTop() - _renderTargetInfo.topOffset + (mShiftText ? 1.0f : 0.0f) + _vertexRect.top;
-
-		FloatRect vertexRect(
-			((_renderTargetInfo.pixScaleX * pix_left + _renderTargetInfo.hOffset) * 2.0f) - 1.0f,
-			-(((_renderTargetInfo.pixScaleY * pix_top + _renderTargetInfo.vOffset) * 2.0f) - 1.0f),
-			((_renderTargetInfo.pixScaleX * (pix_left + _vertexRect.width()) + _renderTargetInfo.hOffset) * 2.0f) - 1.0f,
-			-(((_renderTargetInfo.pixScaleY * (pix_top + _vertexRect.height()) + _renderTargetInfo.vOffset) * 2.0f) - 1.0f));
-
-		drawQuad(_vertex, _vertexCount, vertexRect, mNode->getNodeDepth(), _textureRect, _colour);
+		_batch.add(_vertexRect, _textureRect, _colour);
 	}
 
 } // namespace MyGUI
@@ -15,6 +15,7 @@ namespace MyGUI
 	template <> const char* Singleton<FactoryManager>::mClassTypeName = "FactoryManager";
 
 	FactoryManager::FactoryManager() :
+		mChangeCount(0),
 		mIsInitialise(false)
 	{
 	}
@@ -40,45 +41,85 @@ namespace MyGUI
 	void FactoryManager::registerFactory(const std::string& _category, const std::string& _type, Delegate::IDelegate* _delegate)
 	{
 		//FIXME
-		mRegisterFactoryItems[_category][_type] = _delegate;
+		mRegisterFactoryItems[StringId(_category)][StringId(_type)] = _delegate;
+		mChangeCount ++;
 	}
 
 	void FactoryManager::unregisterFactory(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
+		StringId categoryId;
+		StringId typeId;
+		if (!StringId::find(_category, categoryId) || !StringId::find(_type, typeId))
+		{
+			return;
+		}
+
+		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(categoryId);
 		if (category == mRegisterFactoryItems.end())
 		{
 			return;
 		}
-		MapFactoryItem::iterator type = category->second.find(_type);
+		MapFactoryItem::iterator type = category->second.find(typeId);
 		if (type == category->second.end())
 		{
 			return;
 		}
 
 		category->second.erase(type);
+		mChangeCount ++;
 	}
 
 	void FactoryManager::unregisterFactory(const std::string& _category)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
+		StringId categoryId;
+		if (!StringId::find(_category, categoryId))
+		{
+			return;
+		}
+
+		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(categoryId);
 		if (category == mRegisterFactoryItems.end())
 		{
 			return;
 		}
 		mRegisterFactoryItems.erase(category);
+		mChangeCount ++;
 	}
 
 	IObject* FactoryManager::createObject(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
+		Delegate* factory = getFactory(_category, _type);
+		if (factory == nullptr)
+		{
+			return nullptr;
+		}
+
+		IObject* result = nullptr;
+		(*factory)(result);
+		return result;
+	}
+
+	FactoryManager::Delegate* FactoryManager::getFactory(const std::string& _category, const std::string& _type)
+	{
+		StringId categoryId;
+		if (!StringId::find(_category, categoryId))
+		{
+			return nullptr;
+		}
+
+		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(categoryId);
 		if (category == mRegisterFactoryItems.end())
 		{
 			return nullptr;
 		}
 
-		std::string typeName = BackwardCompatibility::getFactoryRename(_category, _type);
-		MapFactoryItem::iterator type = category->second.find(typeName);
+		StringId typeId;
+		if (!StringId::find(BackwardCompatibility::getFactoryRename(_category, _type), typeId))
+		{
+			return nullptr;
+		}
+
+		MapFactoryItem::iterator type = category->second.find(typeId);
 		if (type == category->second.end())
 		{
 			return nullptr;
@@ -88,9 +129,12 @@ namespace MyGUI
 			return nullptr;
 		}
 
-		IObject* result = nullptr;
-		type->second(result);
-		return result;
+		return &type->second;
+	}
+
+	size_t FactoryManager::getChangeCount() const
+	{
+		return mChangeCount;
 	}
 
 	void FactoryManager::destroyObject(IObject* _object)
@@ -117,12 +161,19 @@ namespace MyGUI
 
 	bool FactoryManager::isFactoryExist(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
+		StringId categoryId;
+		StringId typeId;
+		if (!StringId::find(_category, categoryId) || !StringId::find(_type, typeId))
+		{
+			return false;
+		}
+
+		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(categoryId);
 		if (category == mRegisterFactoryItems.end())
 		{
 			return false;
 		}
-		MapFactoryItem::iterator type = category->second.find(_type);
+		MapFactoryItem::iterator type = category->second.find(typeId);
 		if (type == category->second.end())
 		{
 			return false;
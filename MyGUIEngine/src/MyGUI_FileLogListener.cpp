@@ -12,6 +12,15 @@
 namespace MyGUI
 {
 
+	namespace
+	{
+		void writeTwoDigits(std::ostream& _stream, int _value)
+		{
+			_stream.put(static_cast<char>('0' + (_value / 10) % 10));
+			_stream.put(static_cast<char>('0' + _value % 10));
+		}
+	}
+
 	FileLogListener::FileLogListener()
 	{
 	}
@@ -59,11 +68,18 @@ namespace MyGUI
 		if (mStream.is_open())
 		{
 			const char* separator = "  |  ";
-			mStream << std::setw(2) << std::setfill('0') << _time->tm_hour << ":"
-				<< std::setw(2) << std::setfill('0') << _time->tm_min << ":"
-				<< std::setw(2) << std::setfill('0') << _time->tm_sec << separator
+			writeTwoDigits(mStream, _time->tm_hour);
+			mStream.put(':');
+			writeTwoDigits(mStream, _time->tm_min);
+			mStream.put(':');
+			writeTwoDigits(mStream, _time->tm_sec);
+			mStream << separator
 				<< _section << separator << _level.print() << separator
-				<< _message << separator << _file << separator << _line << std::endl;
+				<< _message << separator << _file << separator << _line << '\n';
+
+			// сбрасываем буфер на каждой строке только для ошибок, остальное пишется при flush
+			if (_level >= LogLevel::Error)
+				mStream.flush();
 		}
 	}
 
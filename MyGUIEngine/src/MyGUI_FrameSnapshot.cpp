@@ -0,0 +1,295 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_FrameSnapshot.h"
+#include "MyGUI_LayerManager.h"
+#include "MyGUI_RenderManager.h"
+
+namespace MyGUI
+{
+
+	size_t FrameSnapshotVertexBuffer::msLastVersion = 0;
+
+	FrameSnapshotVertexBuffer::FrameSnapshotVertexBuffer() :
+		mVersion(++msLastVersion),
+		mUnlockedVersion(0)
+	{
+	}
+
+	FrameSnapshotVertexBuffer::~FrameSnapshotVertexBuffer()
+	{
+	}
+
+	void FrameSnapshotVertexBuffer::setVertexCount(size_t _value)
+	{
+		if (mVertexes.size() != _value)
+			mVersion = ++msLastVersion;
+		mVertexes.resize(_value);
+	}
+
+	size_t FrameSnapshotVertexBuffer::getVertexCount()
+	{
+		return mVertexes.size();
+	}
+
+	Vertex* FrameSnapshotVertexBuffer::lock()
+	{
+		// после блокировки содержимое считается измененным
+		mVersion = ++msLastVersion;
+		return mVertexes.empty() ? nullptr : &mVertexes[0];
+	}
+
+	void FrameSnapshotVertexBuffer::unlock()
+	{
+		// рендер айтем перегенерирует те же вершины, например при смене текстуры
+		// он пересоздает буфер через setVertexCount, тогда версия возвращается к прошлой
+		if (mUnlockedVertexes.size() == mVertexes.size() &&
+			(mVertexes.empty() || memcmp(&mUnlockedVertexes[0], &mVertexes[0], mVertexes.size() * sizeof(Vertex)) == 0))
+		{
+			mVersion = mUnlockedVersion;
+		}
+		else
+		{
+			mUnlockedVertexes = mVertexes;
+			mUnlockedVersion = mVersion;
+		}
+	}
+
+	size_t FrameSnapshotVertexBuffer::getVersion() const
+	{
+		return mVersion;
+	}
+
+	const VectorVertex& FrameSnapshotVertexBuffer::getVertexes() const
+	{
+		return mVertexes;
+	}
+
+	FrameSnapshot::FrameSnapshot() :
+		mBackFrame(0)
+	{
+	}
+
+	FrameSnapshot::~FrameSnapshot()
+	{
+		RenderManager* render = RenderManager::getInstancePtr();
+		if (render == nullptr)
+			return;
+
+		releaseFrame(mFrames[0]);
+		releaseFrame(mFrames[1]);
+
+		for (MapRenderBuffer::iterator iter = mItemBuffers.begin(); iter != mItemBuffers.end(); ++iter)
+		{
+			if (iter->second.buffer != nullptr)
+				render->destroyVertexBuffer(iter->second.buffer);
+		}
+		mItemBuffers.clear();
+
+		for (VectorVertexBuffer::iterator iter = mRenderBuffers.begin(); iter != mRenderBuffers.end(); ++iter)
+		{
+			if ((*iter) != nullptr)
+				render->destroyVertexBuffer(*iter);
+		}
+		mRenderBuffers.clear();
+	}
+
+	void FrameSnapshot::capture(IRenderTarget* _target, bool _update)
+	{
+		RenderManager& render = RenderManager::getInstance();
+		MYGUI_ASSERT(render.getFrameSnapshotMode(), "FrameSnapshot requires RenderManager frame snapshot mode");
+
+		Frame& frame = mFrames[mBackFrame];
+		frame.drawList.clear();
+		frame.drawList.setTarget(_target);
+		frame.vertexes.clear();
+		frame.sources.clear();
+		frame.submitted = false;
+
+		// повторный захват без swap, прошлый захват больше не будет нарисован
+		for (std::vector<ITexture*>::iterator iter = frame.textures.begin(); iter != frame.textures.end(); ++iter)
+			render._unpinTexture(*iter);
+		frame.textures.clear();
+
+		// удаленные буферы могут быть заменены новыми по тому же адресу
+		render._takeReleasedItemVertexBuffers(frame.released);
+		for (VectorConstVertexBuffer::const_iterator iter = frame.released.begin(); iter != frame.released.end(); ++iter)
+			mUploaded.erase(*iter);
+
+		LayerManager::getInstance().renderToDrawList(&frame.drawList, _update);
+
+		// буферы рендер айтемов переписываются в следующем кадре, поэтому копируем вершины,
+		// если поток рендера их еще не получил
+		VectorDrawCommand& commands = frame.drawList.getCommands();
+		frame.sources.resize(commands.size());
+		for (size_t index = 0; index < commands.size(); ++index)
+		{
+			DrawCommand& command = commands[index];
+			CommandSource& source = frame.sources[index];
+			const FrameSnapshotVertexBuffer* buffer = dynamic_cast<const FrameSnapshotVertexBuffer*>(command.buffer);
+
+			source.buffer = buffer;
+			source.offset = frame.vertexes.size();
+			source.state = SourceState(buffer != nullptr ? buffer->getVersion() : 0, command.count);
+			source.copied = true;
+			source.resident = false;
+			if (buffer != nullptr)
+			{
+				MapSourceState::const_iterator uploaded = mUploaded.find(buffer);
+				if (uploaded != mUploaded.end() && uploaded->second.version == source.state.version && uploaded->second.count == source.state.count)
+					source.copied = false;
+			}
+
+			if (source.copied && buffer != nullptr)
+			{
+				const VectorVertex& vertexes = buffer->getVertexes();
+				frame.vertexes.insert(frame.vertexes.end(), vertexes.begin(), vertexes.begin() + command.count);
+			}
+			else if (source.copied)
+			{
+				Vertex* vertexes = command.buffer->lock();
+				frame.vertexes.insert(frame.vertexes.end(), vertexes, vertexes + command.count);
+				command.buffer->unlock();
+			}
+
+			command.buffer = nullptr;
+
+			if (command.texture != nullptr && std::find(frame.textures.begin(), frame.textures.end(), command.texture) == frame.textures.end())
+				frame.textures.push_back(command.texture);
+		}
+
+		for (std::vector<ITexture*>::iterator iter = frame.textures.begin(); iter != frame.textures.end(); ++iter)
+			render._pinTexture(*iter);
+
+		frame.drawList.setTarget(nullptr);
+	}
+
+	void FrameSnapshot::swap()
+	{
+		RenderManager& render = RenderManager::getInstance();
+		Frame& captured = mFrames[mBackFrame];
+		Frame& previous = mFrames[1 - mBackFrame];
+
+		// поток рендера сейчас не рисует, можно писать в текстуры
+		render._flushDeferredTextureWrites();
+
+		if (previous.submitted)
+		{
+			for (VectorCommandSource::const_iterator iter = previous.sources.begin(); iter != previous.sources.end(); ++iter)
+			{
+				if ((*iter).buffer == nullptr)
+					continue;
+
+				// если загрузка не удалась, то в следующем кадре вершины копируются снова
+				if ((*iter).resident)
+					mUploaded[(*iter).buffer] = (*iter).state;
+				else
+					mUploaded.erase((*iter).buffer);
+			}
+		}
+		else
+		{
+			// кадр пропущен, поток рендера все равно должен удалить его буферы
+			captured.released.insert(captured.released.begin(), previous.released.begin(), previous.released.end());
+		}
+
+		for (VectorConstVertexBuffer::const_iterator iter = captured.released.begin(); iter != captured.released.end(); ++iter)
+			mUploaded.erase(*iter);
+
+		releaseFrame(previous);
+		mBackFrame = 1 - mBackFrame;
+	}
+
+	void FrameSnapshot::submit(IRenderTarget* _target)
+	{
+		Frame& frame = mFrames[1 - mBackFrame];
+		const VectorDrawCommand& commands = frame.drawList.getCommands();
+		RenderManager& render = RenderManager::getInstance();
+
+		for (VectorConstVertexBuffer::const_iterator iter = frame.released.begin(); iter != frame.released.end(); ++iter)
+		{
+			MapRenderBuffer::iterator item = mItemBuffers.find(*iter);
+			if (item == mItemBuffers.end())
+				continue;
+			if (item->second.buffer != nullptr)
+				render.destroyVertexBuffer(item->second.buffer);
+			mItemBuffers.erase(item);
+		}
+
+		size_t pooled = 0;
+		for (size_t index = 0; index < commands.size(); ++index)
+		{
+			const DrawCommand& command = commands[index];
+			CommandSource& source = frame.sources[index];
+
+			IVertexBuffer* buffer = nullptr;
+			RenderBuffer* item = nullptr;
+			bool upload = true;
+			if (source.buffer != nullptr)
+			{
+				item = &mItemBuffers[source.buffer];
+				if (item->buffer == nullptr)
+				{
+					item->buffer = render.createVertexBuffer();
+					item->state = SourceState();
+				}
+				buffer = item->buffer;
+
+				// неизмененные вершины уже лежат в буфере рендера, swap обновляет
+				// состояние загрузок только по подтвержденным здесь версиям
+				bool actual = item->state.version == source.state.version && item->state.count == source.state.count;
+				MYGUI_ASSERT(actual || source.copied, "Render buffer lost vertexes that were not copied into frame");
+				upload = !actual;
+			}
+			else
+			{
+				if (pooled == mRenderBuffers.size())
+					mRenderBuffers.push_back(render.createVertexBuffer());
+				buffer = mRenderBuffers[pooled++];
+			}
+
+			if (buffer == nullptr)
+				continue;
+
+			if (upload)
+			{
+				buffer->setVertexCount(command.count);
+				Vertex* dest = buffer->lock();
+				if (dest == nullptr)
+					continue;
+				std::copy(frame.vertexes.begin() + source.offset, frame.vertexes.begin() + source.offset + command.count, dest);
+				buffer->setWrittenVertexCount(command.count);
+				buffer->unlock();
+
+				if (item != nullptr)
+					item->state = source.state;
+			}
+
+			source.resident = true;
+
+			_target->doRender(buffer, command.texture, command.count);
+		}
+
+		frame.submitted = true;
+	}
+
+	const DrawList& FrameSnapshot::getFrontDrawList() const
+	{
+		return mFrames[1 - mBackFrame].drawList;
+	}
+
+	void FrameSnapshot::releaseFrame(Frame& _frame)
+	{
+		// кадр больше не будет нарисован, отложенное удаление его текстур выполняется здесь
+		RenderManager& render = RenderManager::getInstance();
+		for (std::vector<ITexture*>::iterator iter = _frame.textures.begin(); iter != _frame.textures.end(); ++iter)
+			render._unpinTexture(*iter);
+		_frame.textures.clear();
+		_frame.released.clear();
+		_frame.submitted = false;
+	}
+} // namespace MyGUI
@@ -26,6 +26,10 @@
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_ToolTipManager.h"
+#include "MyGUI_TextViewCache.h"
+#include "MyGUI_MaskPickManager.h"
+#include "MyGUI_TweenManager.h"
+#include "MyGUI_TextureMemoryManager.h"
 #include "MyGUI_TextureUtility.h"
 
 namespace MyGUI
@@ -51,6 +55,10 @@ namespace MyGUI
 		mResourceManager(nullptr),
 		mFactoryManager(nullptr),
 		mToolTipManager(nullptr),
+		mTextViewCache(nullptr),
+		mMaskPickManager(nullptr),
+		mTweenManager(nullptr),
+		mTextureMemoryManager(nullptr),
 		mIsInitialise(false)
 	{
 	}
@@ -82,6 +90,10 @@ namespace MyGUI
 		mLanguageManager = new LanguageManager();
 		mFactoryManager = new FactoryManager();
 		mToolTipManager = new ToolTipManager();
+		mTextViewCache = new TextViewCache();
+		mMaskPickManager = new MaskPickManager();
+		mTweenManager = new TweenManager();
+		mTextureMemoryManager = new TextureMemoryManager();
 
 		mResourceManager->initialise();
 		mLayerManager->initialise();
@@ -99,6 +111,10 @@ namespace MyGUI
 		mLanguageManager->initialise();
 		mFactoryManager->initialise();
 		mToolTipManager->initialise();
+		mTextViewCache->initialise();
+		mMaskPickManager->initialise();
+		mTweenManager->initialise();
+		mTextureMemoryManager->initialise();
 
 		WidgetManager::getInstance().registerUnlinker(this);
 
@@ -144,6 +160,10 @@ namespace MyGUI
 		mResourceManager->shutdown();
 		mFactoryManager->shutdown();
 		mToolTipManager->shutdown();
+		mTextViewCache->shutdown();
+		mMaskPickManager->shutdown();
+		mTweenManager->shutdown();
+		mTextureMemoryManager->shutdown();
 
 		WidgetManager::getInstance().unregisterUnlinker(this);
 		mWidgetManager->shutdown();
@@ -164,6 +184,10 @@ namespace MyGUI
 		delete mResourceManager;
 		delete mFactoryManager;
 		delete mToolTipManager;
+		delete mTextViewCache;
+		delete mMaskPickManager;
+		delete mTweenManager;
+		delete mTextureMemoryManager;
 
 		// сбрасываем кеш
 		texture_utility::getTextureSize("", false);
@@ -174,7 +198,19 @@ namespace MyGUI
 
 	Widget* Gui::baseCreateWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name)
 	{
-		Widget* widget = WidgetManager::getInstance().createWidget(_style, _type, _skin, _coord, /*_align, */nullptr, nullptr, _name);
+		ResolvedWidgetType type;
+		mWidgetManager->resolveWidgetType(_type, _skin, type);
+		return baseCreateWidget(_style, type, _coord, _align, _layer, _name);
+	}
+
+	Widget* Gui::_createWidget(const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name)
+	{
+		return baseCreateWidget(WidgetStyle::Overlapped, _type, _coord, _align, _layer, _name);
+	}
+
+	Widget* Gui::baseCreateWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name)
+	{
+		Widget* widget = WidgetManager::getInstance().createWidget(_style, _type, _coord, /*_align, */nullptr, nullptr, _name);
 		mWidgetChild.push_back(widget);
 
 		widget->setAlign(_align);
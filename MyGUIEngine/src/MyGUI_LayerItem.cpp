@@ -169,7 +169,8 @@ namespace MyGUI
 
 	void LayerItem::detachFromLayerItemNode(bool _deep)
 	{
-		for (VectorLayerItem::iterator item = mLayerItems.begin(); item != mLayerItems.end(); ++item)
+		// отсоединяем в обратном порядке, тогда айтемы удаляются с конца рендер айтема
+		for (VectorLayerItem::reverse_iterator item = mLayerItems.rbegin(); item != mLayerItems.rend(); ++item)
 		{
 			(*item)->detachFromLayerItemNode(_deep);
 		}
@@ -192,7 +193,7 @@ namespace MyGUI
 		if (node)
 		{
 			//for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget) (*widget)->_detachFromLayerItemKeeperByStyle(_deep);
-			for (VectorSubWidget::iterator skin = mDrawItems.begin(); skin != mDrawItems.end(); ++skin)
+			for (VectorSubWidget::reverse_iterator skin = mDrawItems.rbegin(); skin != mDrawItems.rend(); ++skin)
 			{
 				(*skin)->destroyDrawItem();
 			}
@@ -14,6 +14,7 @@
 
 #include "MyGUI_SharedLayer.h"
 #include "MyGUI_OverlappedLayer.h"
+#include "MyGUI_CachedLayer.h"
 
 namespace MyGUI
 {
@@ -23,7 +24,10 @@ namespace MyGUI
 
 	LayerManager::LayerManager() :
 		mIsInitialise(false),
-		mCategoryName("Layer")
+		mCategoryName("Layer"),
+		mVisitedNodeCount(0),
+		mGeneratedVertexCount(0),
+		mNodeTranslation(false)
 	{
 	}
 
@@ -37,6 +41,7 @@ namespace MyGUI
 
 		FactoryManager::getInstance().registerFactory<SharedLayer>(mCategoryName);
 		FactoryManager::getInstance().registerFactory<OverlappedLayer>(mCategoryName);
+		FactoryManager::getInstance().registerFactory<CachedLayer>(mCategoryName);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
@@ -49,6 +54,7 @@ namespace MyGUI
 
 		FactoryManager::getInstance().unregisterFactory<SharedLayer>(mCategoryName);
 		FactoryManager::getInstance().unregisterFactory<OverlappedLayer>(mCategoryName);
+		FactoryManager::getInstance().unregisterFactory<CachedLayer>(mCategoryName);
 
 		// удаляем все хранители слоев
 		clear();
@@ -122,6 +128,23 @@ namespace MyGUI
 
 	// поправить на виджет и проверять на рутовость
 	void LayerManager::attachToLayerNode(const std::string& _name, Widget* _item)
+	{
+		// имя слоя, которого нет в таблице строк, не совпадет ни с одним слоем
+		StringId name;
+		if (!StringId::find(_name, name))
+		{
+			MYGUI_ASSERT(nullptr != _item, "pointer must be valid");
+			MYGUI_ASSERT(_item->isRootWidget(), "attached widget must be root");
+
+			_item->detachFromLayer();
+			MYGUI_LOG(Error, "Layer '" << _name << "' is not found");
+			return;
+		}
+
+		attachToLayerNode(name, _item);
+	}
+
+	void LayerManager::attachToLayerNode(StringId _name, Widget* _item)
 	{
 		MYGUI_ASSERT(nullptr != _item, "pointer must be valid");
 		MYGUI_ASSERT(_item->isRootWidget(), "attached widget must be root");
@@ -130,17 +153,15 @@ namespace MyGUI
 		_item->detachFromLayer();
 
 		// а теперь аттачим
-		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
+		ILayer* layer = getByName(_name);
+		if (layer != nullptr)
 		{
-			if (_name == (*iter)->getName())
-			{
-				ILayerNode* node = (*iter)->createChildItemNode();
-				node->attachLayerItem(_item);
+			ILayerNode* node = layer->createChildItemNode();
+			node->attachLayerItem(_item);
 
-				return;
-			}
+			return;
 		}
-		MYGUI_LOG(Error, "Layer '" << _name << "' is not found");
+		MYGUI_LOG(Error, "Layer '" << _name.toString() << "' is not found");
 		//MYGUI_EXCEPT("Layer '" << _name << "' is not found");
 	}
 
@@ -223,20 +244,74 @@ namespace MyGUI
 
 	void LayerManager::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		mVisitedNodeCount = 0;
+		mGeneratedVertexCount = 0;
+
 		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
 		{
 			(*iter)->renderToTarget(_target, _update);
 		}
 	}
 
+	void LayerManager::renderToDrawList(DrawList* _list, bool _update)
+	{
+		mVisitedNodeCount = 0;
+		mGeneratedVertexCount = 0;
+
+		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
+		{
+			_list->setCurrentLayer(*iter);
+			(*iter)->renderToTarget(_list, _update);
+		}
+
+		_list->setCurrentLayer(nullptr);
+	}
+
+	size_t LayerManager::getVisitedNodeCount() const
+	{
+		return mVisitedNodeCount;
+	}
+
+	void LayerManager::_notifyNodeVisited()
+	{
+		mVisitedNodeCount++;
+	}
+
+	size_t LayerManager::getGeneratedVertexCount() const
+	{
+		return mGeneratedVertexCount;
+	}
+
+	void LayerManager::_notifyVertexesGenerated(size_t _count)
+	{
+		mGeneratedVertexCount += _count;
+	}
+
+	void LayerManager::setNodeTranslation(bool _value)
+	{
+		mNodeTranslation = _value;
+	}
+
+	bool LayerManager::getNodeTranslation() const
+	{
+		return mNodeTranslation;
+	}
+
 	ILayer* LayerManager::getByName(const std::string& _name, bool _throw) const
+	{
+		StringId name;
+		ILayer* result = StringId::find(_name, name) ? getByName(name) : nullptr;
+		MYGUI_ASSERT(result != nullptr || !_throw, "Layer '" << _name << "' not found");
+		return result;
+	}
+
+	ILayer* LayerManager::getByName(StringId _name) const
 	{
 		for (VectorLayer::const_iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
 		{
-			if (_name == (*iter)->getName())
+			if (_name == (*iter)->getNameId())
 				return (*iter);
 		}
-		MYGUI_ASSERT(!_throw, "Layer '" << _name << "' not found");
 		return nullptr;
 	}
 
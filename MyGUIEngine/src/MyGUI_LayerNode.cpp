@@ -10,11 +10,13 @@
 #include "MyGUI_ITexture.h"
 #include "MyGUI_ISubWidget.h"
 #include "MyGUI_ISubWidgetText.h"
+#include "MyGUI_LayerManager.h"
 
 namespace MyGUI
 {
 
 	LayerNode::LayerNode(ILayer* _layer, ILayerNode* _parent) :
+		mRenderTarget(nullptr),
 		mParent(_parent),
 		mLayer(_layer),
 		mOutOfDate(false),
@@ -42,7 +44,7 @@ namespace MyGUI
 		LayerNode* layer = new LayerNode(mLayer, this);
 		mChildItems.push_back(layer);
 
-		mOutOfDate = true;
+		markOutOfDate();
 
 		return layer;
 	}
@@ -56,7 +58,7 @@ namespace MyGUI
 				delete _node;
 				mChildItems.erase(iter);
 
-				mOutOfDate = true;
+				markOutOfDate();
 
 				return;
 			}
@@ -73,7 +75,7 @@ namespace MyGUI
 				mChildItems.erase(iter);
 				mChildItems.push_back(_item);
 
-				mOutOfDate = true;
+				markOutOfDate();
 
 				return;
 			}
@@ -83,20 +85,43 @@ namespace MyGUI
 
 	void LayerNode::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		LayerManager::getInstance()._notifyNodeVisited();
+
+		// ничего не менялось, повторяем отрисовку прошлого кадра
+		if (!mOutOfDate && !_update && mRenderTarget == _target)
+		{
+			for (VectorRenderItem::iterator iter = mRenderQueue.begin(); iter != mRenderQueue.end(); ++iter)
+				(*iter)->renderToTarget(_target, false);
+			return;
+		}
+
+		// сбрасываем до отрисовки, чтобы изменения во время отрисовки не потерялись
+		mOutOfDate = false;
+		mRenderTarget = _target;
+		mRenderQueue.clear();
+
 		mDepth = _target->getInfo().maximumDepth;
 
 		// сначала отрисовываем свое
 		for (VectorRenderItem::iterator iter = mFirstRenderItems.begin(); iter != mFirstRenderItems.end(); ++iter)
+		{
 			(*iter)->renderToTarget(_target, _update);
+			mRenderQueue.push_back(*iter);
+		}
 
 		for (VectorRenderItem::iterator iter = mSecondRenderItems.begin(); iter != mSecondRenderItems.end(); ++iter)
+		{
 			(*iter)->renderToTarget(_target, _update);
+			mRenderQueue.push_back(*iter);
+		}
 
 		// теперь отрисовываем дочерние узлы
 		for (VectorILayerNode::iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
-			(*iter)->renderToTarget(_target, _update);
-
-		mOutOfDate = false;
+		{
+			LayerNode* node = static_cast<LayerNode*>(*iter);
+			node->renderToTarget(_target, _update);
+			mRenderQueue.insert(mRenderQueue.end(), node->mRenderQueue.begin(), node->mRenderQueue.end());
+		}
 	}
 
 	void LayerNode::resizeView(const IntSize& _viewSize)
@@ -135,7 +160,6 @@ namespace MyGUI
 		else
 			item = addToRenderItemSecondQueue(_texture, _manualRender);
 
-		mOutOfDate = false;
 		return item;
 	}
 
@@ -143,9 +167,7 @@ namespace MyGUI
 	{
 		if (mFirstRenderItems.empty() || _manualRender)
 		{
-			RenderItem* item = new RenderItem();
-			item->setTexture(_texture);
-			item->setManualRender(_manualRender);
+			RenderItem* item = createRenderItem(_texture, _manualRender);
 			mFirstRenderItems.push_back(item);
 
 			return item;
@@ -186,9 +208,7 @@ namespace MyGUI
 		}
 
 		// not found, create new
-		RenderItem* item = new RenderItem();
-		item->setTexture(_texture);
-		item->setManualRender(_manualRender);
+		RenderItem* item = createRenderItem(_texture, _manualRender);
 		mFirstRenderItems.push_back(item);
 
 		return item;
@@ -213,10 +233,19 @@ namespace MyGUI
 		}
 
 		// not found, create new
-		RenderItem* item = new RenderItem();
+		RenderItem* item = createRenderItem(_texture, _manualRender);
+		mSecondRenderItems.push_back(item);
+
+		return item;
+	}
+
+	RenderItem* LayerNode::createRenderItem(ITexture* _texture, bool _manualRender)
+	{
+		RenderItem* item = new RenderItem(this);
 		item->setTexture(_texture);
 		item->setManualRender(_manualRender);
-		mSecondRenderItems.push_back(item);
+
+		markOutOfDate();
 
 		return item;
 	}
@@ -226,7 +255,7 @@ namespace MyGUI
 		mLayerItems.push_back(_item);
 		_item->attachItemToNode(mLayer, this);
 
-		mOutOfDate = true;
+		markOutOfDate();
 	}
 
 	void LayerNode::detachLayerItem(ILayerItem* _item)
@@ -237,7 +266,7 @@ namespace MyGUI
 			{
 				mLayerItems.erase(iter);
 
-				mOutOfDate = true;
+				markOutOfDate();
 
 				return;
 			}
@@ -247,11 +276,22 @@ namespace MyGUI
 
 	void LayerNode::outOfDate(RenderItem* _item)
 	{
-		mOutOfDate = true;
+		markOutOfDate();
 		if (_item)
 			_item->outOfDate();
 	}
 
+	void LayerNode::markOutOfDate()
+	{
+		// если нод уже помечен, то и все его родители тоже
+		LayerNode* node = this;
+		while (node != nullptr && !node->mOutOfDate)
+		{
+			node->mOutOfDate = true;
+			node = static_cast<LayerNode*>(node->mParent);
+		}
+	}
+
 	EnumeratorILayerNode LayerNode::getEnumerator() const
 	{
 		return EnumeratorILayerNode(mChildItems);
@@ -303,7 +343,7 @@ namespace MyGUI
 			std::swap(mFirstRenderItems, nonEmptyItems);
 		}
 
-		mOutOfDate = true;
+		markOutOfDate();
 	}
 
 	ILayer* LayerNode::getLayer() const
@@ -318,25 +358,31 @@ namespace MyGUI
 
 	bool LayerNode::isOutOfDate() const
 	{
-		for (VectorRenderItem::const_iterator item = mFirstRenderItems.begin(); item != mFirstRenderItems.end(); ++item)
-		{
-			if ((*item)->isOutOfDate())
-				return true;
-		}
+		return mOutOfDate;
+	}
 
-		for (VectorRenderItem::const_iterator item = mSecondRenderItems.begin(); item != mSecondRenderItems.end(); ++item)
-		{
-			if ((*item)->isOutOfDate())
-				return true;
-		}
+	IntPoint LayerNode::getOrigin() const
+	{
+		// у общего нода несколько рутовых виджетов, сдвинуть их вместе нельзя
+		if (mLayerItems.size() != 1)
+			return IntPoint();
+		return mLayerItems.front()->getLayerItemOrigin();
+	}
 
-		for (VectorILayerNode::const_iterator item = mChildItems.begin(); item != mChildItems.end(); ++item)
-		{
-			if (static_cast<const LayerNode*>(*item)->isOutOfDate())
-				return true;
-		}
+	bool LayerNode::isOriginItem(const ILayerItem* _item) const
+	{
+		return mLayerItems.size() == 1 && mLayerItems.front() == _item;
+	}
 
-		return mOutOfDate;
+	const IntPoint& LayerNode::getOriginShift() const
+	{
+		return mOriginShift;
+	}
+
+	void LayerNode::_notifyOriginChanged(const IntPoint& _offset)
+	{
+		mOriginShift += _offset;
+		markOutOfDate();
 	}
 
 	float LayerNode::getNodeDepth()
@@ -9,6 +9,12 @@
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_WidgetManager.h"
+#include "MyGUI_Gui.h"
+#include "MyGUI_Widget.h"
+#include "MyGUI_Timer.h"
+#include "MyGUI_ControllerManager.h"
+#include "MyGUI_TweenManager.h"
+#include "MyGUI_InputManager.h"
 
 namespace MyGUI
 {
@@ -18,7 +24,10 @@ namespace MyGUI
 
 	LayoutManager::LayoutManager() :
 		mIsInitialise(false),
-		mXmlLayoutTagName("Layout")
+		mXmlLayoutTagName("Layout"),
+		mLastLoadingHandle(0),
+		mLoadingFrameBudget(4),
+		mFrameSubscribed(false)
 	{
 	}
 
@@ -32,6 +41,8 @@ namespace MyGUI
 		std::string resourceCategory = ResourceManager::getInstance().getCategoryName();
 		FactoryManager::getInstance().registerFactory<ResourceLayout>(resourceCategory);
 
+		WidgetManager::getInstance().registerUnlinker(this);
+
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
 	}
@@ -46,6 +57,22 @@ namespace MyGUI
 		std::string resourceCategory = ResourceManager::getInstance().getCategoryName();
 		FactoryManager::getInstance().unregisterFactory<ResourceLayout>(resourceCategory);
 
+		WidgetManager::getInstance().unregisterUnlinker(this);
+
+		for (VectorLoading::iterator item = mLoadings.begin(); item != mLoadings.end(); ++item)
+			delete *item;
+		mLoadings.clear();
+		updateFrameSubscription();
+
+		for (MapLayoutPool::iterator pool = mPools.begin(); pool != mPools.end(); ++pool)
+		{
+			for (VectorPoolInstance::iterator instance = pool->second->instances.begin(); instance != pool->second->instances.end(); ++instance)
+				delete *instance;
+			delete pool->second;
+		}
+		mPools.clear();
+		mPoolWidgets.clear();
+
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
 		mIsInitialise = false;
 	}
@@ -60,6 +87,206 @@ namespace MyGUI
 	{
 		mCurrentLayoutName = _file;
 
+		ResourceLayout* resource = findLayout(_file);
+
+		VectorWidgetPtr result;
+		if (resource)
+		{
+			MapLayoutPool::iterator pool = mPools.find(_file);
+			if (pool != mPools.end() && pool->second->size != 0)
+			{
+				// пока нет экземпляров берем свежее описание
+				if (pool->second->instances.empty())
+					pool->second->data = resource->getLayoutData();
+				result = loadPooledLayout(pool->second, _prefix, _parent);
+			}
+			else
+			{
+				result = resource->createLayout(_prefix, _parent);
+			}
+		}
+
+		mCurrentLayoutName = "";
+
+		return result;
+	}
+
+	void LayoutManager::unloadLayout(VectorWidgetPtr& _widgets)
+	{
+		if (!_widgets.empty())
+		{
+			MapPoolWidget::iterator item = mPoolWidgets.find(_widgets.front());
+			if (item != mPoolWidgets.end() && !item->second.second->pooled && item->second.second->widgets == _widgets)
+			{
+				LayoutPool* pool = item->second.first;
+				PoolInstance* instance = item->second.second;
+
+				size_t count = 0;
+				for (VectorPoolInstance::iterator iter = pool->instances.begin(); iter != pool->instances.end(); ++iter)
+				{
+					if ((*iter)->pooled)
+						count ++;
+				}
+
+				if (count < pool->size)
+				{
+					for (size_t index = 0; index < instance->items.size(); ++index)
+					{
+						ControllerManager::getInstance().removeItem(instance->items[index].first);
+						TweenManager::getInstance().removeAllTracks(instance->items[index].first);
+					}
+
+					for (VectorWidgetPtr::iterator widget = instance->widgets.begin(); widget != instance->widgets.end(); ++widget)
+					{
+						InputManager::getInstance().removeWidgetModal(*widget);
+						(*widget)->setVisible(false);
+					}
+
+					instance->pooled = true;
+					mPoolStatistics.releaseCount ++;
+					return;
+				}
+
+				mPoolStatistics.destroyCount ++;
+			}
+		}
+
+		WidgetManager::getInstance().destroyWidgets(_widgets);
+	}
+
+	VectorWidgetPtr LayoutManager::loadPooledLayout(LayoutPool* _pool, const std::string& _prefix, Widget* _parent)
+	{
+		for (VectorPoolInstance::iterator iter = _pool->instances.begin(); iter != _pool->instances.end(); ++iter)
+		{
+			PoolInstance* instance = *iter;
+			if (!instance->pooled || instance->parent != _parent || instance->prefix != _prefix)
+				continue;
+
+			// отцы идут раньше детей, относительные координаты детей считаются от уже сброшенных отцов
+			for (size_t index = 0; index < instance->items.size(); ++index)
+			{
+				Widget* widget = instance->items[index].first;
+				ResourceLayout::_resetWidgetItem(*instance->items[index].second, widget, widget->getParent());
+			}
+
+			// контроллеры как при создании, дети раньше отцов
+			for (size_t index = instance->items.size(); index != 0; --index)
+				ResourceLayout::_createControllers(*instance->items[index - 1].second, instance->items[index - 1].first);
+
+			instance->pooled = false;
+			mPoolStatistics.hitCount ++;
+			return instance->widgets;
+		}
+
+		PoolInstance* instance = new PoolInstance();
+		instance->prefix = _prefix;
+		instance->parent = _parent;
+		instance->pooled = false;
+
+		for (VectorWidgetInfo::const_iterator iter = _pool->data.begin(); iter != _pool->data.end(); ++iter)
+			createPooledWidget(instance, *iter, _prefix, _parent, true);
+
+		for (size_t index = 0; index < instance->items.size(); ++index)
+			mPoolWidgets[instance->items[index].first] = std::make_pair(_pool, instance);
+		_pool->instances.push_back(instance);
+
+		mPoolStatistics.missCount ++;
+		return instance->widgets;
+	}
+
+	void LayoutManager::createPooledWidget(PoolInstance* _instance, const WidgetInfo& _info, const std::string& _prefix, Widget* _parent, bool _root)
+	{
+		Widget* widget = ResourceLayout::_createWidgetItem(_info, _prefix, _parent, false);
+		_instance->items.push_back(std::make_pair(widget, &_info));
+		if (_root)
+			_instance->widgets.push_back(widget);
+
+		for (VectorWidgetInfo::const_iterator iter = _info.childWidgetsInfo.begin(); iter != _info.childWidgetsInfo.end(); ++iter)
+			createPooledWidget(_instance, *iter, _prefix, widget, false);
+
+		ResourceLayout::_createControllers(_info, widget);
+	}
+
+	void LayoutManager::forgetPoolInstance(LayoutPool* _pool, PoolInstance* _instance)
+	{
+		for (size_t index = 0; index < _instance->items.size(); ++index)
+			mPoolWidgets.erase(_instance->items[index].first);
+
+		_pool->instances.erase(std::find(_pool->instances.begin(), _pool->instances.end(), _instance));
+		delete _instance;
+	}
+
+	void LayoutManager::shrinkPool(LayoutPool* _pool)
+	{
+		size_t count = 0;
+		for (VectorPoolInstance::iterator iter = _pool->instances.begin(); iter != _pool->instances.end(); ++iter)
+		{
+			if ((*iter)->pooled)
+				count ++;
+		}
+
+		while (count > _pool->size)
+		{
+			for (VectorPoolInstance::iterator iter = _pool->instances.begin(); iter != _pool->instances.end(); ++iter)
+			{
+				if ((*iter)->pooled)
+				{
+					// запись об экземпляре удалится при отписке первого удаленного виджета
+					VectorWidgetPtr widgets = (*iter)->widgets;
+					WidgetManager::getInstance().destroyWidgets(widgets);
+					break;
+				}
+			}
+			count --;
+		}
+	}
+
+	void LayoutManager::setLayoutPoolSize(const std::string& _file, size_t _count)
+	{
+		MapLayoutPool::iterator item = mPools.find(_file);
+		if (item == mPools.end())
+		{
+			if (_count == 0)
+				return;
+
+			LayoutPool* pool = new LayoutPool();
+			pool->size = 0;
+			item = mPools.insert(MapLayoutPool::value_type(_file, pool)).first;
+		}
+
+		item->second->size = _count;
+		shrinkPool(item->second);
+	}
+
+	size_t LayoutManager::getLayoutPoolSize(const std::string& _file) const
+	{
+		MapLayoutPool::const_iterator item = mPools.find(_file);
+		return item != mPools.end() ? item->second->size : 0;
+	}
+
+	void LayoutManager::clearLayoutPools()
+	{
+		for (MapLayoutPool::iterator pool = mPools.begin(); pool != mPools.end(); ++pool)
+		{
+			size_t size = pool->second->size;
+			pool->second->size = 0;
+			shrinkPool(pool->second);
+			pool->second->size = size;
+		}
+	}
+
+	const LayoutManager::LayoutPoolStatistics& LayoutManager::getLayoutPoolStatistics() const
+	{
+		return mPoolStatistics;
+	}
+
+	void LayoutManager::resetLayoutPoolStatistics()
+	{
+		mPoolStatistics = LayoutPoolStatistics();
+	}
+
+	ResourceLayout* LayoutManager::findLayout(const std::string& _file)
+	{
 		ResourceLayout* resource = getByName(_file, false);
 		if (!resource)
 		{
@@ -67,20 +294,229 @@ namespace MyGUI
 			resource = getByName(_file, false);
 		}
 
-		VectorWidgetPtr result;
-		if (resource)
-			result = resource->createLayout(_prefix, _parent);
-		else
+		if (!resource)
 			MYGUI_LOG(Warning, "Layout '" << _file << "' couldn't be loaded");
 
+		return resource;
+	}
+
+	size_t LayoutManager::loadLayoutIncremental(const std::string& _file, const std::string& _prefix, Widget* _parent)
+	{
+		mCurrentLayoutName = _file;
+		ResourceLayout* resource = findLayout(_file);
 		mCurrentLayoutName = "";
 
-		return result;
+		if (!resource)
+			return 0;
+
+		Loading* loading = new Loading();
+		loading->handle = ++mLastLoadingHandle;
+		loading->file = _file;
+		loading->prefix = _prefix;
+		loading->parent = _parent;
+		loading->data = resource->getLayoutData();
+		loading->root = 0;
+		mLoadings.push_back(loading);
+
+		updateFrameSubscription();
+
+		return loading->handle;
 	}
 
-	void LayoutManager::unloadLayout(VectorWidgetPtr& _widgets)
+	void LayoutManager::finishLayoutLoading(size_t _handle)
 	{
-		WidgetManager::getInstance().destroyWidgets(_widgets);
+		size_t index = findLoading(_handle);
+		if (index == ITEM_NONE)
+			return;
+
+		Loading* loading = mLoadings[index];
+		while (stepLoading(loading))
+		{
+		}
+		completeLoading(loading);
+	}
+
+	void LayoutManager::cancelLayoutLoading(size_t _handle)
+	{
+		size_t index = findLoading(_handle);
+		if (index == ITEM_NONE)
+			return;
+
+		Loading* loading = mLoadings[index];
+		mLoadings.erase(mLoadings.begin() + index);
+		updateFrameSubscription();
+
+		VectorWidgetPtr widgets;
+		widgets.swap(loading->widgets);
+		delete loading;
+
+		WidgetManager::getInstance().destroyWidgets(widgets);
+	}
+
+	bool LayoutManager::isLayoutLoading(size_t _handle) const
+	{
+		return findLoading(_handle) != ITEM_NONE;
+	}
+
+	void LayoutManager::setLoadingFrameBudget(unsigned long _value)
+	{
+		mLoadingFrameBudget = _value;
+	}
+
+	unsigned long LayoutManager::getLoadingFrameBudget() const
+	{
+		return mLoadingFrameBudget;
+	}
+
+	void LayoutManager::frameEntered(float _time)
+	{
+		Timer timer;
+		timer.reset();
+
+		// загрузки идут по очереди, в событии окончания могут начать или отменить другие
+		while (!mLoadings.empty())
+		{
+			Loading* loading = mLoadings.front();
+			if (!stepLoading(loading))
+				completeLoading(loading);
+
+			if (timer.getMilliseconds() >= mLoadingFrameBudget)
+				break;
+		}
+	}
+
+	bool LayoutManager::stepLoading(Loading* _loading)
+	{
+		mCurrentLayoutName = _loading->file;
+
+		// за один шаг создается один виджет, закрытые уровни проходятся сразу
+		while (true)
+		{
+			if (_loading->stack.empty())
+			{
+				if (_loading->root == _loading->data.size())
+					break;
+
+				LoadingItem item;
+				item.info = &_loading->data[_loading->root++];
+				item.widget = ResourceLayout::_createWidgetItem(*item.info, _loading->prefix, _loading->parent, false);
+				item.child = 0;
+				_loading->stack.push_back(item);
+
+				// до конца загрузки рут скрыт, видимость из лейаута возвращается в конце
+				_loading->widgets.push_back(item.widget);
+				_loading->visible.push_back(item.widget->getVisible());
+				item.widget->setVisible(false);
+
+				mCurrentLayoutName = "";
+				return true;
+			}
+
+			LoadingItem& parent = _loading->stack.back();
+			if (parent.child < parent.info->childWidgetsInfo.size())
+			{
+				LoadingItem item;
+				item.info = &parent.info->childWidgetsInfo[parent.child++];
+				item.widget = ResourceLayout::_createWidgetItem(*item.info, _loading->prefix, parent.widget, false);
+				item.child = 0;
+				_loading->stack.push_back(item);
+
+				mCurrentLayoutName = "";
+				return true;
+			}
+
+			// все дети созданы, контроллеры как и при обычной загрузке в конце
+			LoadingItem item = parent;
+			_loading->stack.pop_back();
+			ResourceLayout::_createControllers(*item.info, item.widget);
+		}
+
+		mCurrentLayoutName = "";
+		return false;
+	}
+
+	void LayoutManager::completeLoading(Loading* _loading)
+	{
+		mLoadings.erase(std::find(mLoadings.begin(), mLoadings.end(), _loading));
+		updateFrameSubscription();
+
+		for (size_t index = 0; index < _loading->widgets.size(); ++index)
+			_loading->widgets[index]->setVisible(_loading->visible[index]);
+
+		size_t handle = _loading->handle;
+		VectorWidgetPtr widgets;
+		widgets.swap(_loading->widgets);
+		delete _loading;
+
+		eventLayoutLoaded(handle, widgets);
+	}
+
+	size_t LayoutManager::findLoading(size_t _handle) const
+	{
+		for (size_t index = 0; index < mLoadings.size(); ++index)
+		{
+			if (mLoadings[index]->handle == _handle)
+				return index;
+		}
+		return ITEM_NONE;
+	}
+
+	void LayoutManager::_unlinkWidget(Widget* _widget)
+	{
+		// экземпляр без любого из своих виджетов уже не может быть переиспользован
+		MapPoolWidget::iterator pooled = mPoolWidgets.find(_widget);
+		if (pooled != mPoolWidgets.end())
+			forgetPoolInstance(pooled->second.first, pooled->second.second);
+
+		for (size_t index = 0; index < mLoadings.size(); /*added in body*/)
+		{
+			Loading* loading = mLoadings[index];
+
+			// виджет на который грузили удален, удалены и все созданные
+			if (loading->parent == _widget)
+			{
+				mLoadings.erase(mLoadings.begin() + index);
+				delete loading;
+				continue;
+			}
+
+			// удаленный виджет и его дети больше не создаются
+			for (size_t item = 0; item < loading->stack.size(); ++item)
+			{
+				if (loading->stack[item].widget == _widget)
+				{
+					loading->stack.resize(item);
+					break;
+				}
+			}
+
+			for (size_t item = 0; item < loading->widgets.size(); ++item)
+			{
+				if (loading->widgets[item] == _widget)
+				{
+					loading->widgets.erase(loading->widgets.begin() + item);
+					loading->visible.erase(loading->visible.begin() + item);
+					break;
+				}
+			}
+
+			++ index;
+		}
+
+		updateFrameSubscription();
+	}
+
+	void LayoutManager::updateFrameSubscription()
+	{
+		bool need = !mLoadings.empty();
+		if (need == mFrameSubscribed)
+			return;
+
+		if (need)
+			Gui::getInstance().eventFrameStart += newDelegate(this, &LayoutManager::frameEntered);
+		else
+			Gui::getInstance().eventFrameStart -= newDelegate(this, &LayoutManager::frameEntered);
+		mFrameSubscribed = need;
 	}
 
 	ResourceLayout* LayoutManager::getByName(const std::string& _name, bool _throw) const
@@ -24,6 +24,11 @@ namespace MyGUI
 		return mLevel <= _level;
 	}
 
+	bool LevelLogFilter::isLevelEnabled(LogLevel _level)
+	{
+		return mLevel <= _level;
+	}
+
 	void LevelLogFilter::setLoggingLevel(LogLevel _value)
 	{
 		mLevel = _value;
@@ -8,6 +8,7 @@
 #include "MyGUI_LogManager.h"
 #include "MyGUI_FileLogListener.h"
 #include "MyGUI_ConsoleLogListener.h"
+#include "MyGUI_AsyncLogListener.h"
 #include "MyGUI_LevelLogFilter.h"
 #include "MyGUI_LogSource.h"
 #include <time.h>
@@ -21,10 +22,14 @@ namespace MyGUI
 		mConsole(nullptr),
 		mFile(nullptr),
 		mFilter(nullptr),
+		mAsync(nullptr),
 		mDefaultSource(nullptr),
 		mLevel(LogLevel::Info),
-		mConsoleEnable(true)
+		mConsoleEnable(true),
+		mAsyncEnable(false),
+		mLastTime(0)
 	{
+		memset(&mCurrentTime, 0, sizeof(mCurrentTime));
 		msInstance = this;
 	}
 
@@ -35,6 +40,8 @@ namespace MyGUI
 
 		delete mDefaultSource;
 		mDefaultSource = nullptr;
+		delete mAsync;
+		mAsync = nullptr;
 		delete mConsole;
 		mConsole = nullptr;
 		delete mFile;
@@ -68,13 +75,27 @@ namespace MyGUI
 
 	void LogManager::log(const std::string& _section, LogLevel _level, const std::string& _message, const char* _file, int _line)
 	{
+		// localtime пересчитываем только при смене секунды
 		time_t ctTime;
 		time(&ctTime);
-		struct tm* currentTime;
-		currentTime = localtime(&ctTime);
+		if (ctTime != mLastTime)
+		{
+			mLastTime = ctTime;
+			mCurrentTime = *localtime(&ctTime);
+		}
 
 		for (VectorLogSource::iterator item = mSources.begin(); item != mSources.end(); ++item)
-			(*item)->log(_section, _level, currentTime, _message, _file, _line);
+			(*item)->log(_section, _level, &mCurrentTime, _message, _file, _line);
+	}
+
+	bool LogManager::isLevelEnabled(LogLevel _level) const
+	{
+		for (VectorLogSource::const_iterator item = mSources.begin(); item != mSources.end(); ++item)
+		{
+			if ((*item)->isLevelEnabled(_level))
+				return true;
+		}
+		return false;
 	}
 
 	void LogManager::close()
@@ -99,8 +120,18 @@ namespace MyGUI
 		mFilter->setLoggingLevel(mLevel);
 
 		mDefaultSource = new LogSource();
-		mDefaultSource->addLogListener(mFile);
-		mDefaultSource->addLogListener(mConsole);
+		if (mAsyncEnable)
+		{
+			mAsync = new AsyncLogListener();
+			mAsync->addLogListener(mFile);
+			mAsync->addLogListener(mConsole);
+			mDefaultSource->addLogListener(mAsync);
+		}
+		else
+		{
+			mDefaultSource->addLogListener(mFile);
+			mDefaultSource->addLogListener(mConsole);
+		}
 		mDefaultSource->setLogFilter(mFilter);
 
 		mDefaultSource->open();
@@ -134,4 +165,15 @@ namespace MyGUI
 		return mLevel;
 	}
 
+	void LogManager::setAsyncOutputEnabled(bool _value)
+	{
+		MYGUI_ASSERT(mDefaultSource == nullptr, "setAsyncOutputEnabled must be called before createDefaultSource");
+		mAsyncEnable = _value;
+	}
+
+	bool LogManager::getAsyncOutputEnabled() const
+	{
+		return mAsyncEnable;
+	}
+
 } // namespace MyGUI
@@ -59,4 +59,9 @@ namespace MyGUI
 			(*listener)->log(_section, _level, _time, _message, _file, _line);
 	}
 
+	bool LogSource::isLevelEnabled(LogLevel _level) const
+	{
+		return mFilter == nullptr || mFilter->isLevelEnabled(_level);
+	}
+
 } // namespace MyGUI
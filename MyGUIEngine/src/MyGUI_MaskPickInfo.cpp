@@ -6,77 +6,107 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_MaskPickInfo.h"
-#include "MyGUI_ResourceManager.h"
-#include "MyGUI_RenderManager.h"
-#include "MyGUI_DataManager.h"
+#include "MyGUI_MaskPickManager.h"
 
 namespace MyGUI
 {
 
 	MaskPickInfo::MaskPickInfo() :
-		mWidth(0),
-		mHeight(0)
+		mData(nullptr)
 	{
 	}
 
-	bool MaskPickInfo::load(const std::string& _file)
+	MaskPickInfo::MaskPickInfo(Data* _data) :
+		mData(_data)
 	{
-		if (!DataManager::getInstance().isDataExist(_file))
-			return false;
-
-		RenderManager& render = RenderManager::getInstance();
-		ITexture* texture = render.createTexture(_file);
-		texture->loadFromFile(_file);
-
-		uint8* buffer = (uint8*)texture->lock(TextureUsage::Read);
-		if (buffer == 0)
-		{
-			render.destroyTexture(texture);
-			return false;
-		}
+		if (mData != nullptr)
+			mData->refCount ++;
+	}
 
-		size_t pixel_size = texture->getNumElemBytes();
+	MaskPickInfo::MaskPickInfo(const MaskPickInfo& _other) :
+		mData(_other.mData)
+	{
+		if (mData != nullptr)
+			mData->refCount ++;
+	}
 
-		mWidth = texture->getWidth();
-		mHeight = texture->getHeight();
-		size_t size = mWidth * mHeight;
-		mData.resize(size);
+	MaskPickInfo::~MaskPickInfo()
+	{
+		release();
+	}
 
-		size_t pos = 0;
-		for (size_t pos_pix = 0; pos_pix < size; pos_pix++)
+	MaskPickInfo& MaskPickInfo::operator = (const MaskPickInfo& _other)
+	{
+		if (mData != _other.mData)
 		{
-			bool white = true;
-			for (size_t in_pix = 0; in_pix < pixel_size; in_pix++)
-			{
-				if (0xFF != buffer[pos])
-				{
-					white = false;
-				}
-				pos++;
-			}
-
-			mData[pos_pix] = white;
+			release();
+			mData = _other.mData;
+			if (mData != nullptr)
+				mData->refCount ++;
 		}
+		return *this;
+	}
 
-		texture->unlock();
-		render.destroyTexture(texture);
+	void MaskPickInfo::release()
+	{
+		if (mData == nullptr)
+			return;
+
+		MYGUI_DEBUG_ASSERT(mData->refCount != 0, "mask released twice");
+		mData->refCount --;
+		if (mData->refCount == 0)
+			MaskPickManager::_release(mData);
+		mData = nullptr;
+	}
 
+	bool MaskPickInfo::load(const std::string& _file)
+	{
+		MaskPickInfo info = MaskPickManager::getInstance().getMaskPick(_file);
+		if (info.empty())
+			return false;
+
+		*this = info;
 		return true;
 	}
 
 	bool MaskPickInfo::pick(const IntPoint& _point, const IntCoord& _coord) const
 	{
-		if ((0 == _coord.width) || (0 == _coord.height)) return false;
+		if ((0 == _coord.width) || (0 == _coord.height) || (mData == nullptr)) return false;
 
-		int x = ((_point.left * mWidth) - 1) / _coord.width;
-		int y = ((_point.top * mHeight) - 1) / _coord.height;
+		int x = ((_point.left * mData->width) - 1) / _coord.width;
+		int y = ((_point.top * mData->height) - 1) / _coord.height;
 
-		return 0 != mData[(size_t)(y * mWidth + x)];
+		// на левой и верхней границе получается -1
+		if (x < 0) x = 0;
+		else if (x >= mData->width) x = mData->width - 1;
+		if (y < 0) y = 0;
+		else if (y >= mData->height) y = mData->height - 1;
+
+		uint8 cell = mData->cells[(size_t)((y >> CellShift) * mData->gridWidth + (x >> CellShift))];
+		if (cell != CellMixed)
+			return cell == CellFull;
+
+		return 0 != ((mData->bits[(size_t)y * mData->rowWords + (x >> 5)] >> (x & 31)) & 1);
 	}
 
 	bool MaskPickInfo::empty() const
 	{
-		return mData.empty();
+		return mData == nullptr;
+	}
+
+	int MaskPickInfo::getWidth() const
+	{
+		return mData != nullptr ? mData->width : 0;
+	}
+
+	int MaskPickInfo::getHeight() const
+	{
+		return mData != nullptr ? mData->height : 0;
+	}
+
+	const MaskPickInfo::Data* MaskPickInfo::_getData() const
+	{
+		return mData;
 	}
 
 } // namespace MyGUI
@@ -0,0 +1,208 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_MaskPickManager.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_DataManager.h"
+#include "MyGUI_ITexture.h"
+
+namespace MyGUI
+{
+
+	template <> MaskPickManager* Singleton<MaskPickManager>::msInstance = nullptr;
+	template <> const char* Singleton<MaskPickManager>::mClassTypeName = "MaskPickManager";
+
+	MaskPickManager::MaskPickManager() :
+		mLoadCount(0),
+		mIsInitialise(false)
+	{
+	}
+
+	void MaskPickManager::initialise()
+	{
+		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
+		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
+	}
+
+	void MaskPickManager::shutdown()
+	{
+		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
+		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
+
+		// оставшиеся маски удалит последняя использующая их копия
+		for (MapData::iterator item = mData.begin(); item != mData.end(); ++item)
+			item->second->orphan = true;
+		mData.clear();
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
+	}
+
+	MaskPickInfo MaskPickManager::getMaskPick(const std::string& _file)
+	{
+		MapData::iterator item = mData.find(_file);
+		if (item != mData.end())
+			return MaskPickInfo(item->second);
+
+		MaskPickInfo::Data* data = loadData(_file);
+		if (data == nullptr)
+			return MaskPickInfo();
+
+		data->file = _file;
+		mData[_file] = data;
+
+		return MaskPickInfo(data);
+	}
+
+	size_t MaskPickManager::getMaskCount() const
+	{
+		return mData.size();
+	}
+
+	size_t MaskPickManager::getDataSize() const
+	{
+		size_t result = 0;
+		for (MapData::const_iterator item = mData.begin(); item != mData.end(); ++item)
+			result += sizeof(MaskPickInfo::Data) + item->second->bits.size() * sizeof(uint32) + item->second->cells.size();
+		return result;
+	}
+
+	size_t MaskPickManager::getLoadCount() const
+	{
+		return mLoadCount;
+	}
+
+	void MaskPickManager::_release(MaskPickInfo::Data* _data)
+	{
+		if (_data->orphan)
+			delete _data;
+		else
+			getInstance().removeData(_data);
+	}
+
+	void MaskPickManager::removeData(MaskPickInfo::Data* _data)
+	{
+		mData.erase(_data->file);
+		delete _data;
+	}
+
+	MaskPickInfo::Data* MaskPickManager::loadData(const std::string& _file)
+	{
+		if (!DataManager::getInstance().isDataExist(_file))
+			return nullptr;
+
+		mLoadCount ++;
+
+		// декодируем без создания текстуры, если умеем
+		if (!eventDecodeImage.empty())
+		{
+			IntSize size;
+			PixelFormat format;
+			std::vector<uint8> pixels;
+			eventDecodeImage(_file, size, format, pixels);
+
+			size_t pixel_size = 0;
+			if (format == PixelFormat::L8)
+				pixel_size = 1;
+			else if (format == PixelFormat::L8A8)
+				pixel_size = 2;
+			else if (format == PixelFormat::R8G8B8)
+				pixel_size = 3;
+			else if (format == PixelFormat::R8G8B8A8)
+				pixel_size = 4;
+
+			if (pixel_size != 0 && size.width > 0 && size.height > 0 && pixels.size() >= (size_t)size.width * size.height * pixel_size)
+				return createData(&pixels[0], size.width, size.height, pixel_size);
+		}
+
+		RenderManager& render = RenderManager::getInstance();
+		ITexture* texture = render.createTexture(_file);
+		texture->loadFromFile(_file);
+
+		uint8* buffer = (uint8*)texture->lock(TextureUsage::Read);
+		if (buffer == 0)
+		{
+			render.destroyTexture(texture);
+			return nullptr;
+		}
+
+		MaskPickInfo::Data* data = createData(buffer, texture->getWidth(), texture->getHeight(), texture->getNumElemBytes());
+
+		texture->unlock();
+		render.destroyTexture(texture);
+
+		return data;
+	}
+
+	MaskPickInfo::Data* MaskPickManager::createData(const uint8* _pixels, int _width, int _height, size_t _pixelSize)
+	{
+		MaskPickInfo::Data* data = new MaskPickInfo::Data();
+		data->width = _width;
+		data->height = _height;
+		data->rowWords = ((size_t)_width + 31) / 32;
+		data->bits.resize(data->rowWords * _height, 0);
+		data->refCount = 0;
+		data->orphan = false;
+
+		const uint8* pixel = _pixels;
+		for (int y = 0; y < _height; ++y)
+		{
+			uint32* row = &data->bits[(size_t)y * data->rowWords];
+			for (int x = 0; x < _width; ++x)
+			{
+				// доступны только полностью белые пиксели
+				bool white = true;
+				for (size_t index = 0; index < _pixelSize; ++index)
+				{
+					if (0xFF != pixel[index])
+						white = false;
+				}
+				pixel += _pixelSize;
+
+				if (white)
+					row[x >> 5] |= (uint32)1 << (x & 31);
+			}
+		}
+
+		data->gridWidth = (_width + MaskPickInfo::CellSize - 1) >> MaskPickInfo::CellShift;
+		data->gridHeight = (_height + MaskPickInfo::CellSize - 1) >> MaskPickInfo::CellShift;
+		data->cells.resize((size_t)data->gridWidth * data->gridHeight);
+
+		for (int cellY = 0; cellY < data->gridHeight; ++cellY)
+		{
+			for (int cellX = 0; cellX < data->gridWidth; ++cellX)
+			{
+				int left = cellX << MaskPickInfo::CellShift;
+				int top = cellY << MaskPickInfo::CellShift;
+				int right = (std::min)(left + (int)MaskPickInfo::CellSize, _width);
+				int bottom = (std::min)(top + (int)MaskPickInfo::CellSize, _height);
+
+				size_t count = 0;
+				for (int y = top; y < bottom; ++y)
+				{
+					const uint32* row = &data->bits[(size_t)y * data->rowWords];
+					for (int x = left; x < right; ++x)
+						count += (row[x >> 5] >> (x & 31)) & 1;
+				}
+
+				size_t total = (size_t)(right - left) * (bottom - top);
+				uint8 state = MaskPickInfo::CellMixed;
+				if (count == 0)
+					state = MaskPickInfo::CellEmpty;
+				else if (count == total)
+					state = MaskPickInfo::CellFull;
+				data->cells[(size_t)cellY * data->gridWidth + cellX] = state;
+			}
+		}
+
+		return data;
+	}
+
+} // namespace MyGUI
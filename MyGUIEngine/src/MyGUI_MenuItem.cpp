@@ -72,6 +72,11 @@ namespace MyGUI
 		mOwner->_notifyUpdateName(this);
 	}
 
+	void MenuItem::setCaptionUTF8(const std::string& _value)
+	{
+		setCaption(UString(_value));
+	}
+
 	void MenuItem::setFontName(const std::string& _value)
 	{
 		Button::setFontName(_value);
@@ -34,6 +34,11 @@ namespace MyGUI
 			Base::setCaption(_value);
 	}
 
+	void MultiListItem::setCaptionUTF8(const std::string& _value)
+	{
+		setCaption(UString(_value));
+	}
+
 	const UString& MultiListItem::getCaption()
 	{
 		MultiListBox* owner = getOwner();
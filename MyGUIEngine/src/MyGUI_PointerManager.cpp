@@ -255,7 +255,7 @@ namespace MyGUI
 
 	void PointerManager::notifyChangeMouseFocus(Widget* _widget)
 	{
-		std::string pointer = (_widget == nullptr || !_widget->getInheritedEnabled()) ? "" : _widget->getPointer();
+		StringId pointer = (_widget == nullptr || !_widget->getInheritedEnabled()) ? StringId() : _widget->_getPointerId();
 		if (pointer != mCurrentMousePointer)
 		{
 			mCurrentMousePointer = pointer;
@@ -266,8 +266,8 @@ namespace MyGUI
 			}
 			else
 			{
-				setPointer(mCurrentMousePointer, _widget);
-				eventChangeMousePointer(mCurrentMousePointer);
+				setPointer(mCurrentMousePointer.toString(), _widget);
+				eventChangeMousePointer(mCurrentMousePointer.toString());
 			}
 		}
 	}
@@ -11,12 +11,13 @@
 #include "MyGUI_Gui.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_DataManager.h"
+#include "MyGUI_TextureMemoryManager.h"
 #include "MyGUI_RenderManager.h"
 
 namespace MyGUI
 {
 
-	RenderItem::RenderItem() :
+	RenderItem::RenderItem(LayerNode* _owner) :
 		mTexture(nullptr),
 		mNeedVertexCount(0),
 		mOutOfDate(false),
@@ -27,14 +28,15 @@ namespace MyGUI
 		mVertexBuffer(nullptr),
 		mRenderTarget(nullptr),
 		mNeedCompression(false),
-		mManualRender(false)
+		mManualRender(false),
+		mOwner(_owner)
 	{
-		mVertexBuffer = RenderManager::getInstance().createVertexBuffer();
+		mVertexBuffer = RenderManager::getInstance()._createItemVertexBuffer();
 	}
 
 	RenderItem::~RenderItem()
 	{
-		RenderManager::getInstance().destroyVertexBuffer(mVertexBuffer);
+		RenderManager::getInstance()._destroyItemVertexBuffer(mVertexBuffer);
 		mVertexBuffer = nullptr;
 	}
 
@@ -47,8 +49,29 @@ namespace MyGUI
 
 		mCurrentUpdate = _update;
 
+		// нод мог сдвинуться целиком, тогда вершины сдвигаются трансляцией или пересчитываются
+		IntPoint shift = mOwner != nullptr ? mOwner->getOriginShift() : IntPoint();
+		IntPoint origin = mVertexOrigin + shift - mOriginShift;
+		bool translate = !mManualRender && LayerManager::getInstance().getNodeTranslation() && _target->isTranslationSupported();
+
+		if (!translate && origin != IntPoint())
+			mOutOfDate = true;
+
 		if (mOutOfDate || _update)
 		{
+			IntPoint vertexOrigin = (translate && mOwner != nullptr) ? mOwner->getOrigin() : IntPoint();
+			// геометрию, закешированную относительно старого начала координат, нужно пересчитать
+			if (vertexOrigin != origin)
+				correctDrawItems();
+
+			mVertexOrigin = vertexOrigin;
+			mOriginShift = shift;
+			origin = vertexOrigin;
+
+			mRenderTargetInfo = _target->getInfo();
+			mRenderTargetInfo.leftOffset += mVertexOrigin.left;
+			mRenderTargetInfo.topOffset += mVertexOrigin.top;
+
 			mCountVertex = 0;
 			Vertex* buffer = mVertexBuffer->lock();
 			if (buffer != nullptr)
@@ -67,9 +90,11 @@ namespace MyGUI
 					mCountVertex += mLastVertexCount;
 				}
 
+				mVertexBuffer->setWrittenVertexCount(mCountVertex);
 				mVertexBuffer->unlock();
 			}
 
+			LayerManager::getInstance()._notifyVertexesGenerated(mCountVertex);
 			mOutOfDate = false;
 		}
 
@@ -84,12 +109,23 @@ namespace MyGUI
 				return;
 			}
 #endif
+			// выгруженная по бюджету текстура загружается снова
+			if (mTexture != nullptr)
+				TextureMemoryManager::getInstance().touchTexture(mTexture);
+
 			// непосредственный рендринг
 			if (mManualRender)
 			{
 				for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
 					(*iter).first->doManualRender(mVertexBuffer, mTexture, mCountVertex);
 			}
+			else if (origin != IntPoint())
+			{
+				const RenderTargetInfo& info = _target->getInfo();
+				_target->setTranslation(info.pixScaleX * (float)origin.left * 2, -info.pixScaleY * (float)origin.top * 2);
+				_target->doRender(mVertexBuffer, mTexture, mCountVertex);
+				_target->setTranslation(0, 0);
+			}
 			else
 			{
 				_target->doRender(mVertexBuffer, mTexture, mCountVertex);
@@ -99,13 +135,15 @@ namespace MyGUI
 
 	void RenderItem::removeDrawItem(ISubWidget* _item)
 	{
-		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
+		// ищем с конца, виджеты обычно удаляются в обратном порядке создания
+		// и удаление с конца вектора не сдвигает остальные элементы
+		for (VectorDrawItem::reverse_iterator iter = mDrawItems.rbegin(); iter != mDrawItems.rend(); ++iter)
 		{
 			if ((*iter).first == _item)
 			{
 				mNeedVertexCount -= (*iter).second;
-				mDrawItems.erase(iter);
-				mOutOfDate = true;
+				mDrawItems.erase(--iter.base());
+				outOfDate();
 
 				mVertexBuffer->setVertexCount(mNeedVertexCount);
 
@@ -135,7 +173,7 @@ namespace MyGUI
 
 		mDrawItems.push_back(DrawItemInfo(_item, _count));
 		mNeedVertexCount += _count;
-		mOutOfDate = true;
+		outOfDate();
 
 		mVertexBuffer->setVertexCount(mNeedVertexCount);
 	}
@@ -152,7 +190,7 @@ namespace MyGUI
 					mNeedVertexCount -= (*iter).second;
 					mNeedVertexCount += _count;
 					(*iter).second = _count;
-					mOutOfDate = true;
+					outOfDate();
 
 					mVertexBuffer->setVertexCount(mNeedVertexCount);
 				}
@@ -205,6 +243,8 @@ namespace MyGUI
 	void RenderItem::outOfDate()
 	{
 		mOutOfDate = true;
+		if (mOwner != nullptr)
+			mOwner->outOfDate(nullptr);
 	}
 
 	bool RenderItem::isOutOfDate() const
@@ -242,4 +282,20 @@ namespace MyGUI
 		return mRenderTarget;
 	}
 
+	const RenderTargetInfo& RenderItem::getRenderTargetInfo() const
+	{
+		return mRenderTargetInfo;
+	}
+
+	const IntPoint& RenderItem::getVertexOrigin() const
+	{
+		return mVertexOrigin;
+	}
+
+	void RenderItem::correctDrawItems()
+	{
+		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
+			(*iter).first->_correctView();
+	}
+
 } // namespace MyGUI
@@ -8,6 +8,7 @@
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_LayerManager.h"
+#include "MyGUI_FrameSnapshot.h"
 
 namespace MyGUI
 {
@@ -15,6 +16,11 @@ namespace MyGUI
 	template <> RenderManager* Singleton<RenderManager>::msInstance = nullptr;
 	template <> const char* Singleton<RenderManager>::mClassTypeName = "RenderManager";
 
+	RenderManager::RenderManager() :
+		mFrameSnapshotMode(false)
+	{
+	}
+
 	bool RenderManager::isFormatSupported(PixelFormat _format, TextureUsage _usage)
 	{
 		return true;
@@ -27,6 +33,136 @@ namespace MyGUI
 	}
 #endif
 
+	void RenderManager::setFrameSnapshotMode(bool _value)
+	{
+		MYGUI_ASSERT(Gui::getInstancePtr() == nullptr, "Frame snapshot mode must be set before Gui is created");
+		mFrameSnapshotMode = _value;
+	}
+
+	bool RenderManager::getFrameSnapshotMode() const
+	{
+		return mFrameSnapshotMode;
+	}
+
+	IVertexBuffer* RenderManager::_createItemVertexBuffer()
+	{
+		if (mFrameSnapshotMode)
+			return new FrameSnapshotVertexBuffer();
+		return createVertexBuffer();
+	}
+
+	void RenderManager::_destroyItemVertexBuffer(IVertexBuffer* _buffer)
+	{
+		if (mFrameSnapshotMode)
+		{
+			// поток рендера держит свою копию вершин этого буфера, сообщаем о его удалении
+			mReleasedItemBuffers.push_back(_buffer);
+			delete _buffer;
+		}
+		else
+		{
+			destroyVertexBuffer(_buffer);
+		}
+	}
+
+	void RenderManager::_takeReleasedItemVertexBuffers(std::vector<const IVertexBuffer*>& _result)
+	{
+		_result.insert(_result.end(), mReleasedItemBuffers.begin(), mReleasedItemBuffers.end());
+		mReleasedItemBuffers.clear();
+	}
+
+	void RenderManager::_pinTexture(ITexture* _texture)
+	{
+		mPinnedTextures[_texture].pins ++;
+	}
+
+	void RenderManager::_unpinTexture(ITexture* _texture)
+	{
+		MapPinnedTexture::iterator item = mPinnedTextures.find(_texture);
+		MYGUI_ASSERT(item != mPinnedTextures.end() && item->second.pins != 0, "Texture is not pinned");
+
+		item->second.pins --;
+		if (item->second.pins != 0)
+			return;
+
+		bool destroy = item->second.destroy;
+		mPinnedTextures.erase(item);
+		if (destroy)
+			destroyTexture(_texture);
+	}
+
+	bool RenderManager::_isTexturePinned(ITexture* _texture) const
+	{
+		MapPinnedTexture::const_iterator item = mPinnedTextures.find(_texture);
+		return item != mPinnedTextures.end() && item->second.pins != 0;
+	}
+
+	void RenderManager::_destroyTextureDeferred(ITexture* _texture)
+	{
+		for (VectorTextureWrite::iterator item = mTextureWrites.begin(); item != mTextureWrites.end(); )
+		{
+			if ((*item).texture == _texture)
+				item = mTextureWrites.erase(item);
+			else
+				++item;
+		}
+
+		MapPinnedTexture::iterator item = mPinnedTextures.find(_texture);
+		if (item != mPinnedTextures.end() && item->second.pins != 0)
+			item->second.destroy = true;
+		else
+			destroyTexture(_texture);
+	}
+
+	void RenderManager::_writeTextureDeferred(ITexture* _texture, const IntRect& _rect, const uint8* _data)
+	{
+		// копируем только строки области, исходное изображение размером с текстуру
+		size_t elemBytes = _texture->getNumElemBytes();
+		size_t pitch = (size_t)_texture->getWidth() * elemBytes;
+		size_t rowBytes = (size_t)_rect.width() * elemBytes;
+
+		mTextureWrites.push_back(TextureWrite());
+		TextureWrite& write = mTextureWrites.back();
+		write.texture = _texture;
+		write.rect = _rect;
+		write.data.resize(rowBytes * (size_t)_rect.height());
+		for (int row = 0; row < _rect.height(); ++row)
+		{
+			const uint8* source = _data + (size_t)(_rect.top + row) * pitch + (size_t)_rect.left * elemBytes;
+			std::copy(source, source + rowBytes, write.data.begin() + (size_t)row * rowBytes);
+		}
+	}
+
+	void RenderManager::_flushDeferredTextureWrites()
+	{
+		for (VectorTextureWrite::const_iterator item = mTextureWrites.begin(); item != mTextureWrites.end(); ++item)
+			applyTextureWrite(*item);
+		mTextureWrites.clear();
+	}
+
+	void RenderManager::applyTextureWrite(const TextureWrite& _write)
+	{
+		ITexture* texture = _write.texture;
+		bool whole = _write.rect.left == 0 && _write.rect.top == 0 &&
+			_write.rect.width() == texture->getWidth() && _write.rect.height() == texture->getHeight();
+
+		// оба варианта блокировки возвращают указатель на начало текстуры
+		uint8* data = reinterpret_cast<uint8*>(whole ? texture->lock(TextureUsage::Write) : texture->lockRegion(_write.rect));
+		if (data == nullptr)
+			return;
+
+		size_t elemBytes = texture->getNumElemBytes();
+		size_t pitch = (size_t)texture->getWidth() * elemBytes;
+		size_t rowBytes = (size_t)_write.rect.width() * elemBytes;
+		for (int row = 0; row < _write.rect.height(); ++row)
+		{
+			std::vector<uint8>::const_iterator source = _write.data.begin() + (size_t)row * rowBytes;
+			std::copy(source, source + rowBytes, data + (size_t)(_write.rect.top + row) * pitch + (size_t)_write.rect.left * elemBytes);
+		}
+
+		texture->unlock();
+	}
+
 	void RenderManager::onResizeView(const IntSize& _viewSize)
 	{
 		LayerManager* layers = LayerManager::getInstancePtr();
@@ -41,6 +177,13 @@ namespace MyGUI
 			layers->renderToTarget(_target, _update);
 	}
 
+	void RenderManager::onRenderToDrawList(DrawList* _list, bool _update)
+	{
+		LayerManager* layers = LayerManager::getInstancePtr();
+		if (layers != nullptr)
+			layers->renderToDrawList(_list, _update);
+	}
+
 	void RenderManager::onFrameEvent(float _time)
 	{
 		Gui* gui = Gui::getInstancePtr();
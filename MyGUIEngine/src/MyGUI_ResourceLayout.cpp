@@ -12,15 +12,28 @@
 #include "MyGUI_LayoutManager.h"
 #include "MyGUI_Widget.h"
 #include "MyGUI_Gui.h"
+#include "MyGUI_WidgetManager.h"
+#include "MyGUI_FactoryManager.h"
+#include "MyGUI_ResourceManager.h"
+#include "MyGUI_LayerManager.h"
+#include "MyGUI_ILayer.h"
 
 namespace MyGUI
 {
 
-	ResourceLayout::ResourceLayout()
+	ResourceLayout::ResourceLayout() :
+		mCompiled(false),
+		mCompiledActual(false),
+		mFactoryChangeCount(0),
+		mResourceChangeCount(0)
 	{
 	}
 
-	ResourceLayout::ResourceLayout(xml::ElementPtr _node, const std::string& _fileName)
+	ResourceLayout::ResourceLayout(xml::ElementPtr _node, const std::string& _fileName) :
+		mCompiled(false),
+		mCompiledActual(false),
+		mFactoryChangeCount(0),
+		mResourceChangeCount(0)
 	{
 		// FIXME hardcoded version
 		deserialization(_node, Version(1, 0, 0));
@@ -33,6 +46,10 @@ namespace MyGUI
 
 		mLayoutData.clear();
 
+		// план ссылается на старые данные
+		mCompiledWidgets.clear();
+		mCompiledActual = false;
+
 		xml::ElementEnumerator widget = _node->getElementEnumerator();
 		while (widget.next("Widget"))
 			mLayoutData.push_back(parseWidget(widget));
@@ -102,6 +119,17 @@ namespace MyGUI
 	{
 		VectorWidgetPtr widgets;
 
+		if (mCompiled)
+		{
+			updateCompiled();
+
+			size_t index = 0;
+			while (index < mCompiledWidgets.size())
+				widgets.push_back(createCompiledWidget(index, _prefix, _parent));
+
+			return widgets;
+		}
+
 		for (VectorWidgetInfo::iterator iter = mLayoutData.begin(); iter != mLayoutData.end(); ++iter)
 		{
 			Widget* widget = createWidget(*iter, _prefix, _parent);
@@ -112,6 +140,20 @@ namespace MyGUI
 	}
 
 	Widget* ResourceLayout::createWidget(const WidgetInfo& _widgetInfo, const std::string& _prefix, Widget* _parent, bool _template)
+	{
+		Widget* wid = _createWidgetItem(_widgetInfo, _prefix, _parent, _template);
+
+		for (VectorWidgetInfo::const_iterator iter = _widgetInfo.childWidgetsInfo.begin(); iter != _widgetInfo.childWidgetsInfo.end(); ++iter)
+		{
+			createWidget(*iter, _prefix, wid);
+		}
+
+		_createControllers(_widgetInfo, wid);
+
+		return wid;
+	}
+
+	Widget* ResourceLayout::_createWidgetItem(const WidgetInfo& _widgetInfo, const std::string& _prefix, Widget* _parent, bool _template)
 	{
 		std::string widgetName = _widgetInfo.name;
 		WidgetStyle style = _widgetInfo.style;
@@ -125,15 +167,7 @@ namespace MyGUI
 			MYGUI_LOG(Warning, "Root widget's layer is not specified, widget won't be visible. Specify layer or parent or attach it to another widget after load." << " [" << LayoutManager::getInstance().getCurrentLayout() << "]");
 		}
 
-		IntCoord coord;
-		if (_widgetInfo.positionType == WidgetInfo::Pixels) coord = _widgetInfo.intCoord;
-		else if (_widgetInfo.positionType == WidgetInfo::Relative)
-		{
-			if (_parent == nullptr || style == WidgetStyle::Popup)
-				coord = CoordConverter::convertFromRelative(_widgetInfo.floatCoord, RenderManager::getInstance().getViewSize());
-			else
-				coord = CoordConverter::convertFromRelative(_widgetInfo.floatCoord, _parent->getClientCoord().size());
-		}
+		IntCoord coord = _getWidgetCoord(_widgetInfo, _parent);
 
 		Widget* wid;
 		if (nullptr == _parent)
@@ -155,11 +189,55 @@ namespace MyGUI
 				LayoutManager::getInstance().eventAddUserString(wid, iter->first, iter->second);
 		}
 
-		for (VectorWidgetInfo::const_iterator iter = _widgetInfo.childWidgetsInfo.begin(); iter != _widgetInfo.childWidgetsInfo.end(); ++iter)
+		return wid;
+	}
+
+	void ResourceLayout::_resetWidgetItem(const WidgetInfo& _widgetInfo, Widget* _widget, Widget* _parent)
+	{
+		// корневые и всплывающие виджеты могли быть перенесены в другой слой
+		if (_parent == nullptr || _widgetInfo.style == WidgetStyle::Popup)
 		{
-			createWidget(*iter, _prefix, wid);
+			ILayer* layer = _widget->getLayer();
+			if (!_widgetInfo.layer.empty() && (layer == nullptr || layer->getName() != _widgetInfo.layer))
+				LayerManager::getInstance().attachToLayerNode(_widgetInfo.layer, _widget);
 		}
 
+		_widget->setAlign(_widgetInfo.align);
+		_widget->setCoord(_getWidgetCoord(_widgetInfo, _parent));
+		_widget->setVisible(true);
+		_widget->setEnabled(true);
+		_widget->setAlpha(ALPHA_MAX);
+		_widget->setUserData(Any::Null);
+
+		for (VectorStringPairs::const_iterator iter = _widgetInfo.properties.begin(); iter != _widgetInfo.properties.end(); ++iter)
+		{
+			_widget->setProperty(iter->first, iter->second);
+		}
+
+		_widget->clearUserStrings();
+		for (MapString::const_iterator iter = _widgetInfo.userStrings.begin(); iter != _widgetInfo.userStrings.end(); ++iter)
+		{
+			_widget->setUserString(iter->first, iter->second);
+			LayoutManager::getInstance().eventAddUserString(_widget, iter->first, iter->second);
+		}
+	}
+
+	IntCoord ResourceLayout::_getWidgetCoord(const WidgetInfo& _widgetInfo, Widget* _parent)
+	{
+		IntCoord coord;
+		if (_widgetInfo.positionType == WidgetInfo::Pixels) coord = _widgetInfo.intCoord;
+		else if (_widgetInfo.positionType == WidgetInfo::Relative)
+		{
+			if (_parent == nullptr || _widgetInfo.style == WidgetStyle::Popup)
+				coord = CoordConverter::convertFromRelative(_widgetInfo.floatCoord, RenderManager::getInstance().getViewSize());
+			else
+				coord = CoordConverter::convertFromRelative(_widgetInfo.floatCoord, _parent->getClientCoord().size());
+		}
+		return coord;
+	}
+
+	void ResourceLayout::_createControllers(const WidgetInfo& _widgetInfo, Widget* _widget)
+	{
 		for (std::vector<ControllerInfo>::const_iterator iter = _widgetInfo.controllers.begin(); iter != _widgetInfo.controllers.end(); ++iter)
 		{
 			MyGUI::ControllerItem* item = MyGUI::ControllerManager::getInstance().createItem(iter->type);
@@ -169,13 +247,114 @@ namespace MyGUI
 				{
 					item->setProperty(iterProp->first, iterProp->second);
 				}
-				MyGUI::ControllerManager::getInstance().addItem(wid, item);
+				MyGUI::ControllerManager::getInstance().addItem(_widget, item);
 			}
 			else
 			{
 				MYGUI_LOG(Warning, "Controller '" << iter->type << "' not found");
 			}
 		}
+	}
+
+	void ResourceLayout::compile()
+	{
+		mCompiled = true;
+		mCompiledActual = false;
+		updateCompiled();
+	}
+
+	bool ResourceLayout::isCompiled() const
+	{
+		return mCompiled;
+	}
+
+	void ResourceLayout::updateCompiled()
+	{
+		// найденные фабрики и скины могли быть удалены
+		size_t factoryChangeCount = FactoryManager::getInstance().getChangeCount();
+		size_t resourceChangeCount = ResourceManager::getInstance().getChangeCount();
+		if (mCompiledActual && mFactoryChangeCount == factoryChangeCount && mResourceChangeCount == resourceChangeCount)
+			return;
+
+		mCompiledWidgets.clear();
+		for (VectorWidgetInfo::const_iterator iter = mLayoutData.begin(); iter != mLayoutData.end(); ++iter)
+			compileWidget(*iter);
+
+		mFactoryChangeCount = factoryChangeCount;
+		mResourceChangeCount = resourceChangeCount;
+		mCompiledActual = true;
+	}
+
+	void ResourceLayout::compileWidget(const WidgetInfo& _widgetInfo)
+	{
+		size_t index = mCompiledWidgets.size();
+		mCompiledWidgets.push_back(CompiledWidget());
+
+		CompiledWidget& item = mCompiledWidgets.back();
+		item.info = &_widgetInfo;
+		WidgetManager::getInstance().resolveWidgetType(_widgetInfo.type, _widgetInfo.skin, item.type);
+
+		item.properties.reserve(_widgetInfo.properties.size());
+		for (VectorStringPairs::const_iterator iter = _widgetInfo.properties.begin(); iter != _widgetInfo.properties.end(); ++iter)
+		{
+			CompiledProperty property;
+			property.property = &(*iter);
+			property.checked = BackwardCompatibility::isPropertyCurrent(iter->first);
+			item.properties.push_back(property);
+		}
+
+		for (VectorWidgetInfo::const_iterator iter = _widgetInfo.childWidgetsInfo.begin(); iter != _widgetInfo.childWidgetsInfo.end(); ++iter)
+			compileWidget(*iter);
+
+		// вектор мог переехать, берем по индексу
+		mCompiledWidgets[index].descendants = mCompiledWidgets.size() - index - 1;
+	}
+
+	Widget* ResourceLayout::createCompiledWidget(size_t& _index, const std::string& _prefix, Widget* _parent)
+	{
+		const CompiledWidget& item = mCompiledWidgets[_index];
+		const WidgetInfo& widgetInfo = *item.info;
+		size_t end = _index + item.descendants + 1;
+		_index ++;
+
+		std::string widgetName = widgetInfo.name;
+		WidgetStyle style = widgetInfo.style;
+		const std::string& widgetLayer = (_parent != nullptr && style != WidgetStyle::Popup) ? Constants::getEmptyString() : widgetInfo.layer;
+
+		if (!widgetName.empty()) widgetName = _prefix + widgetName;
+
+		if (_parent == nullptr && widgetLayer.empty())
+		{
+			MYGUI_LOG(Warning, "Root widget's layer is not specified, widget won't be visible. Specify layer or parent or attach it to another widget after load." << " [" << LayoutManager::getInstance().getCurrentLayout() << "]");
+		}
+
+		IntCoord coord = _getWidgetCoord(widgetInfo, _parent);
+
+		Widget* wid;
+		if (nullptr == _parent)
+			wid = Gui::getInstance()._createWidget(item.type, coord, widgetInfo.align, widgetLayer, widgetName);
+		else
+			wid = _parent->_createWidget(style, item.type, coord, widgetInfo.align, widgetLayer, widgetName);
+
+		for (VectorCompiledProperty::const_iterator iter = item.properties.begin(); iter != item.properties.end(); ++iter)
+		{
+			if (iter->checked)
+				wid->_setPropertyChecked(iter->property->first, iter->property->second);
+			else
+				wid->setProperty(iter->property->first, iter->property->second);
+		}
+
+		for (MapString::const_iterator iter = widgetInfo.userStrings.begin(); iter != widgetInfo.userStrings.end(); ++iter)
+		{
+			wid->setUserString(iter->first, iter->second);
+			LayoutManager::getInstance().eventAddUserString(wid, iter->first, iter->second);
+		}
+
+		// в событиях план может быть перестроен, поэтому item дальше не используется
+		while (_index < end)
+			createCompiledWidget(_index, _prefix, wid);
+
+		_createControllers(widgetInfo, wid);
 
 		return wid;
 	}
@@ -20,6 +20,7 @@ namespace MyGUI
 	template <> const char* Singleton<ResourceManager>::mClassTypeName = "ResourceManager";
 
 	ResourceManager::ResourceManager() :
+		mChangeCount(0),
 		mIsInitialise(false),
 		mCategoryName("Resource"),
 		mXmlListTagName("List")
@@ -100,6 +101,7 @@ namespace MyGUI
 			resource->deserialization(root.current(), _version);
 
 			mResources[name] = resource;
+			mChangeCount ++;
 		}
 	}
 
@@ -205,7 +207,10 @@ namespace MyGUI
 	void ResourceManager::addResource(IResourcePtr _item)
 	{
 		if (!_item->getResourceName().empty())
+		{
 			mResources[_item->getResourceName()] = _item;
+			mChangeCount ++;
+		}
 	}
 
 	void ResourceManager::removeResource(IResourcePtr _item)
@@ -217,7 +222,10 @@ namespace MyGUI
 		{
 			MapResource::iterator item = mResources.find(_item->getResourceName());
 			if (item != mResources.end())
+			{
 				mResources.erase(item);
+				mChangeCount ++;
+			}
 		}
 	}
 
@@ -246,6 +254,7 @@ namespace MyGUI
 		{
 			delete item->second;
 			mResources.erase(item->first);
+			mChangeCount ++;
 			return true;
 		}
 		return false;
@@ -260,6 +269,8 @@ namespace MyGUI
 		for (VectorResource::iterator item = mRemovedResoures.begin(); item != mRemovedResoures.end(); ++ item)
 			delete (*item);
 		mRemovedResoures.clear();
+
+		mChangeCount ++;
 	}
 
 	ResourceManager::EnumeratorPtr ResourceManager::getEnumerator() const
@@ -272,6 +283,11 @@ namespace MyGUI
 		return mResources.size();
 	}
 
+	size_t ResourceManager::getChangeCount() const
+	{
+		return mChangeCount;
+	}
+
 	const std::string& ResourceManager::getCategoryName() const
 	{
 		return mCategoryName;
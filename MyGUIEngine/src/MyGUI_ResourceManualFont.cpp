@@ -9,6 +9,7 @@
 #include "MyGUI_SkinManager.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_TextureMemoryManager.h"
 
 namespace MyGUI
 {
@@ -44,7 +45,11 @@ namespace MyGUI
 			{
 				mTexture = render.createTexture(mSource);
 				if (mTexture != nullptr)
+				{
 					mTexture->loadFromFile(mSource);
+					if (TextureMemoryManager::getInstancePtr() != nullptr)
+						TextureMemoryManager::getInstance().registerTexture(mTexture, true);
+				}
 			}
 		}
 	}
@@ -268,6 +268,11 @@ namespace MyGUI
 	}
 
 	const std::string& ResourceSkin::getTextureName() const
+	{
+		return mTexture.toString();
+	}
+
+	StringId ResourceSkin::getTextureNameId() const
 	{
 		return mTexture;
 	}
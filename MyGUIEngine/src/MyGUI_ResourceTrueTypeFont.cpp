@@ -286,7 +286,7 @@ namespace MyGUI
 	{
 		if (mTexture != nullptr)
 		{
-			RenderManager::getInstance().destroyTexture(mTexture);
+			RenderManager::getInstance()._destroyTextureDeferred(mTexture);
 			mTexture = nullptr;
 		}
 	}
@@ -763,11 +763,16 @@ namespace MyGUI
 
 		if (mTexture)
 		{
-			RenderManager::getInstance().destroyTexture( mTexture );
+			RenderManager::getInstance()._destroyTextureDeferred( mTexture );
 			mTexture = nullptr;
 		}
 
-		mTexture = RenderManager::getInstance().createTexture(MyGUI::utility::toString((size_t)this, "_TrueTypeFont"));
+		// старая текстура может быть еще жива в режиме снимков кадра
+		std::string textureName = MyGUI::utility::toString((size_t)this, "_TrueTypeFont");
+		for (size_t index = 1; RenderManager::getInstance().getTexture(textureName) != nullptr; ++index)
+			textureName = MyGUI::utility::toString((size_t)this, "_TrueTypeFont_", index);
+
+		mTexture = RenderManager::getInstance().createTexture(textureName);
 
 		mTexture->createManual(texWidth, texHeight, TextureUsage::Static | TextureUsage::Write, Pixel<LAMode>::getFormat());
 		mTexture->setInvalidateListener(this);
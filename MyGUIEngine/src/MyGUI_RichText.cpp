@@ -0,0 +1,776 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_RichText.h"
+#include "MyGUI_RenderItem.h"
+#include "MyGUI_FontManager.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_IRenderTarget.h"
+#include "MyGUI_CommonStateInfo.h"
+#include "MyGUI_TextureUtility.h"
+
+namespace MyGUI
+{
+
+	// элемент отрисовки для глифов одной текстуры
+	class RichTextBatch :
+		public ISubWidget
+	{
+	public:
+		RichTextBatch(RichText* _owner, size_t _index) :
+			mOwner(_owner),
+			mIndex(_index)
+		{
+		}
+
+		virtual void createDrawItem(ITexture* _texture, ILayerNode* _node) { }
+		virtual void destroyDrawItem() { }
+
+		virtual void doRender()
+		{
+			mOwner->_renderBatch(mIndex);
+		}
+
+	private:
+		RichText* mOwner;
+		size_t mIndex;
+	};
+
+	namespace
+	{
+		std::string getTagAttribute(const std::string& _tag, const std::string& _name)
+		{
+			size_t start = _tag.find(_name + "=");
+			if (start == std::string::npos)
+				return "";
+			start += _name.size() + 1;
+			if (start >= _tag.size())
+				return "";
+
+			char quote = _tag[start];
+			if (quote == '\'' || quote == '"')
+			{
+				size_t end = _tag.find(quote, start + 1);
+				return end == std::string::npos ? "" : _tag.substr(start + 1, end - start - 1);
+			}
+
+			size_t end = _tag.find_first_of(" />", start);
+			return _tag.substr(start, end == std::string::npos ? std::string::npos : end - start);
+		}
+	}
+
+	RichText::RichText() :
+		mFont(nullptr),
+		mColourNative(0x00FFFFFF),
+		mAlphaNative(0xFF000000),
+		mAlpha(ALPHA_MAX),
+		mTextAlign(Align::Default),
+		mWordWrap(true),
+		mManualColour(false),
+		mEmptyView(false),
+		mLayoutWidth(0),
+		mNode(nullptr)
+	{
+		mColour = Colour::White;
+		mVertexFormat = RenderManager::getInstance().getVertexFormat();
+
+		mColourNative = texture_utility::toColourARGB(mColour);
+		texture_utility::convertColour(mColourNative, mVertexFormat);
+	}
+
+	RichText::~RichText()
+	{
+		detachBatches();
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+			delete (*batch).item;
+	}
+
+	void RichText::setVisible(bool _value)
+	{
+		if (mVisible == _value)
+			return;
+		mVisible = _value;
+
+		markOutOfDate();
+	}
+
+	void RichText::setAlpha(float _value)
+	{
+		if (mAlpha == _value)
+			return;
+		mAlpha = _value;
+
+		mAlphaNative = ((uint8)(mAlpha * 255) << 24);
+
+		markOutOfDate();
+	}
+
+	void RichText::setStateData(IStateInfo* _data)
+	{
+		EditTextStateInfo* data = _data->castType<EditTextStateInfo>();
+		if (mManualColour || data->getColour() == Colour::Zero || mColour == data->getColour())
+			return;
+
+		mColour = data->getColour();
+		mColourNative = texture_utility::toColourARGB(mColour);
+		texture_utility::convertColour(mColourNative, mVertexFormat);
+
+		markOutOfDate();
+	}
+
+	void RichText::createDrawItem(ITexture* _texture, ILayerNode* _node)
+	{
+		mNode = _node;
+		attachBatches();
+	}
+
+	void RichText::destroyDrawItem()
+	{
+		detachBatches();
+		mNode = nullptr;
+	}
+
+	void RichText::doRender()
+	{
+	}
+
+	void RichText::_updateView()
+	{
+		bool margin = _checkMargin();
+
+		mEmptyView = ((0 >= _getViewWidth()) || (0 >= _getViewHeight()));
+
+		mCurrentCoord.left = mCoord.left + mMargin.left;
+		mCurrentCoord.top = mCoord.top + mMargin.top;
+
+		// вьюпорт стал битым
+		if (margin)
+		{
+			// проверка на полный выход за границу
+			if (_checkOutside())
+			{
+				// запоминаем текущее состояние
+				mIsMargin = margin;
+
+				// обновить перед выходом
+				markOutOfDate();
+				return;
+			}
+		}
+
+		// мы обрезаны или были обрезаны
+		if (mIsMargin || margin)
+		{
+			mCurrentCoord.width = _getViewWidth();
+			mCurrentCoord.height = _getViewHeight();
+		}
+
+		// запоминаем текущее состояние
+		mIsMargin = margin;
+
+		markOutOfDate();
+	}
+
+	void RichText::_correctView()
+	{
+		markOutOfDate();
+	}
+
+	void RichText::_setAlign(const IntSize& _oldsize)
+	{
+		if (mAlign.isHStretch())
+		{
+			mCoord.width = mCoord.width + (mCroppedParent->getWidth() - _oldsize.width);
+			mIsMargin = true;
+		}
+		else if (mAlign.isRight())
+		{
+			mCoord.left = mCoord.left + (mCroppedParent->getWidth() - _oldsize.width);
+		}
+		else if (mAlign.isHCenter())
+		{
+			mCoord.left = (mCroppedParent->getWidth() - mCoord.width) / 2;
+		}
+
+		if (mAlign.isVStretch())
+		{
+			mCoord.height = mCoord.height + (mCroppedParent->getHeight() - _oldsize.height);
+			mIsMargin = true;
+		}
+		else if (mAlign.isBottom())
+		{
+			mCoord.top = mCoord.top + (mCroppedParent->getHeight() - _oldsize.height);
+		}
+		else if (mAlign.isVCenter())
+		{
+			mCoord.top = (mCroppedParent->getHeight() - mCoord.height) / 2;
+		}
+
+		// переносы зависят от ширины
+		if (mLayoutWidth != mCoord.width && (mWordWrap || !mTextAlign.isLeft()))
+			updateLayout();
+
+		mCurrentCoord = mCoord;
+		_updateView();
+	}
+
+	void RichText::setCaption(const UString& _value)
+	{
+		mCaption = _value;
+		updateLayout();
+	}
+
+	const UString& RichText::getCaption() const
+	{
+		return mCaption;
+	}
+
+	void RichText::setTextColour(const Colour& _value)
+	{
+		mManualColour = true;
+
+		mColour = _value;
+		mColourNative = texture_utility::toColourARGB(mColour);
+		texture_utility::convertColour(mColourNative, mVertexFormat);
+
+		markOutOfDate();
+	}
+
+	const Colour& RichText::getTextColour() const
+	{
+		return mColour;
+	}
+
+	void RichText::setFontName(const std::string& _value)
+	{
+		mFontName = _value;
+		mFont = FontManager::getInstance().getByName(_value);
+		updateLayout();
+	}
+
+	const std::string& RichText::getFontName() const
+	{
+		return mFontName;
+	}
+
+	int RichText::getFontHeight() const
+	{
+		return mFont == nullptr ? 0 : mFont->getDefaultHeight();
+	}
+
+	void RichText::setTextAlign(Align _value)
+	{
+		mTextAlign = _value;
+		updateLayout();
+	}
+
+	Align RichText::getTextAlign() const
+	{
+		return mTextAlign;
+	}
+
+	void RichText::setWordWrap(bool _value)
+	{
+		if (mWordWrap == _value)
+			return;
+		mWordWrap = _value;
+		updateLayout();
+	}
+
+	IntSize RichText::getTextSize()
+	{
+		return mTextSize;
+	}
+
+	void RichText::setViewOffset(const IntPoint& _point)
+	{
+		mViewOffset = _point;
+		markOutOfDate();
+	}
+
+	IntPoint RichText::getViewOffset() const
+	{
+		return mViewOffset;
+	}
+
+	void RichText::setTagFont(const std::string& _tag, const std::string& _font)
+	{
+		mTagFonts[_tag] = _font;
+		if (!mCaption.empty())
+			updateLayout();
+	}
+
+	const std::string& RichText::getTagFont(const std::string& _tag) const
+	{
+		MapString::const_iterator item = mTagFonts.find(_tag);
+		return item == mTagFonts.end() ? Constants::getEmptyString() : item->second;
+	}
+
+	const std::string& RichText::getLinkAt(const IntPoint& _point) const
+	{
+		if (!mVisible || mCroppedParent == nullptr)
+			return Constants::getEmptyString();
+
+		IntPoint point = _point - mCroppedParent->getAbsolutePosition() - mCoord.point() + mViewOffset;
+		point.top -= getAlignTop();
+		for (VectorLink::const_iterator link = mLinkAreas.begin(); link != mLinkAreas.end(); ++link)
+		{
+			if (link->rect.inside(point))
+				return mLinks[link->index];
+		}
+
+		return Constants::getEmptyString();
+	}
+
+	size_t RichText::getQuadCount() const
+	{
+		size_t result = 0;
+		for (VectorBatch::const_iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+			result += batch->quads.size();
+		return result;
+	}
+
+	size_t RichText::getBatchCount() const
+	{
+		return mBatches.size();
+	}
+
+	void RichText::updateLayout()
+	{
+		// набор текстур мог поменяться, поэтому пачки собираются заново
+		detachBatches();
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+			delete (*batch).item;
+		mBatches.clear();
+		mLinkAreas.clear();
+		mLinks.clear();
+		mTextSize.clear();
+		mLayoutWidth = mCoord.width;
+
+		if (mFont == nullptr)
+			return;
+
+		Style style;
+		style.font = mFont;
+		style.colour = 0;
+		style.customColour = false;
+		style.underline = false;
+		style.strike = false;
+		style.link = ITEM_NONE;
+
+		VectorStyle styles;
+		styles.push_back(style);
+
+		const UString::utf32string& text = mCaption.asUTF32();
+		const float maxWidth = mWordWrap ? (float)mCoord.width : -1.0f;
+
+		VectorLineGlyph line;
+		float width = 0.0f;
+		size_t breakPosition = 0;
+		float breakWidth = 0.0f;
+		int top = 0;
+
+		for (size_t index = 0; index < text.size(); ++index)
+		{
+			Char character = text[index];
+
+			if (character == '<')
+			{
+				size_t end = text.find('>', index);
+				if (end != UString::utf32string::npos)
+				{
+					UString tag;
+					for (size_t position = index; position <= end; ++position)
+						tag.push_back((UString::unicode_char)text[position]);
+					index = end;
+
+					TagBreak result = parseTag(tag, styles);
+					if (result == BreakParagraph || (result == BreakLine && !line.empty()))
+					{
+						addLine(line, width, top);
+						width = 0.0f;
+						breakPosition = 0;
+						if (result == BreakParagraph)
+							top += mFont->getDefaultHeight() / 2;
+					}
+					continue;
+				}
+			}
+
+			// новая строка
+			if (character == FontCodeType::CR
+				|| character == FontCodeType::NEL
+				|| character == FontCodeType::LF)
+			{
+				if (character == FontCodeType::CR && index + 1 < text.size() && text[index + 1] == FontCodeType::LF)
+					++index;
+
+				addLine(line, width, top);
+				width = 0.0f;
+				breakPosition = 0;
+				continue;
+			}
+
+			const Style& current = styles.back();
+			GlyphInfo* info = current.font->getGlyphInfo(character);
+			if (info == nullptr)
+				continue;
+
+			float advance = info->bearingX + info->advance;
+
+			// перенос слов, откатываемся до последнего пробела
+			if (maxWidth >= 0.0f && (width + advance) > maxWidth && breakPosition != 0)
+			{
+				VectorLineGlyph tail(line.begin() + breakPosition, line.end());
+				line.resize(breakPosition);
+				addLine(line, breakWidth, top);
+
+				line.swap(tail);
+				for (VectorLineGlyph::iterator glyph = line.begin(); glyph != line.end(); ++glyph)
+					glyph->left -= breakWidth;
+				width -= breakWidth;
+				breakPosition = 0;
+			}
+
+			bool space = character == FontCodeType::Space || character == FontCodeType::Tab;
+
+			LineGlyph glyph;
+			glyph.info = info;
+			glyph.font = current.font;
+			glyph.left = width;
+			glyph.advance = advance;
+			glyph.visible = !space;
+			glyph.style = current;
+			line.push_back(glyph);
+
+			width += advance;
+
+			if (space)
+			{
+				breakPosition = line.size();
+				breakWidth = width;
+			}
+		}
+
+		if (!line.empty())
+			addLine(line, width, top);
+
+		mTextSize.height = top;
+
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+			batch->vertexCount = batch->quads.size() * VertexQuad::VertexCount;
+
+		attachBatches();
+		markOutOfDate();
+	}
+
+	RichText::TagBreak RichText::parseTag(const UString& _tag, VectorStyle& _styles)
+	{
+		std::string tag = _tag.asUTF8();
+
+		bool close = tag.size() > 1 && tag[1] == '/';
+		size_t nameStart = close ? 2 : 1;
+		size_t nameEnd = tag.find_first_of(" />", nameStart);
+		std::string name = tag.substr(nameStart, nameEnd == std::string::npos ? std::string::npos : nameEnd - nameStart);
+
+		if (name == "br")
+			return BreakLine;
+		if (name == "p")
+			return close ? BreakParagraph : BreakLine;
+
+		bool style = name == "b" || name == "i" || name == "h1" || name == "h2" || name == "h3"
+			|| name == "font" || name == "color" || name == "url" || name == "u" || name == "s";
+		if (!style)
+			return BreakNone;
+
+		if (close)
+		{
+			if (_styles.size() > 1)
+				_styles.pop_back();
+			return BreakNone;
+		}
+
+		Style current = _styles.back();
+
+		if (name == "font")
+		{
+			IFont* font = FontManager::getInstance().getByName(getTagAttribute(tag, "name"));
+			if (font != nullptr)
+				current.font = font;
+		}
+		else if (name == "color")
+		{
+			current.colour = texture_utility::toColourARGB(Colour::parse(getTagAttribute(tag, "value")));
+			texture_utility::convertColour(current.colour, mVertexFormat);
+			current.customColour = true;
+		}
+		else if (name == "url")
+		{
+			current.link = mLinks.size();
+			current.underline = true;
+			mLinks.push_back(getTagAttribute(tag, "value"));
+		}
+		else if (name == "u")
+		{
+			current.underline = true;
+		}
+		else if (name == "s")
+		{
+			current.strike = true;
+		}
+		else
+		{
+			MapString::const_iterator item = mTagFonts.find(name);
+			if (item != mTagFonts.end())
+			{
+				IFont* font = FontManager::getInstance().getByName(item->second);
+				if (font != nullptr)
+					current.font = font;
+			}
+		}
+
+		_styles.push_back(current);
+		return BreakNone;
+	}
+
+	void RichText::addLine(VectorLineGlyph& _line, float _width, int& _top)
+	{
+		int lineHeight = 0;
+		for (VectorLineGlyph::const_iterator glyph = _line.begin(); glyph != _line.end(); ++glyph)
+			lineHeight = std::max(lineHeight, glyph->font->getDefaultHeight());
+		if (lineHeight == 0)
+			lineHeight = mFont->getDefaultHeight();
+
+		float offset = 0.0f;
+		if (mTextAlign.isRight())
+			offset = (float)mCoord.width - _width;
+		else if (mTextAlign.isHCenter())
+			offset = ((float)mCoord.width - _width) / 2.0f;
+
+		float lineTop = (float)_top;
+
+		for (VectorLineGlyph::const_iterator glyph = _line.begin(); glyph != _line.end(); ++glyph)
+		{
+			if (!glyph->visible)
+				continue;
+
+			// глифы разных шрифтов выравниваются по низу строки
+			float top = lineTop + (float)(lineHeight - glyph->font->getDefaultHeight()) + glyph->info->bearingY;
+			float left = offset + glyph->left + glyph->info->bearingX;
+			addQuad(glyph->font, FloatRect(left, top, left + glyph->info->width, top + glyph->info->height), glyph->info->uvRect, lineTop, glyph->style);
+		}
+
+		// подчеркивание, зачеркивание и области ссылок объединяются по одинаковому стилю
+		size_t start = 0;
+		while (start < _line.size())
+		{
+			const LineGlyph& first = _line[start];
+			size_t end = start + 1;
+			while (end < _line.size()
+				&& _line[end].font == first.font
+				&& _line[end].style.colour == first.style.colour
+				&& _line[end].style.customColour == first.style.customColour
+				&& _line[end].style.underline == first.style.underline
+				&& _line[end].style.strike == first.style.strike
+				&& _line[end].style.link == first.style.link)
+				++end;
+
+			const LineGlyph& last = _line[end - 1];
+			float left = offset + first.left;
+			float right = offset + last.left + last.advance;
+			float bottom = lineTop + (float)lineHeight;
+
+			if (first.style.underline || first.style.strike)
+			{
+				GlyphInfo* solid = first.font->getGlyphInfo(FontCodeType::Selected);
+				if (solid != nullptr)
+				{
+					if (first.style.underline)
+						addQuad(first.font, FloatRect(left, bottom - 1.0f, right, bottom), solid->uvRect, lineTop, first.style);
+					if (first.style.strike)
+					{
+						float middle = bottom - (float)(first.font->getDefaultHeight() / 2);
+						addQuad(first.font, FloatRect(left, middle, right, middle + 1.0f), solid->uvRect, lineTop, first.style);
+					}
+				}
+			}
+
+			if (first.style.link != ITEM_NONE)
+			{
+				Link link;
+				link.rect.set((int)left, _top, (int)ceil(right), _top + lineHeight);
+				link.index = first.style.link;
+				mLinkAreas.push_back(link);
+			}
+
+			start = end;
+		}
+
+		mTextSize.width = std::max(mTextSize.width, (int)ceil(_width));
+		_top += lineHeight;
+		_line.clear();
+	}
+
+	size_t RichText::getBatch(ITexture* _texture)
+	{
+		for (size_t index = 0; index < mBatches.size(); ++index)
+		{
+			if (mBatches[index].texture == _texture)
+				return index;
+		}
+
+		Batch batch;
+		batch.texture = _texture;
+		batch.renderItem = nullptr;
+		batch.item = new RichTextBatch(this, mBatches.size());
+		batch.vertexCount = 0;
+		mBatches.push_back(batch);
+
+		return mBatches.size() - 1;
+	}
+
+	void RichText::addQuad(IFont* _font, const FloatRect& _rect, const FloatRect& _uv, float _lineTop, const Style& _style)
+	{
+		ITexture* texture = _font->getTextureFont();
+		if (texture == nullptr)
+			return;
+
+		Quad quad;
+		quad.rect = _rect;
+		quad.uv = _uv;
+		quad.lineTop = _lineTop;
+		quad.colour = _style.colour;
+		quad.customColour = _style.customColour;
+
+		mBatches[getBatch(texture)].quads.push_back(quad);
+	}
+
+	int RichText::getAlignTop() const
+	{
+		// строки раскладываются от верха, высота всего текста известна только после раскладки,
+		// поэтому сдвигаем при выводе, тогда изменение высоты не требует новой раскладки
+		if (mTextAlign.isBottom())
+			return mCoord.height - mTextSize.height;
+		if (mTextAlign.isVCenter())
+			return (mCoord.height - mTextSize.height) / 2;
+		return 0;
+	}
+
+	void RichText::attachBatches()
+	{
+		if (mNode == nullptr)
+			return;
+
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+		{
+			MYGUI_ASSERT(batch->renderItem == nullptr, "batch is already attached");
+			batch->renderItem = mNode->addToRenderItem(batch->texture, false, false);
+			batch->renderItem->addDrawItem(batch->item, batch->vertexCount);
+		}
+	}
+
+	void RichText::detachBatches()
+	{
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+		{
+			if (batch->renderItem != nullptr)
+			{
+				batch->renderItem->removeDrawItem(batch->item);
+				batch->renderItem = nullptr;
+			}
+		}
+	}
+
+	void RichText::markOutOfDate()
+	{
+		if (mNode == nullptr)
+			return;
+
+		for (VectorBatch::iterator batch = mBatches.begin(); batch != mBatches.end(); ++batch)
+		{
+			if (batch->renderItem != nullptr)
+				mNode->outOfDate(batch->renderItem);
+		}
+	}
+
+	void RichText::_renderBatch(size_t _index)
+	{
+		if (!mVisible || mEmptyView)
+			return;
+
+		Batch& batch = mBatches[_index];
+
+		vertex_utility::QuadBatch quads(
+			batch.renderItem->getCurrentVertexBuffer(),
+			batch.renderItem->getRenderTargetInfo(),
+			(float)mCroppedParent->getAbsoluteLeft(),
+			(float)mCroppedParent->getAbsoluteTop(),
+			mNode->getNodeDepth());
+
+		float left = (float)(mCoord.left - mViewOffset.left);
+		float top = (float)(mCoord.top - mViewOffset.top + getAlignTop());
+		float bottom = (float)mCurrentCoord.bottom();
+
+		for (VectorQuad::const_iterator quad = batch.quads.begin(); quad != batch.quads.end(); ++quad)
+		{
+			// строки идут сверху вниз, дальше все ниже видимой области
+			if (quad->lineTop + top > bottom)
+				break;
+
+			uint32 colour = ((quad->customColour ? quad->colour : mColourNative) & 0x00FFFFFF) | (mAlphaNative & 0xFF000000);
+			FloatRect rect(quad->rect.left + left, quad->rect.top + top, quad->rect.right + left, quad->rect.bottom + top);
+
+			drawQuad(quads, rect, quad->uv, colour);
+		}
+
+		quads.flush();
+		batch.renderItem->setLastVertexCount(quads.getVertexCount());
+	}
+
+	void RichText::drawQuad(vertex_utility::QuadBatch& _quads, FloatRect _rect, FloatRect _uv, uint32 _colour) const
+	{
+		// обрезаем по видимой области
+		float leftClip = (float)mCurrentCoord.left - _rect.left;
+		if (leftClip > 0.0f)
+		{
+			if ((float)mCurrentCoord.left >= _rect.right)
+				return;
+			_uv.left += _uv.width() * leftClip / _rect.width();
+			_rect.left += leftClip;
+		}
+
+		float rightClip = _rect.right - (float)mCurrentCoord.right();
+		if (rightClip > 0.0f)
+		{
+			if (_rect.left >= (float)mCurrentCoord.right())
+				return;
+			_uv.right -= _uv.width() * rightClip / _rect.width();
+			_rect.right -= rightClip;
+		}
+
+		float topClip = (float)mCurrentCoord.top - _rect.top;
+		if (topClip > 0.0f)
+		{
+			if ((float)mCurrentCoord.top >= _rect.bottom)
+				return;
+			_uv.top += _uv.height() * topClip / _rect.height();
+			_rect.top += topClip;
+		}
+
+		float bottomClip = _rect.bottom - (float)mCurrentCoord.bottom();
+		if (bottomClip > 0.0f)
+		{
+			if (_rect.top >= (float)mCurrentCoord.bottom())
+				return;
+			_uv.bottom -= _uv.height() * bottomClip / _rect.height();
+			_rect.bottom -= bottomClip;
+		}
+
+		_quads.add(_rect, _uv, _colour);
+	}
+
+} // namespace MyGUI
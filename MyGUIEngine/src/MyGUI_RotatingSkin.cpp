@@ -327,9 +327,10 @@ namespace MyGUI
 
 
 		// now calculate widget base offset and then resulting position in screen coordinates
-		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
-		float vertex_left_base = ((info.pixScaleX * (float)(mCroppedParent->getAbsoluteLeft()) + info.hOffset) * 2) - 1;
-		float vertex_top_base = -(((info.pixScaleY * (float)(mCroppedParent->getAbsoluteTop()) + info.vOffset) * 2) - 1);
+		const RenderTargetInfo& info = mRenderItem->getRenderTargetInfo();
+		const IntPoint& origin = mRenderItem->getVertexOrigin();
+		float vertex_left_base = ((info.pixScaleX * (float)(mCroppedParent->getAbsoluteLeft() - origin.left) + info.hOffset) * 2) - 1;
+		float vertex_top_base = -(((info.pixScaleY * (float)(mCroppedParent->getAbsoluteTop() - origin.top) + info.vOffset) * 2) - 1);
 
 		for (size_t i = 0; i < GEOMETRY_VERTICIES_TOTAL_COUNT; ++i)
 		{
@@ -16,6 +16,7 @@ namespace MyGUI
 	SkinItem::SkinItem() :
 		mText(nullptr),
 		mMainSkin(nullptr),
+		mStateInfo(nullptr),
 		mTexture(nullptr),
 		mSubSkinsVisible(true)
 	{
@@ -63,8 +64,11 @@ namespace MyGUI
 
 	bool SkinItem::_setSkinItemState(const std::string& _state)
 	{
-		MapWidgetStateInfo::const_iterator iter = mStateInfo.find(_state);
-		if (iter == mStateInfo.end())
+		if (mStateInfo == nullptr)
+			return false;
+
+		MapWidgetStateInfo::const_iterator iter = mStateInfo->find(_state);
+		if (iter == mStateInfo->end())
 			return false;
 
 		size_t index = 0;
@@ -79,11 +83,12 @@ namespace MyGUI
 
 	void SkinItem::_createSkinItem(ResourceSkin* _info)
 	{
-		mStateInfo = _info->getStateInfo();
+		// данные стейтов и так принадлежат скину, копия не нужна
+		mStateInfo = &_info->getStateInfo();
 
 		// все что с текстурой можно тоже перенести в скин айтем и setRenderItemTexture
-		mTextureName = _info->getTextureName();
-		mTexture = RenderManager::getInstance().getTexture(mTextureName);
+		mTextureName = _info->getTextureNameId();
+		mTexture = RenderManager::getInstance().getTexture(mTextureName.toString());
 
 		setRenderItemTexture(mTexture);
 
@@ -118,7 +123,7 @@ namespace MyGUI
 	{
 		mTexture = nullptr;
 
-		mStateInfo.clear();
+		mStateInfo = nullptr;
 
 		removeAllRenderItems();
 		// удаляем все сабскины
@@ -130,17 +135,25 @@ namespace MyGUI
 		mSubSkinChild.clear();
 	}
 
+	size_t SkinItem::_getSkinItemMemoryUsage() const
+	{
+		size_t result = mSubSkinChild.capacity() * sizeof(ISubWidget*);
+		for (VectorSubWidget::const_iterator skin = mSubSkinChild.begin(); skin != mSubSkinChild.end(); ++skin)
+			result += (*skin)->getTypeSize();
+		return result;
+	}
+
 	void SkinItem::_setTextureName(const std::string& _texture)
 	{
 		mTextureName = _texture;
-		mTexture = RenderManager::getInstance().getTexture(mTextureName);
+		mTexture = RenderManager::getInstance().getTexture(_texture);
 
 		setRenderItemTexture(mTexture);
 	}
 
 	const std::string& SkinItem::_getTextureName() const
 	{
-		return mTextureName;
+		return mTextureName.toString();
 	}
 
 	void SkinItem::_setSubSkinVisible(bool _visible)
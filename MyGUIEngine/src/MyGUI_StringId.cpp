@@ -0,0 +1,104 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_StringId.h"
+#include "MyGUI_Constants.h"
+#include <set>
+
+namespace MyGUI
+{
+
+	namespace
+	{
+
+		struct StringTable
+		{
+			StringTable() :
+				bytes(0)
+			{
+			}
+
+			// элементы std::set не перемещаются, на них можно ссылаться
+			std::set<std::string> strings;
+			size_t bytes;
+		};
+
+		// таблица создается при первом обращении, ids могут быть в статических объектах
+		StringTable& getTable()
+		{
+			static StringTable table;
+			return table;
+		}
+
+		const std::string* intern(const std::string& _value)
+		{
+			if (_value.empty())
+				return nullptr;
+
+			StringTable& table = getTable();
+			std::pair<std::set<std::string>::iterator, bool> result = table.strings.insert(_value);
+			if (result.second)
+			{
+				// узел дерева и строка, короткие строки хранятся внутри объекта строки
+				table.bytes += sizeof(std::string) + sizeof(void*) * 4;
+				if (result.first->capacity() >= sizeof(std::string))
+					table.bytes += result.first->capacity() + 1;
+			}
+			return &(*result.first);
+		}
+
+	} // namespace
+
+	StringId::StringId(const std::string& _value) :
+		mValue(intern(_value))
+	{
+	}
+
+	StringId::StringId(const char* _value) :
+		mValue(intern(_value))
+	{
+	}
+
+	StringId& StringId::operator = (const std::string& _value)
+	{
+		mValue = intern(_value);
+		return *this;
+	}
+
+	const std::string& StringId::toString() const
+	{
+		return mValue == nullptr ? Constants::getEmptyString() : *mValue;
+	}
+
+	bool StringId::find(const std::string& _value, StringId& _result)
+	{
+		if (_value.empty())
+		{
+			_result.mValue = nullptr;
+			return true;
+		}
+
+		StringTable& table = getTable();
+		std::set<std::string>::const_iterator item = table.strings.find(_value);
+		if (item == table.strings.end())
+			return false;
+
+		_result.mValue = &(*item);
+		return true;
+	}
+
+	size_t StringId::getInternedCount()
+	{
+		return getTable().strings.size();
+	}
+
+	size_t StringId::getInternedBytes()
+	{
+		return getTable().bytes;
+	}
+
+} // namespace MyGUI
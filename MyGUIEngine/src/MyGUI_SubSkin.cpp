@@ -13,6 +13,7 @@
 #include "MyGUI_CommonStateInfo.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_VertexUtility.h"
 
 namespace MyGUI
 {
@@ -232,9 +233,7 @@ namespace MyGUI
 		if (!mVisible || mEmptyView)
 			return;
 
-		VertexQuad* quad = reinterpret_cast<VertexQuad*>(mRenderItem->getCurrentVertexBuffer());
-
-		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
+		const RenderTargetInfo& info = mRenderItem->getRenderTargetInfo();
 
 		float vertex_z = mNode->getNodeDepth();
 
@@ -243,16 +242,11 @@ namespace MyGUI
 		float vertex_top = -(((info.pixScaleY * (float)(mCurrentCoord.top + mCroppedParent->getAbsoluteTop() - info.topOffset) + info.vOffset) * 2) - 1);
 		float vertex_bottom = vertex_top - (info.pixScaleY * (float)mCurrentCoord.height * 2);
 
-		quad->set(
-			vertex_left,
-			vertex_top,
-			vertex_right,
-			vertex_bottom,
+		vertex_utility::writeQuad(
+			mRenderItem->getCurrentVertexBuffer(),
+			FloatRect(vertex_left, vertex_top, vertex_right, vertex_bottom),
 			vertex_z,
-			mCurrentTexture.left,
-			mCurrentTexture.top,
-			mCurrentTexture.right,
-			mCurrentTexture.bottom,
+			mCurrentTexture,
 			mCurrentColour);
 
 		mRenderItem->setLastVertexCount(VertexQuad::VertexCount);
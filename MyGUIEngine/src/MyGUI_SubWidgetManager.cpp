@@ -15,6 +15,7 @@
 #include "MyGUI_RotatingSkin.h"
 #include "MyGUI_SimpleText.h"
 #include "MyGUI_EditText.h"
+#include "MyGUI_RichText.h"
 #include "MyGUI_TileRect.h"
 
 namespace MyGUI
@@ -44,6 +45,7 @@ namespace MyGUI
 		factory.registerFactory<TileRectStateInfo>(mStateCategoryName, "TileRect");
 		factory.registerFactory<EditTextStateInfo>(mStateCategoryName, "EditText");
 		factory.registerFactory<EditTextStateInfo>(mStateCategoryName, "SimpleText");
+		factory.registerFactory<EditTextStateInfo>(mStateCategoryName, "RichText");
 
 		factory.registerFactory<SubSkin>(mCategoryName);
 		factory.registerFactory<MainSkin>(mCategoryName);
@@ -52,6 +54,7 @@ namespace MyGUI
 		factory.registerFactory<TileRect>(mCategoryName);
 		factory.registerFactory<EditText>(mCategoryName);
 		factory.registerFactory<SimpleText>(mCategoryName);
+		factory.registerFactory<RichText>(mCategoryName);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
@@ -71,6 +74,7 @@ namespace MyGUI
 		factory.unregisterFactory(mStateCategoryName, "TileRect");
 		factory.unregisterFactory(mStateCategoryName, "EditText");
 		factory.unregisterFactory(mStateCategoryName, "SimpleText");
+		factory.unregisterFactory(mStateCategoryName, "RichText");
 
 		factory.unregisterFactory<SubSkin>(mCategoryName);
 		factory.unregisterFactory<MainSkin>(mCategoryName);
@@ -79,6 +83,7 @@ namespace MyGUI
 		factory.unregisterFactory<TileRect>(mCategoryName);
 		factory.unregisterFactory<EditText>(mCategoryName);
 		factory.unregisterFactory<SimpleText>(mCategoryName);
+		factory.unregisterFactory<RichText>(mCategoryName);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
 		mIsInitialise = false;
@@ -40,6 +40,11 @@ namespace MyGUI
 			Base::setCaption(_value);
 	}
 
+	void TabItem::setCaptionUTF8(const std::string& _value)
+	{
+		setCaption(UString(_value));
+	}
+
 	const UString& TabItem::getCaption()
 	{
 		TabControl* owner = getParent() != nullptr ? getParent()->castType<TabControl>(false) : nullptr;
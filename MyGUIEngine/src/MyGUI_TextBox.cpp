@@ -80,6 +80,12 @@ namespace MyGUI
 			getSubWidgetText()->setCaption(_caption);
 	}
 
+	void TextBox::setCaptionUTF8(const std::string& _value)
+	{
+		if (nullptr != getSubWidgetText())
+			getSubWidgetText()->setCaptionUTF8(_value);
+	}
+
 	const UString& TextBox::getCaption()
 	{
 		if (nullptr == getSubWidgetText())
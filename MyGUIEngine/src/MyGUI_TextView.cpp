@@ -6,6 +6,8 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_TextView.h"
+#include "MyGUI_TextViewCache.h"
+#include "MyGUI_UTF8Iterator.h"
 
 namespace MyGUI
 {
@@ -27,20 +29,49 @@ namespace MyGUI
 				_var = _newValue;
 		}
 
+		// перебор UString по кодовым единицам UTF-16, с тем же интерфейсом что и UTF8Iterator
+		class UStringIterator
+		{
+		public:
+			explicit UStringIterator(const UString& _value) :
+				mCurrent(_value.begin()),
+				mEnd(_value.end())
+			{
+			}
+
+			bool isEnd() const
+			{
+				return mCurrent == mEnd;
+			}
+
+			Char getNext()
+			{
+				Char result = *mCurrent;
+				++mCurrent;
+				return result;
+			}
+
+		private:
+			UString::const_iterator mCurrent;
+			UString::const_iterator mEnd;
+		};
+
 	}
 
+	template <typename Iterator>
 	class RollBackPoint
 	{
 	public:
-		RollBackPoint() :
+		explicit RollBackPoint(const Iterator& _start) :
 			position(0),
+			space_point(_start),
 			count(0),
 			width(0),
 			rollback(false)
 		{
 		}
 
-		void set(size_t _position, UString::const_iterator& _space_point, size_t _count, float _width)
+		void set(size_t _position, const Iterator& _space_point, size_t _count, float _width)
 		{
 			position = _position;
 			space_point = _space_point;
@@ -77,7 +108,8 @@ namespace MyGUI
 			return position;
 		}
 
-		UString::const_iterator getTextIter() const
+		// позиция сразу после пробела
+		const Iterator& getTextIter() const
 		{
 			MYGUI_DEBUG_ASSERT(rollback, "rollback point not valid");
 			return space_point;
@@ -85,22 +117,77 @@ namespace MyGUI
 
 	private:
 		size_t position;
-		UString::const_iterator space_point;
+		Iterator space_point;
 		size_t count;
 		float width;
 		bool rollback;
 	};
 
 	TextView::TextView() :
-		mLength(0),
+		mLayout(&mLocalLayout),
 		mFontHeight(0)
 	{
 	}
 
+	TextView::~TextView()
+	{
+		releaseLayout();
+	}
+
 	void TextView::update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
 	{
 		mFontHeight = _height;
 
+		const TextViewLayout* shared = nullptr;
+		TextViewCache* cache = TextViewCache::getInstancePtr();
+		if (cache != nullptr)
+			shared = cache->_acquire(_text, _font, _height, _align, _format, _maxWidth);
+
+		releaseLayout();
+
+		if (shared != nullptr)
+		{
+			mLayout = shared;
+			mLocalLayout = TextViewLayout();
+		}
+		else
+		{
+			updateLayout(mLocalLayout, _text, _font, _height, _align, _format, _maxWidth);
+		}
+	}
+
+	void TextView::updateUTF8(const std::string& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		mFontHeight = _height;
+
+		releaseLayout();
+		updateLayoutUTF8(mLocalLayout, _text, _font, _height, _align, _format, _maxWidth);
+	}
+
+	void TextView::releaseLayout()
+	{
+		if (mLayout != &mLocalLayout)
+		{
+			TextViewCache::_release(mLayout);
+			mLayout = &mLocalLayout;
+		}
+	}
+
+	void TextView::updateLayout(TextViewLayout& _layout, const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		layoutText(_layout, UStringIterator(_text), _font, _height, _align, _format, _maxWidth);
+	}
+
+	void TextView::updateLayoutUTF8(TextViewLayout& _layout, const std::string& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		layoutText(_layout, UTF8Iterator(_text), _font, _height, _align, _format, _maxWidth);
+	}
+
+	template <typename Iterator>
+	void TextView::layoutText(TextViewLayout& _layout, Iterator _index, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		VectorLineInfo& lineInfo = _layout.lineInfo;
+
 		// массив для быстрой конвертации цветов
 		static const char convert_colour[64] =
 		{
@@ -110,28 +197,22 @@ namespace MyGUI
 			0, 10, 11, 12, 13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0
 		};
 
-		mViewSize.clear();
-
-		RollBackPoint roll_back;
+		RollBackPoint<Iterator> roll_back(_index);
 		IntSize result;
 		float width = 0.0f;
 		size_t count = 0;
-		mLength = 0;
-		mLineInfo.clear();
+		_layout.length = 0;
+		lineInfo.clear();
 		LineInfo line_info;
 		int font_height = _font->getDefaultHeight();
 
-		UString::const_iterator end = _text.end();
-		UString::const_iterator index = _text.begin();
-
-		/*if (index == end)
-			return;*/
+		Iterator& index = _index;
 
 		result.height += _height;
 
-		for (; index != end; ++index)
+		while (!index.isEnd())
 		{
-			Char character = *index;
+			Char character = index.getNext();
 
 			// новая строка
 			if (character == FontCodeType::CR
@@ -140,22 +221,21 @@ namespace MyGUI
 			{
 				if (character == FontCodeType::CR)
 				{
-					UString::const_iterator peeki = index;
-					++peeki;
-					if ((peeki != end) && (*peeki == FontCodeType::LF))
+					Iterator peeki = index;
+					if (!peeki.isEnd() && peeki.getNext() == FontCodeType::LF)
 						index = peeki; // skip both as one newline
 				}
 
 				line_info.width = (int)ceil(width);
 				line_info.count = count;
-				mLength += line_info.count + 1;
+				_layout.length += line_info.count + 1;
 
 				result.height += _height;
 				setMax(result.width, line_info.width);
 				width = 0;
 				count = 0;
 
-				mLineInfo.push_back(line_info);
+				lineInfo.push_back(line_info);
 				line_info.clear();
 
 				// отменяем откат
@@ -167,14 +247,10 @@ namespace MyGUI
 			else if (character == L'#')
 			{
 				// берем следующий символ
-				++ index;
-				if (index == end)
-				{
-					--index;    // это защита
+				if (index.isEnd())
 					continue;
-				}
 
-				character = *index;
+				character = index.getNext();
 				// если два подряд, то рисуем один шарп, если нет то меняем цвет
 				if (character != L'#')
 				{
@@ -184,14 +260,10 @@ namespace MyGUI
 					// и еще пять символов после шарпа
 					for (char i = 0; i < 5; i++)
 					{
-						++ index;
-						if (index == end)
-						{
-							--index;    // это защита
+						if (index.isEnd())
 							continue;
-						}
 						colour <<= 4;
-						colour += convert_colour[ ((*index) - 48) & 0x3F ];
+						colour += convert_colour[ (index.getNext() - 48) & 0x3F ];
 					}
 
 					// если нужно, то меняем красный и синий компоненты
@@ -250,14 +322,14 @@ namespace MyGUI
 				// запоминаем место отката, как полную строку
 				line_info.width = (int)ceil(width);
 				line_info.count = count;
-				mLength += line_info.count + 1;
+				_layout.length += line_info.count + 1;
 
 				result.height += _height;
 				setMax(result.width, line_info.width);
 				width = 0;
 				count = 0;
 
-				mLineInfo.push_back(line_info);
+				lineInfo.push_back(line_info);
 				line_info.clear();
 
 				// отменяем откат
@@ -273,14 +345,14 @@ namespace MyGUI
 
 		line_info.width = (int)ceil(width);
 		line_info.count = count;
-		mLength += line_info.count;
+		_layout.length += line_info.count;
 
-		mLineInfo.push_back(line_info);
+		lineInfo.push_back(line_info);
 
 		setMax(result.width, line_info.width);
 
 		// теперь выравниванием строки
-		for (VectorLineInfo::iterator line = mLineInfo.begin(); line != mLineInfo.end(); ++line)
+		for (VectorLineInfo::iterator line = lineInfo.begin(); line != lineInfo.end(); ++line)
 		{
 			if (_align.isRight())
 				line->offset = result.width - line->width;
@@ -288,7 +360,7 @@ namespace MyGUI
 				line->offset = (result.width - line->width) / 2;
 		}
 
-		mViewSize = result;
+		_layout.viewSize = result;
 	}
 
 	size_t TextView::getCursorPosition(const IntPoint& _value)
@@ -297,10 +369,10 @@ namespace MyGUI
 		size_t result = 0;
 		int top = 0;
 
-		for (VectorLineInfo::const_iterator line = mLineInfo.begin(); line != mLineInfo.end(); ++line)
+		for (VectorLineInfo::const_iterator line = mLayout->lineInfo.begin(); line != mLayout->lineInfo.end(); ++line)
 		{
 			// это последняя строка
-			bool lastline = !(line + 1 != mLineInfo.end());
+			bool lastline = !(line + 1 != mLayout->lineInfo.end());
 
 			// наша строчка
 			if (top + height > _value.top || lastline)
@@ -340,12 +412,12 @@ namespace MyGUI
 
 	IntPoint TextView::getCursorPoint(size_t _position)
 	{
-		setMin(_position, mLength);
+		setMin(_position, mLayout->length);
 
 		size_t position = 0;
 		int top = 0;
 		float left = 0.0f;
-		for (VectorLineInfo::const_iterator line = mLineInfo.begin(); line != mLineInfo.end(); ++line)
+		for (VectorLineInfo::const_iterator line = mLayout->lineInfo.begin(); line != mLayout->lineInfo.end(); ++line)
 		{
 			left = (float)line->offset;
 			if (position + line->count >= _position)
@@ -372,17 +444,17 @@ namespace MyGUI
 
 	const IntSize& TextView::getViewSize() const
 	{
-		return mViewSize;
+		return mLayout->viewSize;
 	}
 
 	size_t TextView::getTextLength() const
 	{
-		return mLength;
+		return mLayout->length;
 	}
 
 	const VectorLineInfo& TextView::getData() const
 	{
-		return mLineInfo;
+		return mLayout->lineInfo;
 	}
 
 } // namespace MyGUI
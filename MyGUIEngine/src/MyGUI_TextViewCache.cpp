@@ -0,0 +1,226 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TextViewCache.h"
+#include "MyGUI_TextView.h"
+
+namespace MyGUI
+{
+
+	const size_t TEXT_VIEW_CACHE_DEFAULT_SIZE = 1024;
+	const size_t TEXT_VIEW_CACHE_DEFAULT_TEXT_LENGTH = 256;
+
+	template <> TextViewCache* Singleton<TextViewCache>::msInstance = nullptr;
+	template <> const char* Singleton<TextViewCache>::mClassTypeName = "TextViewCache";
+
+	bool TextViewCache::Key::operator < (const Key& _other) const
+	{
+		// сначала дешевые сравнения, текст в конце
+		if (font != _other.font)
+			return font < _other.font;
+		if (height != _other.height)
+			return height < _other.height;
+		if (maxWidth != _other.maxWidth)
+			return maxWidth < _other.maxWidth;
+		if (align != _other.align)
+			return align.getValue() < _other.align.getValue();
+		if (format != _other.format)
+			return format.getValue() < _other.format.getValue();
+		return text->compare(*_other.text) < 0;
+	}
+
+	TextViewCache::TextViewCache() :
+		mEnabled(false),
+		mMaxSize(TEXT_VIEW_CACHE_DEFAULT_SIZE),
+		mMaxTextLength(TEXT_VIEW_CACHE_DEFAULT_TEXT_LENGTH),
+		mHitCount(0),
+		mMissCount(0),
+		mIsInitialise(false)
+	{
+	}
+
+	void TextViewCache::initialise()
+	{
+		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
+		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
+	}
+
+	void TextViewCache::shutdown()
+	{
+		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
+		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
+
+		clear();
+
+		// оставшиеся раскладки удалит последний использующий их TextView
+		for (MapEntry::iterator item = mEntries.begin(); item != mEntries.end(); ++item)
+			item->second->orphan = true;
+		mEntries.clear();
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
+	}
+
+	void TextViewCache::setEnabled(bool _value)
+	{
+		mEnabled = _value;
+		if (!mEnabled)
+			clear();
+	}
+
+	bool TextViewCache::getEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void TextViewCache::setMaxSize(size_t _value)
+	{
+		mMaxSize = _value;
+		trim(mMaxSize);
+	}
+
+	size_t TextViewCache::getMaxSize() const
+	{
+		return mMaxSize;
+	}
+
+	void TextViewCache::setMaxTextLength(size_t _value)
+	{
+		mMaxTextLength = _value;
+	}
+
+	size_t TextViewCache::getMaxTextLength() const
+	{
+		return mMaxTextLength;
+	}
+
+	void TextViewCache::clear()
+	{
+		trim(0);
+	}
+
+	size_t TextViewCache::getSize() const
+	{
+		return mEntries.size();
+	}
+
+	size_t TextViewCache::getHitCount() const
+	{
+		return mHitCount;
+	}
+
+	size_t TextViewCache::getMissCount() const
+	{
+		return mMissCount;
+	}
+
+	float TextViewCache::getHitRate() const
+	{
+		size_t count = mHitCount + mMissCount;
+		return count != 0 ? (float)mHitCount / (float)count : 0.0f;
+	}
+
+	void TextViewCache::resetStatistics()
+	{
+		mHitCount = 0;
+		mMissCount = 0;
+	}
+
+	const TextViewLayout* TextViewCache::_acquire(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		if (!mEnabled || _text.size() > mMaxTextLength)
+			return nullptr;
+
+		Key key;
+		key.text = &_text;
+		key.font = _font;
+		key.height = _height;
+		key.maxWidth = _maxWidth;
+		key.align = _align;
+		key.format = _format;
+
+		MapEntry::iterator item = mEntries.find(key);
+		if (item != mEntries.end())
+		{
+			Entry* entry = item->second;
+			if (entry->refCount == 0)
+				mUnused.erase(entry->unused);
+			entry->refCount ++;
+			mHitCount ++;
+			return entry;
+		}
+
+		mMissCount ++;
+
+		// места нет, раскладываем без кеша
+		if (mEntries.size() >= mMaxSize)
+		{
+			trim(mMaxSize - 1);
+			if (mEntries.size() >= mMaxSize)
+				return nullptr;
+		}
+
+		Entry* entry = new Entry();
+		entry->text = _text;
+		entry->refCount = 1;
+		entry->orphan = false;
+		TextView::updateLayout(*entry, _text, _font, _height, _align, _format, _maxWidth);
+
+		key.text = &entry->text;
+		entry->position = mEntries.insert(MapEntry::value_type(key, entry)).first;
+
+		return entry;
+	}
+
+	void TextViewCache::_release(const TextViewLayout* _layout)
+	{
+		Entry* entry = static_cast<Entry*>(const_cast<TextViewLayout*>(_layout));
+
+		MYGUI_DEBUG_ASSERT(entry->refCount != 0, "layout released twice");
+		entry->refCount --;
+		if (entry->refCount != 0)
+			return;
+
+		if (entry->orphan)
+			delete entry;
+		else
+			getInstance().addUnused(entry);
+	}
+
+	void TextViewCache::addUnused(Entry* _entry)
+	{
+		if (mEnabled)
+		{
+			_entry->unused = mUnused.insert(mUnused.end(), _entry);
+			trim(mMaxSize);
+		}
+		else
+		{
+			removeEntry(_entry);
+		}
+	}
+
+	void TextViewCache::removeEntry(Entry* _entry)
+	{
+		mEntries.erase(_entry->position);
+		delete _entry;
+	}
+
+	void TextViewCache::trim(size_t _size)
+	{
+		while (mEntries.size() > _size && !mUnused.empty())
+		{
+			Entry* entry = mUnused.front();
+			mUnused.pop_front();
+			removeEntry(entry);
+		}
+	}
+
+} // namespace MyGUI
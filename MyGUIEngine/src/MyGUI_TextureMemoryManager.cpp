@@ -0,0 +1,266 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TextureMemoryManager.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_Gui.h"
+
+namespace MyGUI
+{
+
+	template <> TextureMemoryManager* Singleton<TextureMemoryManager>::msInstance = nullptr;
+	template <> const char* Singleton<TextureMemoryManager>::mClassTypeName = "TextureMemoryManager";
+
+	TextureMemoryManager::TextureMemoryManager() :
+		mBudget(0),
+		mUsedBytes(0),
+		mFrame(0),
+		mEvictCount(0),
+		mReloadCount(0),
+		mValidatedCount(0),
+		mIsInitialise(false)
+	{
+	}
+
+	void TextureMemoryManager::initialise()
+	{
+		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
+		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
+
+		Gui::getInstance().eventFrameStart += newDelegate(this, &TextureMemoryManager::frameEntered);
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
+	}
+
+	void TextureMemoryManager::shutdown()
+	{
+		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
+		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
+
+		Gui::getInstance().eventFrameStart -= newDelegate(this, &TextureMemoryManager::frameEntered);
+
+		// текстуры принадлежат RenderManager, выгруженные остаются выгруженными
+		mTextures.clear();
+		mUsedBytes = 0;
+		mValidatedCount = 0;
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
+	}
+
+	void TextureMemoryManager::setBudget(size_t _bytes)
+	{
+		mBudget = _bytes;
+	}
+
+	size_t TextureMemoryManager::getBudget() const
+	{
+		return mBudget;
+	}
+
+	void TextureMemoryManager::registerTexture(ITexture* _texture, bool _reloadable)
+	{
+		if (_texture == nullptr)
+			return;
+
+		TextureInfo& info = mTextures[_texture];
+		if (info.resident)
+			mUsedBytes -= info.bytes;
+
+		info.texture = _texture;
+		info.name = _texture->getName();
+		info.bytes = getTextureBytes(_texture);
+		info.lastUsedFrame = mFrame;
+		info.reloadable = _reloadable;
+		info.resident = true;
+		mUsedBytes += info.bytes;
+
+		// без бюджета проверка идет только в запросах, удаленные текстуры
+		// не должны копиться, если запросов нет
+		if (mTextures.size() > mValidatedCount * 2 + 16)
+			validate();
+	}
+
+	void TextureMemoryManager::touchTexture(ITexture* _texture)
+	{
+		MapTextureInfo::iterator item = mTextures.find(_texture);
+		if (item == mTextures.end())
+		{
+			registerTexture(_texture, false);
+			return;
+		}
+
+		TextureInfo& info = item->second;
+		info.lastUsedFrame = mFrame;
+
+		// по этому адресу могла быть удаленная текстура с другим именем, для
+		// загруженной это исправит validate, а грузить чужой файл нельзя
+		if (!info.resident)
+		{
+			if (info.name != _texture->getName())
+			{
+				registerTexture(_texture, false);
+				return;
+			}
+
+			_texture->loadFromFile(info.name);
+			info.bytes = getTextureBytes(_texture);
+			info.resident = true;
+			mUsedBytes += info.bytes;
+			mReloadCount ++;
+		}
+	}
+
+	bool TextureMemoryManager::evictTexture(ITexture* _texture)
+	{
+		MapTextureInfo::iterator item = mTextures.find(_texture);
+		if (item == mTextures.end() || item->second.name != _texture->getName())
+			return false;
+
+		TextureInfo& info = item->second;
+		if (!info.reloadable || !info.resident || _texture->isLocked() || RenderManager::getInstance()._isTexturePinned(_texture))
+			return false;
+
+		evict(info);
+		return true;
+	}
+
+	size_t TextureMemoryManager::evictUnusedTextures()
+	{
+		validate();
+
+		RenderManager& render = RenderManager::getInstance();
+		size_t result = 0;
+		for (MapTextureInfo::iterator item = mTextures.begin(); item != mTextures.end(); ++item)
+		{
+			TextureInfo& info = item->second;
+			if (info.reloadable && info.resident && info.lastUsedFrame + 1 < mFrame && !info.texture->isLocked() && !render._isTexturePinned(info.texture))
+			{
+				evict(info);
+				result ++;
+			}
+		}
+		return result;
+	}
+
+	size_t TextureMemoryManager::getUsedBytes()
+	{
+		validate();
+		return mUsedBytes;
+	}
+
+	size_t TextureMemoryManager::getTextureCount()
+	{
+		validate();
+		return mTextures.size();
+	}
+
+	void TextureMemoryManager::getTexturesInfo(VectorTextureInfo& _result)
+	{
+		validate();
+
+		_result.clear();
+		_result.reserve(mTextures.size());
+		for (MapTextureInfo::const_iterator item = mTextures.begin(); item != mTextures.end(); ++item)
+			_result.push_back(item->second);
+	}
+
+	size_t TextureMemoryManager::getFrame() const
+	{
+		return mFrame;
+	}
+
+	size_t TextureMemoryManager::getEvictCount() const
+	{
+		return mEvictCount;
+	}
+
+	size_t TextureMemoryManager::getReloadCount() const
+	{
+		return mReloadCount;
+	}
+
+	void TextureMemoryManager::frameEntered(float _time)
+	{
+		mFrame ++;
+
+		// без бюджета выгружать нечего
+		if (mBudget == 0)
+			return;
+
+		validate();
+		if (mUsedBytes > mBudget)
+			evictOverBudget();
+	}
+
+	void TextureMemoryManager::validate()
+	{
+		// текстуры удаляются через RenderManager без уведомления,
+		// живая текстура находится по своему имени, размер мог измениться
+		RenderManager& render = RenderManager::getInstance();
+
+		mUsedBytes = 0;
+		MapTextureInfo::iterator item = mTextures.begin();
+		while (item != mTextures.end())
+		{
+			TextureInfo& info = item->second;
+			if (render.getTexture(info.name) != info.texture)
+			{
+				mTextures.erase(item++);
+				continue;
+			}
+
+			if (info.resident)
+			{
+				info.bytes = getTextureBytes(info.texture);
+				mUsedBytes += info.bytes;
+			}
+			++item;
+		}
+
+		mValidatedCount = mTextures.size();
+	}
+
+	void TextureMemoryManager::evictOverBudget()
+	{
+		// кандидаты не рисовались в прошлом кадре и не используются кадрами в потоке рендера,
+		// выгружаем давно не используемые первыми
+		RenderManager& render = RenderManager::getInstance();
+		std::vector<TextureInfo*> candidates;
+		for (MapTextureInfo::iterator item = mTextures.begin(); item != mTextures.end(); ++item)
+		{
+			TextureInfo& info = item->second;
+			if (info.reloadable && info.resident && info.lastUsedFrame + 1 < mFrame && !info.texture->isLocked() && !render._isTexturePinned(info.texture))
+				candidates.push_back(&info);
+		}
+
+		std::sort(candidates.begin(), candidates.end(), compareLastUsedFrame);
+
+		for (std::vector<TextureInfo*>::iterator item = candidates.begin(); item != candidates.end() && mUsedBytes > mBudget; ++item)
+			evict(**item);
+	}
+
+	void TextureMemoryManager::evict(TextureInfo& _info)
+	{
+		_info.texture->destroy();
+		_info.resident = false;
+		mUsedBytes -= _info.bytes;
+		mEvictCount ++;
+	}
+
+	size_t TextureMemoryManager::getTextureBytes(ITexture* _texture)
+	{
+		return (size_t)_texture->getWidth() * (size_t)_texture->getHeight() * _texture->getNumElemBytes();
+	}
+
+	bool TextureMemoryManager::compareLastUsedFrame(const TextureInfo* _left, const TextureInfo* _right)
+	{
+		return _left->lastUsedFrame < _right->lastUsedFrame;
+	}
+
+} // namespace MyGUI
@@ -8,6 +8,7 @@
 #include "MyGUI_TextureUtility.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_DataManager.h"
+#include "MyGUI_TextureMemoryManager.h"
 #include "MyGUI_Bitwise.h"
 #include "MyGUI_Constants.h"
 
@@ -50,8 +51,15 @@ namespace MyGUI
 						return Constants::getZeroIntSize();
 					}
 					texture->loadFromFile(_texture);
+					if (TextureMemoryManager::getInstancePtr() != nullptr)
+						TextureMemoryManager::getInstance().registerTexture(texture, true);
 				}
 			}
+			else if (TextureMemoryManager::getInstancePtr() != nullptr)
+			{
+				// выгруженная текстура загрузится снова
+				TextureMemoryManager::getInstance().touchTexture(texture);
+			}
 
 			prevSize = IntSize(texture->getWidth(), texture->getHeight());
 			prevTexture = _texture;
@@ -13,6 +13,7 @@
 #include "MyGUI_CommonStateInfo.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_VertexUtility.h"
 
 namespace MyGUI
 {
@@ -193,7 +194,7 @@ namespace MyGUI
 
 		VertexQuad* quad = reinterpret_cast<VertexQuad*>(mRenderItem->getCurrentVertexBuffer());
 
-		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
+		const RenderTargetInfo& info = mRenderItem->getRenderTargetInfo();
 
 		// размер одного тайла
 		mRealTileWidth = info.pixScaleX * (float)(mTileSize.width) * 2;
@@ -312,16 +313,11 @@ namespace MyGUI
 					texture_right -= (right - vertex_right) * mTextureWidthOne;
 				}
 
-				quad[count].set(
-					vertex_left,
-					vertex_top,
-					vertex_right,
-					vertex_bottom,
+				vertex_utility::writeQuad(
+					quad[count].vertex,
+					FloatRect(vertex_left, vertex_top, vertex_right, vertex_bottom),
 					vertex_z,
-					texture_left,
-					texture_top,
-					texture_right,
-					texture_bottom,
+					FloatRect(texture_left, texture_top, texture_right, texture_bottom),
 					mCurrentColour);
 
 				count ++;
@@ -0,0 +1,845 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TreeControl.h"
+#include "MyGUI_TreeControlItem.h"
+#include "MyGUI_ScrollBar.h"
+#include "MyGUI_ImageBox.h"
+#include "MyGUI_ResourceImageSet.h"
+#include "MyGUI_Gui.h"
+
+namespace MyGUI
+{
+
+	// после стольких изменений за кадр строки пересобираются целиком
+	const size_t TREE_CHANGED_NODES_LIMIT = 32;
+
+	TreeControl::Node::Node() :
+		mParent(nullptr),
+		mOwner(nullptr),
+		mPrepared(false),
+		mExpanded(false)
+	{
+	}
+
+	TreeControl::Node::Node(const UString& _text, Node* _parent) :
+		mParent(nullptr),
+		mOwner(nullptr),
+		mText(_text),
+		mImage("Folder"),
+		mPrepared(false),
+		mExpanded(false)
+	{
+		if (_parent != nullptr)
+			_parent->add(this);
+	}
+
+	TreeControl::Node::Node(const UString& _text, const UString& _image, Node* _parent) :
+		mParent(nullptr),
+		mOwner(nullptr),
+		mText(_text),
+		mImage(_image),
+		mPrepared(false),
+		mExpanded(false)
+	{
+		if (_parent != nullptr)
+			_parent->add(this);
+	}
+
+	TreeControl::Node::Node(TreeControl* _owner) :
+		mParent(nullptr),
+		mOwner(_owner),
+		mText("[ROOT]"),
+		mImage("Folder"),
+		mPrepared(false),
+		mExpanded(true)
+	{
+	}
+
+	TreeControl::Node::~Node()
+	{
+		if (mParent != nullptr)
+			mParent->detach(this);
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeRemoved(this);
+
+		// поддерево уже отцеплено, дети удаляются без уведомлений
+		for (VectorNodePtr::iterator child = mChildren.begin(); child != mChildren.end(); ++child)
+		{
+			(*child)->mParent = nullptr;
+			(*child)->setOwner(nullptr);
+			delete (*child);
+		}
+	}
+
+	void TreeControl::Node::add(Node* _node)
+	{
+		MYGUI_ASSERT(_node != nullptr, "TreeControl::Node::add node is nullptr");
+		MYGUI_ASSERT(_node != this && !hasAncestor(_node), "TreeControl::Node::add node can't be added to its descendant");
+
+		if (_node->mParent != nullptr)
+			_node->mParent->detach(_node);
+
+		_node->mParent = this;
+		_node->setOwner(mOwner);
+		mChildren.push_back(_node);
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, mExpanded);
+	}
+
+	void TreeControl::Node::remove(Node* _node, bool _delete)
+	{
+		MYGUI_ASSERT(_node != nullptr && _node->mParent == this, "TreeControl::Node::remove node is not child");
+
+		if (_delete)
+			delete _node;
+		else
+			detach(_node);
+	}
+
+	void TreeControl::Node::removeAll(bool _delete)
+	{
+		if (mChildren.empty())
+			return;
+
+		if (mOwner != nullptr)
+		{
+			for (VectorNodePtr::iterator child = mChildren.begin(); child != mChildren.end(); ++child)
+				mOwner->_notifyNodeRemoved(*child);
+		}
+
+		VectorNodePtr children;
+		children.swap(mChildren);
+
+		for (VectorNodePtr::iterator child = children.begin(); child != children.end(); ++child)
+		{
+			(*child)->mParent = nullptr;
+			(*child)->setOwner(nullptr);
+			if (_delete)
+				delete (*child);
+		}
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, mExpanded);
+	}
+
+	void TreeControl::Node::detach(Node* _node)
+	{
+		VectorNodePtr::iterator item = std::find(mChildren.begin(), mChildren.end(), _node);
+		MYGUI_ASSERT(item != mChildren.end(), "TreeControl::Node::detach node is not child");
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeRemoved(_node);
+
+		mChildren.erase(item);
+		_node->mParent = nullptr;
+		_node->setOwner(nullptr);
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, mExpanded);
+	}
+
+	void TreeControl::Node::setOwner(TreeControl* _owner)
+	{
+		if (mOwner == _owner)
+			return;
+
+		mOwner = _owner;
+		for (VectorNodePtr::iterator child = mChildren.begin(); child != mChildren.end(); ++child)
+			(*child)->setOwner(_owner);
+	}
+
+	bool TreeControl::Node::hasAncestor(const Node* _node) const
+	{
+		for (const Node* parent = mParent; parent != nullptr; parent = parent->mParent)
+		{
+			if (parent == _node)
+				return true;
+		}
+		return false;
+	}
+
+	bool TreeControl::Node::hasDescendant(const Node* _node) const
+	{
+		return _node != nullptr && _node->hasAncestor(this);
+	}
+
+	bool TreeControl::Node::hasChildren() const
+	{
+		return !mChildren.empty();
+	}
+
+	const TreeControl::VectorNodePtr& TreeControl::Node::getChildren() const
+	{
+		return mChildren;
+	}
+
+	TreeControl::Node* TreeControl::Node::getParent() const
+	{
+		return mParent;
+	}
+
+	TreeControl* TreeControl::Node::getOwner() const
+	{
+		return mOwner;
+	}
+
+	const UString& TreeControl::Node::getText() const
+	{
+		return mText;
+	}
+
+	void TreeControl::Node::setText(const UString& _value)
+	{
+		mText = _value;
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, false);
+	}
+
+	const UString& TreeControl::Node::getImage() const
+	{
+		return mImage;
+	}
+
+	void TreeControl::Node::setImage(const UString& _value)
+	{
+		mImage = _value;
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, false);
+	}
+
+	bool TreeControl::Node::isPrepared() const
+	{
+		return mPrepared;
+	}
+
+	void TreeControl::Node::setPrepared(bool _value)
+	{
+		mPrepared = _value;
+	}
+
+	void TreeControl::Node::prepare()
+	{
+		if (mPrepared || mOwner == nullptr)
+			return;
+
+		mPrepared = true;
+		mOwner->eventTreeNodePrepare(mOwner, this);
+	}
+
+	bool TreeControl::Node::isExpanded() const
+	{
+		return mExpanded;
+	}
+
+	void TreeControl::Node::setExpanded(bool _value)
+	{
+		if (mExpanded == _value)
+			return;
+
+		mExpanded = _value;
+
+		if (mOwner != nullptr)
+			mOwner->_notifyNodeChanged(this, true);
+	}
+
+	void TreeControl::Node::setData(Any _data)
+	{
+		mData = _data;
+	}
+
+	TreeControl::TreeControl() :
+		mWidgetScroll(nullptr),
+		mClient(nullptr),
+		mHeightLine(1),
+		mLevelOffset(0),
+		mScrollAlwaysVisible(true),
+		mRootVisible(false),
+		mRoot(nullptr),
+		mSelection(nullptr),
+		mRowsDirty(true),
+		mUpdatingRows(false),
+		mRangeIndex(-1),
+		mTopIndex(0),
+		mOffsetTop(0),
+		mFocusIndex(ITEM_NONE),
+		mInvalidated(false)
+	{
+	}
+
+	void TreeControl::initialiseOverride()
+	{
+		Base::initialiseOverride();
+
+		mRoot = new Node(this);
+
+		// FIXME нам нужен фокус клавы
+		setNeedKeyFocus(true);
+
+		///@wskin_child{TreeControl, ScrollBar, VScroll} Вертикальная полоса прокрутки.
+		assignWidget(mWidgetScroll, "VScroll");
+		if (mWidgetScroll != nullptr)
+		{
+			mWidgetScroll->eventScrollChangePosition += newDelegate(this, &TreeControl::notifyScrollChangePosition);
+			mWidgetScroll->eventMouseButtonPressed += newDelegate(this, &TreeControl::notifyMousePressed);
+		}
+
+		///@wskin_child{TreeControl, Widget, Client} Клиентская зона.
+		assignWidget(mClient, "Client");
+		if (mClient != nullptr)
+		{
+			mClient->eventMouseButtonPressed += newDelegate(this, &TreeControl::notifyMousePressed);
+			setWidgetClient(mClient);
+		}
+
+		MYGUI_ASSERT(nullptr != mWidgetScroll, "Child VScroll not found in skin (TreeControl must have VScroll)");
+		MYGUI_ASSERT(nullptr != mClient, "Child Widget Client not found in skin (TreeControl must have Client)");
+
+		///@wskin_property{TreeControl, SkinLine} Скин строки, виджет типа TreeControlItem.
+		if (isUserString("SkinLine"))
+			mSkinLine = getUserString("SkinLine");
+		///@wskin_property{TreeControl, HeightLine} Высота строки.
+		if (isUserString("HeightLine"))
+			mHeightLine = utility::parseInt(getUserString("HeightLine"));
+		///@wskin_property{TreeControl, LevelOffset} Отступ строки для каждого уровня вложенности.
+		if (isUserString("LevelOffset"))
+			mLevelOffset = utility::parseInt(getUserString("LevelOffset"));
+
+		MYGUI_ASSERT(!mSkinLine.empty(), "SkinLine property not found (TreeControl must have SkinLine property)");
+
+		if (mHeightLine < 1)
+			mHeightLine = 1;
+
+		mWidgetScroll->setScrollPage((size_t)mHeightLine);
+		mWidgetScroll->setScrollViewPage((size_t)mHeightLine);
+
+		invalidate();
+	}
+
+	void TreeControl::shutdownOverride()
+	{
+		if (mInvalidated)
+		{
+			Gui::getInstance().eventFrameStart -= newDelegate(this, &TreeControl::notifyFrameEntered);
+			mInvalidated = false;
+		}
+
+		// дерево удаляется без уведомлений
+		mRoot->setOwner(nullptr);
+		delete mRoot;
+		mRoot = nullptr;
+		mSelection = nullptr;
+
+		mRows.clear();
+		mChangedNodes.clear();
+		mWidgetLines.clear();
+
+		mWidgetScroll = nullptr;
+		mClient = nullptr;
+
+		Base::shutdownOverride();
+	}
+
+	TreeControl::Node* TreeControl::getRoot() const
+	{
+		return mRoot;
+	}
+
+	void TreeControl::setRootVisible(bool _value)
+	{
+		if (mRootVisible == _value)
+			return;
+
+		mRootVisible = _value;
+		mRowsDirty = true;
+		invalidate();
+	}
+
+	bool TreeControl::isRootVisible() const
+	{
+		return mRootVisible;
+	}
+
+	TreeControl::Node* TreeControl::getSelection() const
+	{
+		return mSelection;
+	}
+
+	void TreeControl::setSelection(Node* _value)
+	{
+		if (mSelection == _value)
+			return;
+
+		mSelection = _value;
+		for (Node* node = _value; node != nullptr; node = node->getParent())
+			node->setExpanded(true);
+
+		invalidate();
+		eventTreeNodeSelected(this, mSelection);
+	}
+
+	size_t TreeControl::getRowCount()
+	{
+		updateRows();
+		return mRows.size();
+	}
+
+	TreeControl::Node* TreeControl::getNodeAt(size_t _row)
+	{
+		updateRows();
+		return _row < mRows.size() ? mRows[_row].node : nullptr;
+	}
+
+	void TreeControl::beginToRow(size_t _row)
+	{
+		if (mInvalidated)
+			updateTree();
+
+		int position = (int)_row * mHeightLine;
+		if (position > mRangeIndex)
+			position = mRangeIndex;
+		if (position < 0)
+			position = 0;
+
+		mWidgetScroll->setScrollPosition(position);
+		scrollTo(position);
+	}
+
+	void TreeControl::invalidate()
+	{
+		if (mInvalidated)
+			return;
+
+		Gui::getInstance().eventFrameStart += newDelegate(this, &TreeControl::notifyFrameEntered);
+		mInvalidated = true;
+	}
+
+	void TreeControl::_notifyNodeChanged(Node* _node, bool _structure)
+	{
+		// узел сейчас раскрывается, его дети будут прочитаны после prepare
+		if (mUpdatingRows)
+			return;
+
+		if (_structure && !mRowsDirty)
+		{
+			if (std::find(mChangedNodes.begin(), mChangedNodes.end(), _node) == mChangedNodes.end())
+				mChangedNodes.push_back(_node);
+
+			if (mChangedNodes.size() > TREE_CHANGED_NODES_LIMIT)
+			{
+				mRowsDirty = true;
+				mChangedNodes.clear();
+			}
+		}
+
+		invalidate();
+	}
+
+	void TreeControl::_notifyNodeRemoved(Node* _node)
+	{
+		if (mSelection != nullptr && (mSelection == _node || mSelection->hasAncestor(_node)))
+			mSelection = nullptr;
+
+		VectorNodePtr::iterator item = std::find(mChangedNodes.begin(), mChangedNodes.end(), _node);
+		if (item != mChangedNodes.end())
+			mChangedNodes.erase(item);
+	}
+
+	bool TreeControl::isNodeShown(Node* _node) const
+	{
+		if (_node->getOwner() != this)
+			return false;
+
+		for (Node* parent = _node->getParent(); parent != nullptr; parent = parent->getParent())
+		{
+			// невидимый корень всегда раскрыт
+			if (!parent->isExpanded() && (parent != mRoot || mRootVisible))
+				return false;
+		}
+
+		return _node != mRoot || mRootVisible;
+	}
+
+	void TreeControl::flattenChildren(Node* _node, size_t _level, VectorRow& _rows)
+	{
+		_node->prepare();
+
+		const VectorNodePtr& children = _node->getChildren();
+		for (VectorNodePtr::const_iterator child = children.begin(); child != children.end(); ++child)
+		{
+			_rows.push_back(Row(*child, _level));
+			if ((*child)->isExpanded())
+				flattenChildren(*child, _level + 1, _rows);
+		}
+	}
+
+	void TreeControl::updateRows()
+	{
+		if (!mRowsDirty && mChangedNodes.empty())
+			return;
+
+		mUpdatingRows = true;
+
+		// невидимый корень меняет все строки
+		if (std::find(mChangedNodes.begin(), mChangedNodes.end(), mRoot) != mChangedNodes.end() && !mRootVisible)
+			mRowsDirty = true;
+
+		if (mRowsDirty)
+		{
+			mRows.clear();
+			if (mRootVisible)
+			{
+				mRows.push_back(Row(mRoot, 0));
+				if (mRoot->isExpanded())
+					flattenChildren(mRoot, 1, mRows);
+			}
+			else
+			{
+				flattenChildren(mRoot, 0, mRows);
+			}
+		}
+		else
+		{
+			// заменяем только строки поддеревьев изменившихся узлов
+			for (size_t index = 0; index < mChangedNodes.size(); ++index)
+			{
+				Node* node = mChangedNodes[index];
+				if (!isNodeShown(node))
+					continue;
+
+				size_t start = 0;
+				while (start < mRows.size() && mRows[start].node != node)
+					++start;
+				if (start == mRows.size())
+					continue;
+
+				size_t level = mRows[start].level;
+				size_t end = start + 1;
+				while (end < mRows.size() && mRows[end].level > level)
+					++end;
+
+				VectorRow rows;
+				if (node->isExpanded())
+					flattenChildren(node, level + 1, rows);
+
+				mRows.erase(mRows.begin() + start + 1, mRows.begin() + end);
+				mRows.insert(mRows.begin() + start + 1, rows.begin(), rows.end());
+			}
+		}
+
+		mRowsDirty = false;
+		mChangedNodes.clear();
+		mUpdatingRows = false;
+	}
+
+	void TreeControl::onMouseWheel(int _rel)
+	{
+		notifyMouseWheel(nullptr, _rel);
+
+		Base::onMouseWheel(_rel);
+	}
+
+	void TreeControl::setPosition(const IntPoint& _point)
+	{
+		Base::setPosition(_point);
+	}
+
+	void TreeControl::setSize(const IntSize& _size)
+	{
+		Base::setSize(_size);
+
+		invalidate();
+	}
+
+	void TreeControl::setCoord(const IntCoord& _coord)
+	{
+		Base::setCoord(_coord);
+
+		invalidate();
+	}
+
+	void TreeControl::setPosition(int _left, int _top)
+	{
+		setPosition(IntPoint(_left, _top));
+	}
+
+	void TreeControl::setSize(int _width, int _height)
+	{
+		setSize(IntSize(_width, _height));
+	}
+
+	void TreeControl::setCoord(int _left, int _top, int _width, int _height)
+	{
+		setCoord(IntCoord(_left, _top, _width, _height));
+	}
+
+	void TreeControl::notifyFrameEntered(float _time)
+	{
+		if (mInvalidated)
+			updateTree();
+	}
+
+	void TreeControl::updateTree()
+	{
+		if (mInvalidated)
+		{
+			mInvalidated = false;
+			Gui::getInstance().eventFrameStart -= newDelegate(this, &TreeControl::notifyFrameEntered);
+		}
+
+		updateRows();
+		updateScroll();
+		updateLines();
+		redrawLines();
+	}
+
+	void TreeControl::updateScroll()
+	{
+		mRangeIndex = (mHeightLine * (int)mRows.size()) - mClient->getHeight();
+
+		if (!mScrollAlwaysVisible || mRangeIndex <= 0 || mWidgetScroll->getLeft() <= mClient->getLeft())
+		{
+			if (mWidgetScroll->getVisible())
+			{
+				mWidgetScroll->setVisible(false);
+				mClient->setSize(mClient->getWidth() + mWidgetScroll->getWidth(), mClient->getHeight());
+			}
+		}
+		else if (!mWidgetScroll->getVisible())
+		{
+			mClient->setSize(mClient->getWidth() - mWidgetScroll->getWidth(), mClient->getHeight());
+			mWidgetScroll->setVisible(true);
+		}
+
+		mWidgetScroll->setScrollRange(mRangeIndex + 1);
+
+		if (!mRows.empty())
+			mWidgetScroll->setTrackSize(mWidgetScroll->getLineSize() * mClient->getHeight() / mHeightLine / (int)mRows.size());
+	}
+
+	void TreeControl::updateLines()
+	{
+		// строк всегда на одну больше, чем помещается в клиент
+		int height = (int)mWidgetLines.size() * mHeightLine - mOffsetTop;
+		while ((height <= (mClient->getHeight() + mHeightLine)) && mWidgetLines.size() < mRows.size())
+		{
+			TreeControlItem* line = mClient->createWidget<TreeControlItem>(mSkinLine, IntCoord(0, height, mClient->getWidth(), mHeightLine), Align::Top | Align::HStretch);
+
+			line->eventMouseButtonPressed += newDelegate(this, &TreeControl::notifyMousePressed);
+			line->eventMouseButtonDoubleClick += newDelegate(this, &TreeControl::notifyMouseDoubleClick);
+			line->eventMouseWheel += newDelegate(this, &TreeControl::notifyMouseWheel);
+			line->eventMouseSetFocus += newDelegate(this, &TreeControl::notifyMouseSetFocus);
+			line->eventMouseLostFocus += newDelegate(this, &TreeControl::notifyMouseLostFocus);
+			line->getButtonExpandCollapse()->eventMouseButtonClick += newDelegate(this, &TreeControl::notifyExpandCollapse);
+			// присваиваем порядковый номер, для простоты просчета
+			line->_setInternalData((size_t)mWidgetLines.size());
+
+			mWidgetLines.push_back(line);
+			height += mHeightLine;
+		}
+
+		int position = mTopIndex * mHeightLine + mOffsetTop;
+		if (position >= mRangeIndex)
+		{
+			// размер всех помещается в клиент
+			if (mRangeIndex <= 0)
+			{
+				position = 0;
+				mTopIndex = 0;
+				mOffsetTop = 0;
+			}
+			// прижимаем список к нижней границе
+			else
+			{
+				int count = mClient->getHeight() / mHeightLine;
+				mOffsetTop = mHeightLine - (mClient->getHeight() % mHeightLine);
+
+				if (mOffsetTop == mHeightLine)
+				{
+					mOffsetTop = 0;
+					count --;
+				}
+
+				mTopIndex = (int)mRows.size() - count - 1;
+				position = mTopIndex * mHeightLine + mOffsetTop;
+			}
+		}
+
+		mWidgetScroll->setScrollPosition(position);
+	}
+
+	void TreeControl::redrawLines()
+	{
+		int offset = 0 - mOffsetTop;
+		size_t pos = 0;
+		for (; pos < mWidgetLines.size(); ++pos)
+		{
+			size_t index = pos + (size_t)mTopIndex;
+			if (index >= mRows.size() || offset > mClient->getHeight())
+				break;
+
+			const Row& row = mRows[index];
+			Node* node = row.node;
+
+			// узел готовится только когда его строка видна
+			node->prepare();
+
+			TreeControlItem* line = mWidgetLines[pos];
+			line->setVisible(true);
+			line->setCaption(node->getText());
+			line->setPosition(IntPoint((int)row.level * mLevelOffset, offset));
+			line->setStateSelected(node == mSelection);
+			line->setUserData(node);
+
+			Button* expandCollapse = line->getButtonExpandCollapse();
+			expandCollapse->setVisible(node->hasChildren());
+			expandCollapse->setStateSelected(!node->isExpanded());
+
+			ImageBox* icon = line->getIcon();
+			if (icon != nullptr)
+			{
+				ResourceImageSetPtr resource = icon->getItemResource();
+				if (resource != nullptr)
+				{
+					ImageIndexInfo info = resource->getIndexInfo(node->getImage(), node->isExpanded() ? "Expanded" : "Collapsed");
+					if (info.size.empty())
+						icon->setItemResourceInfo(resource->getIndexInfo(node->getImage(), "Common"));
+					else
+						icon->setItemResourceInfo(info);
+				}
+			}
+
+			offset += mHeightLine;
+		}
+
+		for (; pos < mWidgetLines.size(); ++pos)
+		{
+			mWidgetLines[pos]->setStateSelected(false);
+			mWidgetLines[pos]->setVisible(false);
+		}
+	}
+
+	void TreeControl::scrollTo(size_t _position)
+	{
+		mOffsetTop = ((int)_position % mHeightLine);
+		mTopIndex = ((int)_position / mHeightLine);
+
+		// строки уже разложены, переиспользуем виджеты сразу
+		if (!mRowsDirty && mChangedNodes.empty() && !mInvalidated)
+			redrawLines();
+		else
+			invalidate();
+	}
+
+	void TreeControl::sendScrollingEvents(size_t _position)
+	{
+		eventTreeScrolled(this, _position);
+		if (mFocusIndex != ITEM_NONE)
+			eventTreeNodeMouseSetFocus(this, getLineNode(mWidgetLines[mFocusIndex]));
+	}
+
+	TreeControl::Node* TreeControl::getLineNode(Widget* _line)
+	{
+		updateRows();
+
+		size_t index = *_line->_getInternalData<size_t>() + (size_t)mTopIndex;
+		return index < mRows.size() ? mRows[index].node : nullptr;
+	}
+
+	void TreeControl::notifyMousePressed(Widget* _sender, int _left, int _top, MouseButton _id)
+	{
+		if ((_id == MouseButton::Left || _id == MouseButton::Right) && _sender != mWidgetScroll)
+		{
+			Node* selection = mSelection;
+			if (_sender == mClient)
+				selection = nullptr;
+			else if (_sender->getVisible())
+				selection = getLineNode(_sender);
+
+			setSelection(selection);
+
+			if (_id == MouseButton::Right)
+				eventTreeNodeContextMenu(this, mSelection);
+		}
+	}
+
+	void TreeControl::notifyMouseWheel(Widget* _sender, int _rel)
+	{
+		if (mRangeIndex <= 0)
+			return;
+
+		int position = (int)mWidgetScroll->getScrollPosition();
+		if (_rel < 0)
+			position += mHeightLine;
+		else
+			position -= mHeightLine;
+
+		if (position >= mRangeIndex)
+			position = mRangeIndex;
+		else if (position < 0)
+			position = 0;
+
+		if ((int)mWidgetScroll->getScrollPosition() == position)
+			return;
+
+		mWidgetScroll->setScrollPosition(position);
+
+		scrollTo(position);
+		sendScrollingEvents(position);
+	}
+
+	void TreeControl::notifyMouseDoubleClick(Widget* _sender)
+	{
+		if (mSelection != nullptr)
+			eventTreeNodeActivated(this, mSelection);
+	}
+
+	void TreeControl::notifyMouseSetFocus(Widget* _sender, Widget* _old)
+	{
+		mFocusIndex = *_sender->_getInternalData<size_t>();
+		eventTreeNodeMouseSetFocus(this, getLineNode(_sender));
+	}
+
+	void TreeControl::notifyMouseLostFocus(Widget* _sender, Widget* _new)
+	{
+		if (_new == nullptr || _new->getParent() != mClient)
+		{
+			mFocusIndex = ITEM_NONE;
+			eventTreeNodeMouseLostFocus(this, nullptr);
+		}
+	}
+
+	void TreeControl::notifyScrollChangePosition(ScrollBar* _sender, size_t _position)
+	{
+		scrollTo(_position);
+		sendScrollingEvents(_position);
+	}
+
+	void TreeControl::notifyExpandCollapse(Widget* _sender)
+	{
+		TreeControlItem* line = _sender->getParent()->castType<TreeControlItem>(false);
+		if (line == nullptr)
+			return;
+
+		Node* node = getLineNode(line);
+		if (node == nullptr)
+			return;
+
+		node->setExpanded(!node->isExpanded());
+
+		if (!node->isExpanded() && mSelection != nullptr && mSelection->hasAncestor(node))
+		{
+			mSelection = node;
+			eventTreeNodeSelected(this, mSelection);
+		}
+	}
+
+} // namespace MyGUI
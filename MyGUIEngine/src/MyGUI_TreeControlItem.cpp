@@ -0,0 +1,81 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TreeControlItem.h"
+#include "MyGUI_ImageBox.h"
+
+namespace MyGUI
+{
+
+	TreeControlItem::TreeControlItem() :
+		mButtonExpandCollapse(nullptr),
+		mIcon(nullptr)
+	{
+	}
+
+	void TreeControlItem::initialiseOverride()
+	{
+		Base::initialiseOverride();
+
+		///@wskin_child{TreeControlItem, Button, ButtonExpandCollapse} Кнопка разворачивания узла.
+		assignWidget(mButtonExpandCollapse, "ButtonExpandCollapse");
+		if (mButtonExpandCollapse != nullptr)
+		{
+			mButtonExpandCollapse->eventMouseSetFocus += newDelegate(this, &TreeControlItem::notifyMouseSetFocus);
+			mButtonExpandCollapse->eventMouseLostFocus += newDelegate(this, &TreeControlItem::notifyMouseLostFocus);
+			mButtonExpandCollapse->eventMouseWheel += newDelegate(this, &TreeControlItem::notifyMouseWheel);
+		}
+
+		///@wskin_child{TreeControlItem, ImageBox, Image} Иконка узла.
+		assignWidget(mIcon, "Image");
+
+		MYGUI_ASSERT(nullptr != mButtonExpandCollapse, "Child ButtonExpandCollapse not found in skin (TreeControlItem must have ButtonExpandCollapse)");
+	}
+
+	void TreeControlItem::shutdownOverride()
+	{
+		mButtonExpandCollapse = nullptr;
+		mIcon = nullptr;
+
+		Base::shutdownOverride();
+	}
+
+	void TreeControlItem::notifyMouseSetFocus(Widget* _sender, Widget* _old)
+	{
+		if (_sender != nullptr && _sender->getParent() == this)
+			onMouseSetFocus(_old);
+	}
+
+	void TreeControlItem::notifyMouseLostFocus(Widget* _sender, Widget* _new)
+	{
+		if (_sender != nullptr && _sender->getParent() == this)
+			onMouseLostFocus(_new);
+	}
+
+	void TreeControlItem::notifyMouseWheel(Widget* _sender, int _rel)
+	{
+		if (_sender != nullptr && _sender->getParent() == this)
+			onMouseWheel(_rel);
+	}
+
+	TreeControl::Node* TreeControlItem::getNode() const
+	{
+		TreeControl::Node** node = getUserData<TreeControl::Node*>(false);
+		return node != nullptr ? *node : nullptr;
+	}
+
+	Button* TreeControlItem::getButtonExpandCollapse() const
+	{
+		return mButtonExpandCollapse;
+	}
+
+	ImageBox* TreeControlItem::getIcon() const
+	{
+		return mIcon;
+	}
+
+} // namespace MyGUI
@@ -0,0 +1,397 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TweenManager.h"
+#include "MyGUI_Gui.h"
+#include "MyGUI_WidgetManager.h"
+#include "MyGUI_Widget.h"
+#include "MyGUI_ActionController.h"
+
+namespace MyGUI
+{
+
+	template <> TweenManager* Singleton<TweenManager>::msInstance = nullptr;
+	template <> const char* Singleton<TweenManager>::mClassTypeName = "TweenManager";
+
+	TweenManager::TweenManager() :
+		mFrameSubscribed(false),
+		mIsInitialise(false)
+	{
+	}
+
+	void TweenManager::initialise()
+	{
+		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
+		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
+
+		WidgetManager::getInstance().registerUnlinker(this);
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
+	}
+
+	void TweenManager::shutdown()
+	{
+		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
+		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
+
+		WidgetManager::getInstance().unregisterUnlinker(this);
+
+		mAlphaTracks.clear();
+		mPositionTracks.clear();
+		mCoordTracks.clear();
+		mSlots.clear();
+		mFreeSlots.clear();
+		mWidgetSlots.clear();
+		mFinished.clear();
+		updateFrameSubscription();
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
+	}
+
+	TweenHandle TweenManager::addAlpha(Widget* _widget, float _from, float _to, float _time, Function _function)
+	{
+		MYGUI_ASSERT(_widget != nullptr, "Tween widget is nullptr");
+
+		removeWidgetTracks(_widget, TrackAlpha);
+
+		AlphaTrack track;
+		track.widget = _widget;
+		track.from = _from;
+		track.delta = _to - _from;
+		track.elapsed = 0;
+		track.time = _time;
+		track.function = _function;
+		track.slot = createSlot(_widget, TrackAlpha, mAlphaTracks.size());
+		mAlphaTracks.push_back(track);
+
+		updateFrameSubscription();
+		return getHandle(track.slot);
+	}
+
+	TweenHandle TweenManager::addPosition(Widget* _widget, const IntPoint& _from, const IntPoint& _to, float _time, Function _function)
+	{
+		return addCoordTrack(TrackPosition, _widget, IntCoord(_from, IntSize()), IntCoord(_to, IntSize()), _time, _function);
+	}
+
+	TweenHandle TweenManager::addCoord(Widget* _widget, const IntCoord& _from, const IntCoord& _to, float _time, Function _function)
+	{
+		return addCoordTrack(TrackCoord, _widget, _from, _to, _time, _function);
+	}
+
+	TweenHandle TweenManager::addCoordTrack(TrackType _type, Widget* _widget, const IntCoord& _from, const IntCoord& _to, float _time, Function _function)
+	{
+		MYGUI_ASSERT(_widget != nullptr, "Tween widget is nullptr");
+
+		// позиция и координаты управляют одним и тем же
+		removeWidgetTracks(_widget, TrackPosition);
+
+		VectorCoordTrack& tracks = _type == TrackPosition ? mPositionTracks : mCoordTracks;
+
+		CoordTrack track;
+		track.widget = _widget;
+		track.from = _from;
+		track.to = _to;
+		track.elapsed = 0;
+		track.time = _time;
+		track.function = _function;
+		track.slot = createSlot(_widget, _type, tracks.size());
+		tracks.push_back(track);
+
+		updateFrameSubscription();
+		return getHandle(track.slot);
+	}
+
+	bool TweenManager::removeTrack(TweenHandle _handle)
+	{
+		uint32 slot = 0;
+		if (!findSlot(_handle, slot))
+			return false;
+
+		removeSlot(slot);
+		updateFrameSubscription();
+		return true;
+	}
+
+	void TweenManager::removeAllTracks(Widget* _widget)
+	{
+		removeWidgetTracks(_widget, TrackTypeCount);
+		updateFrameSubscription();
+	}
+
+	bool TweenManager::isTrackActive(TweenHandle _handle) const
+	{
+		uint32 slot = 0;
+		return findSlot(_handle, slot);
+	}
+
+	size_t TweenManager::getTrackCount() const
+	{
+		return mAlphaTracks.size() + mPositionTracks.size() + mCoordTracks.size();
+	}
+
+	void TweenManager::update(float _time)
+	{
+		WidgetManager::getInstance().beginUpdate();
+
+		// треки берутся по индексу заново, виджет в событиях может удалить или добавить треки
+		for (size_t index = 0; index < mAlphaTracks.size(); ++index)
+		{
+			AlphaTrack& track = mAlphaTracks[index];
+			track.elapsed += _time;
+
+			float k = 1;
+			if (track.elapsed < track.time)
+				k = getFactor(track.function, track.elapsed / track.time);
+			else
+				mFinished.push_back(getHandle(track.slot));
+
+			track.widget->setAlpha(track.from + track.delta * k);
+		}
+
+		for (size_t index = 0; index < mPositionTracks.size(); ++index)
+		{
+			CoordTrack& track = mPositionTracks[index];
+			track.elapsed += _time;
+
+			float k = 1;
+			if (track.elapsed < track.time)
+				k = getFactor(track.function, track.elapsed / track.time);
+			else
+				mFinished.push_back(getHandle(track.slot));
+
+			IntCoord coord;
+			action::linearMoveFunction(track.from, track.to, coord, k);
+			track.widget->setPosition(coord.point());
+		}
+
+		for (size_t index = 0; index < mCoordTracks.size(); ++index)
+		{
+			CoordTrack& track = mCoordTracks[index];
+			track.elapsed += _time;
+
+			float k = 1;
+			if (track.elapsed < track.time)
+				k = getFactor(track.function, track.elapsed / track.time);
+			else
+				mFinished.push_back(getHandle(track.slot));
+
+			IntCoord coord;
+			action::linearMoveFunction(track.from, track.to, coord, k);
+			track.widget->setCoord(coord);
+		}
+
+		WidgetManager::getInstance().endUpdate();
+
+		if (mFinished.empty())
+			return;
+
+		std::vector<TweenHandle> finished;
+		finished.swap(mFinished);
+
+		for (std::vector<TweenHandle>::const_iterator item = finished.begin(); item != finished.end(); ++item)
+		{
+			// трек мог быть удален или заменен в событии предыдущего
+			uint32 slot = 0;
+			if (!findSlot(*item, slot))
+				continue;
+
+			Widget* widget = mSlots[slot].widget;
+			removeSlot(slot);
+			eventTrackFinished(widget, *item);
+		}
+
+		updateFrameSubscription();
+	}
+
+	void TweenManager::frameEntered(float _time)
+	{
+		update(_time);
+	}
+
+	void TweenManager::_unlinkWidget(Widget* _widget)
+	{
+		removeAllTracks(_widget);
+	}
+
+	uint32 TweenManager::createSlot(Widget* _widget, TrackType _type, size_t _index)
+	{
+		uint32 slot = 0;
+		if (!mFreeSlots.empty())
+		{
+			slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+		else
+		{
+			MYGUI_ASSERT(mSlots.size() < (size_t)SlotMask - 1, "Too many tween tracks");
+			slot = (uint32)mSlots.size();
+			Slot item;
+			item.generation = 0;
+			mSlots.push_back(item);
+		}
+
+		Slot& item = mSlots[slot];
+		item.type = _type;
+		item.index = (uint32)_index;
+		item.widget = _widget;
+		item.prevWidgetSlot = SlotMask;
+
+		// ставим в начало списка треков виджета
+		std::pair<MapWidgetSlot::iterator, bool> head = mWidgetSlots.insert(MapWidgetSlot::value_type(_widget, slot));
+		if (head.second)
+		{
+			item.nextWidgetSlot = SlotMask;
+		}
+		else
+		{
+			item.nextWidgetSlot = head.first->second;
+			mSlots[head.first->second].prevWidgetSlot = slot;
+			head.first->second = slot;
+		}
+
+		return slot;
+	}
+
+	void TweenManager::removeSlot(uint32 _slot)
+	{
+		Slot& item = mSlots[_slot];
+
+		// на место удаленного трека ставим последний
+		uint32 type = item.type;
+		size_t last = 0;
+		if (type == TrackAlpha)
+			last = mAlphaTracks.size() - 1;
+		else if (type == TrackPosition)
+			last = mPositionTracks.size() - 1;
+		else
+			last = mCoordTracks.size() - 1;
+
+		if (item.index != last)
+			moveTrack(type, last, item.index);
+
+		if (type == TrackAlpha)
+			mAlphaTracks.pop_back();
+		else if (type == TrackPosition)
+			mPositionTracks.pop_back();
+		else
+			mCoordTracks.pop_back();
+
+		// убираем из списка треков виджета
+		if (item.prevWidgetSlot != SlotMask)
+			mSlots[item.prevWidgetSlot].nextWidgetSlot = item.nextWidgetSlot;
+		else if (item.nextWidgetSlot != SlotMask)
+			mWidgetSlots[item.widget] = item.nextWidgetSlot;
+		else
+			mWidgetSlots.erase(item.widget);
+
+		if (item.nextWidgetSlot != SlotMask)
+			mSlots[item.nextWidgetSlot].prevWidgetSlot = item.prevWidgetSlot;
+
+		// старые хендлы слота становятся недействительными
+		item.type = TrackTypeCount;
+		item.widget = nullptr;
+		item.generation ++;
+		mFreeSlots.push_back(_slot);
+	}
+
+	void TweenManager::moveTrack(uint32 _type, size_t _from, size_t _to)
+	{
+		uint32 slot = 0;
+		if (_type == TrackAlpha)
+		{
+			mAlphaTracks[_to] = mAlphaTracks[_from];
+			slot = mAlphaTracks[_to].slot;
+		}
+		else
+		{
+			VectorCoordTrack& tracks = _type == TrackPosition ? mPositionTracks : mCoordTracks;
+			tracks[_to] = tracks[_from];
+			slot = tracks[_to].slot;
+		}
+
+		mSlots[slot].index = (uint32)_to;
+	}
+
+	void TweenManager::removeWidgetTracks(Widget* _widget, TrackType _type)
+	{
+		MapWidgetSlot::iterator head = mWidgetSlots.find(_widget);
+		if (head == mWidgetSlots.end())
+			return;
+
+		uint32 slot = head->second;
+		while (slot != SlotMask)
+		{
+			uint32 next = mSlots[slot].nextWidgetSlot;
+			uint32 type = mSlots[slot].type;
+
+			// TrackPosition удаляет и позицию и координаты, TrackTypeCount все треки
+			bool remove = _type == TrackTypeCount || type == (uint32)_type ||
+				(_type == TrackPosition && type == TrackCoord);
+			if (remove)
+				removeSlot(slot);
+
+			slot = next;
+		}
+	}
+
+	TweenHandle TweenManager::getHandle(uint32 _slot) const
+	{
+		return ((TweenHandle)mSlots[_slot].generation << SlotBits) | (_slot + 1);
+	}
+
+	bool TweenManager::findSlot(TweenHandle _handle, uint32& _slot) const
+	{
+		size_t slot = _handle & SlotMask;
+		if (slot == 0 || slot > mSlots.size())
+			return false;
+
+		slot --;
+		const Slot& item = mSlots[slot];
+		if (item.type == TrackTypeCount || getHandle((uint32)slot) != _handle)
+			return false;
+
+		_slot = (uint32)slot;
+		return true;
+	}
+
+	void TweenManager::updateFrameSubscription()
+	{
+		bool need = getTrackCount() != 0;
+		if (need == mFrameSubscribed)
+			return;
+
+		if (need)
+			Gui::getInstance().eventFrameStart += newDelegate(this, &TweenManager::frameEntered);
+		else
+			Gui::getInstance().eventFrameStart -= newDelegate(this, &TweenManager::frameEntered);
+		mFrameSubscribed = need;
+	}
+
+	float TweenManager::getFactor(Function _function, float _k)
+	{
+		if (_function == Accelerated)
+			return (float)pow(_k, 3.0f);
+		if (_function == Slowed)
+			return (float)pow(_k, 0.4f);
+
+		if (_function == Inertional)
+		{
+#ifndef M_PI
+			const float M_PI = 3.141593f;
+#endif
+			float k = sin(M_PI * _k - M_PI / 2.0f);
+			if (k < 0) k = (-pow(-k, 0.7f) + 1) / 2;
+			else k = (pow(k, 0.7f) + 1) / 2;
+			return k;
+		}
+
+		return _k;
+	}
+
+} // namespace MyGUI
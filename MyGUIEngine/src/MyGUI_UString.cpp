@@ -6,10 +6,21 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_UString.h"
+#include "MyGUI_UTF8Iterator.h"
+#include <cstring>
+
+// счетчики не синхронизированы между потоками, поэтому только для профилирования
+#ifdef MYGUI_USTRING_STATISTICS
+#	define MYGUI_USTRING_COUNT(counter) ms_conversionStatistics.counter++
+#else
+#	define MYGUI_USTRING_COUNT(counter)
+#endif
 
 namespace MyGUI
 {
 
+	UString::ConversionStatistics UString::ms_conversionStatistics = { 0, 0, 0, 0, 0 };
+
 	//--------------------------------------------------------------------------
 	UString::_base_iterator::_base_iterator()
 	{
@@ -730,6 +741,17 @@ namespace MyGUI
 		return m_buffer.mWStrBuffer->c_str();
 	}
 
+	const UString::ConversionStatistics& UString::getConversionStatistics()
+	{
+		return ms_conversionStatistics;
+	}
+
+	void UString::resetConversionStatistics()
+	{
+		ConversionStatistics empty = { 0, 0, 0, 0, 0 };
+		ms_conversionStatistics = empty;
+	}
+
 	UString::code_point& UString::at( size_type loc )
 	{
 		return mData.at( loc );
@@ -886,6 +908,8 @@ namespace MyGUI
 
 	UString& UString::assign( const std::wstring& wstr )
 	{
+		MYGUI_USTRING_COUNT(fromWStr);
+
 		mData.clear();
 		mData.reserve( wstr.length() ); // best guess bulk allocate
 #ifdef WCHAR_UTF16 // if we're already working in UTF-16, this is easy
@@ -927,48 +951,34 @@ namespace MyGUI
 
 	UString& UString::assign( const std::string& str )
 	{
-		size_type len = _verifyUTF8( str );
-		clear(); // empty our contents, if there are any
-		reserve( len ); // best guess bulk capacity growth
-
-		// This is a 3 step process, converting each byte in the UTF-8 stream to UTF-32,
-		// then converting it to UTF-16, then finally appending the data buffer
-
-		unicode_char uc;          // temporary Unicode character buffer
-		unsigned char utf8buf[7]; // temporary UTF-8 buffer
-		utf8buf[6] = 0;
-		size_t utf8len;           // UTF-8 length
-		code_point utf16buff[3];  // temporary UTF-16 buffer
-		utf16buff[2] = 0;
-		size_t utf16len;          // UTF-16 length
-
-		std::string::const_iterator i, ie = str.end();
-		for ( i = str.begin(); i != ie; i++ ) {
-			utf8len = _utf8_char_length( static_cast<unsigned char>( *i ) ); // estimate bytes to load
-			for ( size_t j = 0; j < utf8len; j++ ) { // load the needed UTF-8 bytes
-				utf8buf[j] = ( static_cast<unsigned char>( *( i + j ) ) ); // we don't increment 'i' here just in case the estimate is wrong (shouldn't happen, but we're being careful)
-			}
-			utf8buf[utf8len] = 0; // nul terminate so we throw an exception before running off the end of the buffer
-			utf8len = _utf8_to_utf32( utf8buf, uc ); // do the UTF-8 -> UTF-32 conversion
-			i += utf8len - 1; // we subtract 1 for the increment of the 'for' loop
-
-			utf16len = _utf32_to_utf16( uc, utf16buff ); // UTF-32 -> UTF-16 conversion
-			append( utf16buff, utf16len ); // append the characters to the string
-		}
-		return *this;
+		return assign( str.data(), str.size() );
 	}
 
 	UString& UString::assign( const char* c_str )
 	{
-		std::string tmp( c_str );
-		return assign( tmp );
+		return assign( c_str, strlen( c_str ) );
 	}
 
 	UString& UString::assign( const char* c_str, size_type num )
 	{
-		std::string tmp;
-		tmp.assign( c_str, num );
-		return assign( tmp );
+		MYGUI_USTRING_COUNT(fromUTF8);
+
+		mData.clear(); // empty our contents, if there are any
+		mData.reserve( num ); // UTF-16 never needs more code points than UTF-8 needs bytes
+
+		// decode UTF-8 stream in place, characters outside of BMP are stored as surrogate pairs
+		code_point utf16buff[2];
+		UTF8Iterator i( c_str, c_str + num );
+		while ( !i.isEnd() ) {
+			unicode_char uc = i.getNext();
+			if ( uc < 0xD800 ) {
+				mData.push_back( static_cast<code_point>( uc ) );
+			} else {
+				size_t utf16len = _utf32_to_utf16( uc, utf16buff );
+				mData.append( utf16buff, utf16len );
+			}
+		}
+		return *this;
 	}
 
 	UString& UString::append( const UString& str )
@@ -1977,6 +1987,8 @@ namespace MyGUI
 
 	void UString::_load_buffer_UTF8() const
 	{
+		MYGUI_USTRING_COUNT(toUTF8);
+
 		_getBufferStr();
 		std::string& buffer = ( *m_buffer.mStrBuffer );
 		buffer.reserve( length() );
@@ -1986,18 +1998,29 @@ namespace MyGUI
 		unicode_char c;
 		size_t len;
 
-		const_iterator i, ie = end();
-		for ( i = begin(); i != ie; i.moveNext() ) {
-			c = i.getCharacter();
+		dstring::const_iterator i = mData.begin(), ie = mData.end();
+		while ( i != ie ) {
+			// ASCII characters are copied as is, without UTF-32 step
+			if ( *i < 0x80 ) {
+				buffer.push_back( static_cast<char>( *i ) );
+				++i;
+				continue;
+			}
+			if ( _utf16_surrogate_lead( *i ) && ( i + 1 ) != ie ) {
+				i += _utf16_to_utf32( &( *i ), c );
+			} else {
+				c = *i;
+				++i;
+			}
 			len = _utf32_to_utf8( c, utf8buf );
-			size_t j = 0;
-			while ( j < len )
-				buffer.push_back( charbuf[j++] );
+			buffer.append( charbuf, len );
 		}
 	}
 
 	void UString::_load_buffer_WStr() const
 	{
+		MYGUI_USTRING_COUNT(toWStr);
+
 		_getBufferWStr();
 		std::wstring& buffer = ( *m_buffer.mWStrBuffer );
 		buffer.reserve( length() ); // may over reserve, but should be close enough
@@ -2018,6 +2041,8 @@ namespace MyGUI
 
 	void UString::_load_buffer_UTF32() const
 	{
+		MYGUI_USTRING_COUNT(toUTF32);
+
 		_getBufferUTF32Str();
 		utf32string& buffer = ( *m_buffer.mUTF32StrBuffer );
 		buffer.reserve( length() ); // may over reserve, but should be close enough
@@ -0,0 +1,316 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_VertexUtility.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define MYGUI_VERTEX_SSE2
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	define MYGUI_VERTEX_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace MyGUI
+{
+
+	namespace vertex_utility
+	{
+
+		namespace
+		{
+
+			UploadStatistics gUploadStatistics;
+
+			MYGUI_FORCEINLINE bool isSameVertex(const Vertex& _first, const Vertex& _second)
+			{
+				return memcmp(&_first, &_second, sizeof(Vertex)) == 0;
+			}
+
+			MYGUI_FORCEINLINE bool isInRange(float _value, float _min, float _max)
+			{
+				// NaN тоже не попадает
+				return _value >= _min && _value <= _max;
+			}
+
+			MYGUI_FORCEINLINE int16 toSignedNormalized(float _value)
+			{
+				return (int16)(_value >= 0.0f ? _value * 32767.0f + 0.5f : _value * 32767.0f - 0.5f);
+			}
+
+			MYGUI_FORCEINLINE uint16 toUnsignedNormalized(float _value)
+			{
+				return (uint16)(_value * 65535.0f + 0.5f);
+			}
+
+			MYGUI_FORCEINLINE uint32 floatBits(float _value)
+			{
+				uint32 result;
+				memcpy(&result, &_value, sizeof(result));
+				return result;
+			}
+
+#if defined(MYGUI_VERTEX_SSE2)
+
+			// вершина это 16 байт x, y, z, colour и 8 байт u, v
+			MYGUI_FORCEINLINE void storeVertex(Vertex& _vertex, __m128 _position, __m128 _uv)
+			{
+				_mm_storeu_ps(&_vertex.x, _position);
+				_mm_storel_pi(reinterpret_cast<__m64*>(&_vertex.u), _uv);
+			}
+
+			// _rect = (l, t, r, b), _zc = (?, ?, z, colour), _uv = (u1, v1, u2, v2)
+			MYGUI_FORCEINLINE void storeQuad(Vertex* _vertex, __m128 _rect, __m128 _zc, __m128 _uv)
+			{
+				__m128 positionLT = _mm_shuffle_ps(_rect, _zc, _MM_SHUFFLE(3, 2, 1, 0));
+				__m128 positionRT = _mm_shuffle_ps(_rect, _zc, _MM_SHUFFLE(3, 2, 1, 2));
+				__m128 positionLB = _mm_shuffle_ps(_rect, _zc, _MM_SHUFFLE(3, 2, 3, 0));
+				__m128 positionRB = _mm_shuffle_ps(_rect, _zc, _MM_SHUFFLE(3, 2, 3, 2));
+
+				__m128 uvLT = _uv;
+				__m128 uvRT = _mm_shuffle_ps(_uv, _uv, _MM_SHUFFLE(3, 2, 1, 2));
+				__m128 uvLB = _mm_shuffle_ps(_uv, _uv, _MM_SHUFFLE(3, 2, 3, 0));
+				__m128 uvRB = _mm_shuffle_ps(_uv, _uv, _MM_SHUFFLE(3, 2, 3, 2));
+
+				storeVertex(_vertex[VertexQuad::CornerLT], positionLT, uvLT);
+				storeVertex(_vertex[VertexQuad::CornerRT], positionRT, uvRT);
+				storeVertex(_vertex[VertexQuad::CornerLB], positionLB, uvLB);
+				storeVertex(_vertex[VertexQuad::CornerLB2], positionLB, uvLB);
+				storeVertex(_vertex[VertexQuad::CornerRT2], positionRT, uvRT);
+				storeVertex(_vertex[VertexQuad::CornerRB], positionRB, uvRB);
+			}
+
+			MYGUI_FORCEINLINE __m128 makeDepthColour(float _z, uint32 _colour)
+			{
+				return _mm_castsi128_ps(_mm_setr_epi32(0, 0, (int)floatBits(_z), (int)_colour));
+			}
+
+#elif defined(MYGUI_VERTEX_NEON)
+
+			MYGUI_FORCEINLINE void storeVertex(Vertex& _vertex, float32x2_t _xy, float32x2_t _zc, float32x2_t _uv)
+			{
+				vst1q_f32(&_vertex.x, vcombine_f32(_xy, _zc));
+				vst1_f32(&_vertex.u, _uv);
+			}
+
+			// _rect = (l, t, r, b), _zc = (z, colour), _uv = (u1, v1, u2, v2)
+			MYGUI_FORCEINLINE void storeQuad(Vertex* _vertex, float32x4_t _rect, float32x2_t _zc, float32x4_t _uv)
+			{
+				float32x2_t lt = vget_low_f32(_rect);
+				float32x2_t rb = vget_high_f32(_rect);
+				float32x2_t rt = vrev64_f32(vext_f32(lt, rb, 1));
+				float32x2_t lb = vrev64_f32(vext_f32(rb, lt, 1));
+
+				float32x2_t uvLT = vget_low_f32(_uv);
+				float32x2_t uvRB = vget_high_f32(_uv);
+				float32x2_t uvRT = vrev64_f32(vext_f32(uvLT, uvRB, 1));
+				float32x2_t uvLB = vrev64_f32(vext_f32(uvRB, uvLT, 1));
+
+				storeVertex(_vertex[VertexQuad::CornerLT], lt, _zc, uvLT);
+				storeVertex(_vertex[VertexQuad::CornerRT], rt, _zc, uvRT);
+				storeVertex(_vertex[VertexQuad::CornerLB], lb, _zc, uvLB);
+				storeVertex(_vertex[VertexQuad::CornerLB2], lb, _zc, uvLB);
+				storeVertex(_vertex[VertexQuad::CornerRT2], rt, _zc, uvRT);
+				storeVertex(_vertex[VertexQuad::CornerRB], rb, _zc, uvRB);
+			}
+
+			MYGUI_FORCEINLINE float32x2_t makeDepthColour(float _z, uint32 _colour)
+			{
+				return vreinterpret_f32_u32(vset_lane_u32(_colour, vdup_n_u32(floatBits(_z)), 1));
+			}
+
+#endif
+
+		} // namespace
+
+		void writeQuad(Vertex* _vertex, const FloatRect& _rect, float _z, const FloatRect& _uv, uint32 _colour)
+		{
+#if defined(MYGUI_VERTEX_SSE2)
+			storeQuad(_vertex, _mm_loadu_ps(&_rect.left), makeDepthColour(_z, _colour), _mm_loadu_ps(&_uv.left));
+#elif defined(MYGUI_VERTEX_NEON)
+			storeQuad(_vertex, vld1q_f32(&_rect.left), makeDepthColour(_z, _colour), vld1q_f32(&_uv.left));
+#else
+			reinterpret_cast<VertexQuad*>(_vertex)->set(_rect.left, _rect.top, _rect.right, _rect.bottom, _z, _uv.left, _uv.top, _uv.right, _uv.bottom, _colour);
+#endif
+		}
+
+		size_t packQuads(Vertex* _vertex, size_t _count)
+		{
+			gUploadStatistics.writtenCount += _count;
+
+			size_t quadCount = _count / VertexQuad::VertexCount;
+			bool quads = _count != 0 && _count % VertexQuad::VertexCount == 0;
+
+			// второй треугольник квада повторяет две вершины первого
+			for (size_t index = 0; quads && index < quadCount; ++index)
+			{
+				const Vertex* quad = _vertex + index * VertexQuad::VertexCount;
+				quads = isSameVertex(quad[VertexQuad::CornerLB2], quad[VertexQuad::CornerLB]) &&
+					isSameVertex(quad[VertexQuad::CornerRT2], quad[VertexQuad::CornerRT]);
+			}
+
+			if (!quads)
+			{
+				gUploadStatistics.uploadedCount += _count;
+				gUploadStatistics.plainBufferCount ++;
+				return _count;
+			}
+
+			// сжатый квад не длиннее исходного, поэтому пишем поверх, сначала прочитав вершины
+			for (size_t index = 0; index < quadCount; ++index)
+			{
+				const Vertex* source = _vertex + index * VertexQuad::VertexCount;
+				Vertex lt = source[VertexQuad::CornerLT];
+				Vertex rt = source[VertexQuad::CornerRT];
+				Vertex lb = source[VertexQuad::CornerLB];
+				Vertex rb = source[VertexQuad::CornerRB];
+
+				Vertex* destination = _vertex + index * PackedQuadVertexCount;
+				destination[0] = lt;
+				destination[1] = rt;
+				destination[2] = lb;
+				destination[3] = rb;
+			}
+
+			size_t result = quadCount * PackedQuadVertexCount;
+			gUploadStatistics.uploadedCount += result;
+			gUploadStatistics.packedBufferCount ++;
+			return result;
+		}
+
+		bool compactVertexes(const Vertex* _source, size_t _count, CompactVertex* _destination)
+		{
+			for (size_t index = 0; index < _count; ++index)
+			{
+				const Vertex& vertex = _source[index];
+				if (!isInRange(vertex.x, -1.0f, 1.0f) || !isInRange(vertex.y, -1.0f, 1.0f) || !isInRange(vertex.z, -1.0f, 1.0f) ||
+					!isInRange(vertex.u, 0.0f, 1.0f) || !isInRange(vertex.v, 0.0f, 1.0f))
+					return false;
+			}
+
+			for (size_t index = 0; index < _count; ++index)
+			{
+				const Vertex& vertex = _source[index];
+				CompactVertex& destination = _destination[index];
+				destination.x = toSignedNormalized(vertex.x);
+				destination.y = toSignedNormalized(vertex.y);
+				destination.colour = vertex.colour;
+				destination.u = toUnsignedNormalized(vertex.u);
+				destination.v = toUnsignedNormalized(vertex.v);
+			}
+
+			gUploadStatistics.compactCount += _count;
+			gUploadStatistics.compactBufferCount ++;
+			return true;
+		}
+
+		void writeQuadIndexes(uint32* _index, size_t _quadCount)
+		{
+			for (size_t index = 0; index < _quadCount; ++index)
+			{
+				uint32 first = (uint32)(index * PackedQuadVertexCount);
+				_index[0] = first;
+				_index[1] = first + 1;
+				_index[2] = first + 2;
+				_index[3] = first + 2;
+				_index[4] = first + 1;
+				_index[5] = first + 3;
+				_index += PackedQuadIndexCount;
+			}
+		}
+
+		const UploadStatistics& getUploadStatistics()
+		{
+			return gUploadStatistics;
+		}
+
+		void resetUploadStatistics()
+		{
+			gUploadStatistics = UploadStatistics();
+		}
+
+		const char* getInstructionSet()
+		{
+#if defined(MYGUI_VERTEX_SSE2)
+			return "SSE2";
+#elif defined(MYGUI_VERTEX_NEON)
+			return "NEON";
+#else
+			return "Scalar";
+#endif
+		}
+
+		QuadBatch::QuadBatch(Vertex* _vertex, const RenderTargetInfo& _info, float _left, float _top, float _z) :
+			mCount(0),
+			mVertex(_vertex),
+			mVertexCount(0),
+			mScaleX(_info.pixScaleX * 2.0f),
+			mScaleY(-_info.pixScaleY * 2.0f),
+			mOffsetX(((_info.pixScaleX * (_left - (float)_info.leftOffset) + _info.hOffset) * 2.0f) - 1.0f),
+			mOffsetY(-(((_info.pixScaleY * (_top - (float)_info.topOffset) + _info.vOffset) * 2.0f) - 1.0f)),
+			mZ(_z)
+		{
+		}
+
+		void QuadBatch::flush()
+		{
+			Vertex* vertex = mVertex + mVertexCount;
+
+#if defined(MYGUI_VERTEX_SSE2)
+			const __m128 scale = _mm_setr_ps(mScaleX, mScaleY, mScaleX, mScaleY);
+			const __m128 offset = _mm_setr_ps(mOffsetX, mOffsetY, mOffsetX, mOffsetY);
+			for (size_t index = 0; index < mCount; ++index)
+			{
+				const Quad& quad = mQuads[index];
+				__m128 rect = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&quad.rect.left), scale), offset);
+				storeQuad(vertex, rect, makeDepthColour(mZ, quad.colour), _mm_loadu_ps(&quad.uv.left));
+				vertex += VertexQuad::VertexCount;
+			}
+#elif defined(MYGUI_VERTEX_NEON)
+			const float scaleData[4] = { mScaleX, mScaleY, mScaleX, mScaleY };
+			const float offsetData[4] = { mOffsetX, mOffsetY, mOffsetX, mOffsetY };
+			const float32x4_t scale = vld1q_f32(scaleData);
+			const float32x4_t offset = vld1q_f32(offsetData);
+			for (size_t index = 0; index < mCount; ++index)
+			{
+				const Quad& quad = mQuads[index];
+				float32x4_t rect = vaddq_f32(vmulq_f32(vld1q_f32(&quad.rect.left), scale), offset);
+				storeQuad(vertex, rect, makeDepthColour(mZ, quad.colour), vld1q_f32(&quad.uv.left));
+				vertex += VertexQuad::VertexCount;
+			}
+#else
+			for (size_t index = 0; index < mCount; ++index)
+			{
+				const Quad& quad = mQuads[index];
+				reinterpret_cast<VertexQuad*>(vertex)->set(
+					quad.rect.left * mScaleX + mOffsetX,
+					quad.rect.top * mScaleY + mOffsetY,
+					quad.rect.right * mScaleX + mOffsetX,
+					quad.rect.bottom * mScaleY + mOffsetY,
+					mZ,
+					quad.uv.left,
+					quad.uv.top,
+					quad.uv.right,
+					quad.uv.bottom,
+					quad.colour);
+				vertex += VertexQuad::VertexCount;
+			}
+#endif
+
+			mVertexCount += mCount * VertexQuad::VertexCount;
+			mCount = 0;
+		}
+
+		size_t QuadBatch::getVertexCount() const
+		{
+			return mVertexCount;
+		}
+
+	} // namespace vertex_utility
+
+} // namespace MyGUI
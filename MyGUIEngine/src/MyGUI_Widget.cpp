@@ -15,6 +15,7 @@
 #include "MyGUI_WidgetDefines.h"
 #include "MyGUI_LayerItem.h"
 #include "MyGUI_LayerManager.h"
+#include "MyGUI_LayerNode.h"
 #include "MyGUI_RenderItem.h"
 #include "MyGUI_ISubWidget.h"
 #include "MyGUI_ISubWidgetText.h"
@@ -41,7 +42,10 @@ namespace MyGUI
 		mContainer(nullptr),
 		mAlign(Align::Default),
 		mVisible(true),
-		mDepth(0)
+		mDepth(0),
+		mDeferredUpdate(0),
+		mDeferredIndex(0),
+		mCulled(false)
 	{
 	}
 
@@ -59,6 +63,11 @@ namespace MyGUI
 		else
 			skinInfo = SkinManager::getInstance().getByName(_skinName);
 
+		_initialise(_style, _coord, skinInfo, templateInfo, _parent, _croppedParent, _name);
+	}
+
+	void Widget::_initialise(WidgetStyle _style, const IntCoord& _coord, ResourceSkin* _skinInfo, ResourceLayout* _templateInfo, Widget* _parent, ICroppedRectangle* _croppedParent, const std::string& _name)
+	{
 		mCoord = _coord;
 
 		mAlign = Align::Default;
@@ -93,7 +102,7 @@ namespace MyGUI
 		if (nullptr != mCroppedParent)
 			mAbsolutePosition += mCroppedParent->getAbsolutePosition();
 
-		const WidgetInfo* root = initialiseWidgetSkinBase(skinInfo, templateInfo);
+		const WidgetInfo* root = initialiseWidgetSkinBase(_skinInfo, _templateInfo);
 
 		// дочернее окно обыкновенное
 		if (mWidgetStyle == WidgetStyle::Child)
@@ -112,8 +121,8 @@ namespace MyGUI
 		// витр метод для наследников
 		initialiseOverride();
 
-		if (skinInfo != nullptr)
-			setSkinProperty(skinInfo);
+		if (_skinInfo != nullptr)
+			setSkinProperty(_skinInfo);
 
 		if (root != nullptr)
 		{
@@ -126,6 +135,12 @@ namespace MyGUI
 
 	void Widget::_shutdown()
 	{
+		if (mDeferredUpdate != 0)
+		{
+			WidgetManager::getInstance()._removeDeferredWidget(this, mDeferredIndex);
+			mDeferredUpdate = 0;
+		}
+
 		// витр метод для наследников
 		shutdownOverride();
 
@@ -161,6 +176,9 @@ namespace MyGUI
 		else
 			skinInfo = SkinManager::getInstance().getByName(_skinName);
 
+		// скин выравнивается при создании, отложенные изменения должны быть применены
+		size_t depth = WidgetManager::getInstance()._pauseUpdate();
+
 		shutdownOverride();
 
 		saveLayerItem();
@@ -182,6 +200,8 @@ namespace MyGUI
 				setProperty(iter->first, iter->second);
 			}
 		}
+
+		WidgetManager::getInstance()._resumeUpdate(depth);
 	}
 
 	const WidgetInfo* Widget::initialiseWidgetSkinBase(ResourceSkin* _skinInfo, ResourceLayout* _templateInfo)
@@ -285,25 +305,32 @@ namespace MyGUI
 	}
 
 	Widget* Widget::baseCreateWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name, bool _template)
+	{
+		ResolvedWidgetType type;
+		WidgetManager::getInstance().resolveWidgetType(_type, _skin, type);
+		return baseCreateWidget(_style, type, _coord, _align, _layer, _name, _template);
+	}
+
+	Widget* Widget::baseCreateWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name, bool _template)
 	{
 		Widget* widget = nullptr;
 
 		if (_template)
 		{
-			widget = WidgetManager::getInstance().createWidget(_style, _type, _skin, _coord, this, _style == WidgetStyle::Popup ? nullptr : this, _name);
+			widget = WidgetManager::getInstance().createWidget(_style, _type, _coord, this, _style == WidgetStyle::Popup ? nullptr : this, _name);
 			mWidgetChildSkin.push_back(widget);
 		}
 		else
 		{
 			if (mWidgetClient != nullptr)
 			{
-				widget = mWidgetClient->baseCreateWidget(_style, _type, _skin, _coord, _align, _layer, _name, _template);
+				widget = mWidgetClient->baseCreateWidget(_style, _type, _coord, _align, _layer, _name, _template);
 				onWidgetCreated(widget);
 				return widget;
 			}
 			else
 			{
-				widget = WidgetManager::getInstance().createWidget(_style, _type, _skin, _coord, this, _style == WidgetStyle::Popup ? nullptr : this, _name);
+				widget = WidgetManager::getInstance().createWidget(_style, _type, _coord, this, _style == WidgetStyle::Popup ? nullptr : this, _name);
 				addWidget(widget);
 			}
 		}
@@ -337,6 +364,11 @@ namespace MyGUI
 				// запоминаем текущее состояние
 				mIsMargin = margin;
 
+				// иерархия уже скрыта, дети за нашей границей тоже снаружи
+				if (mCulled)
+					return;
+				mCulled = true;
+
 				// скрываем
 				_setSubSkinVisible(false);
 
@@ -358,6 +390,7 @@ namespace MyGUI
 
 		// запоминаем текущее состояние
 		mIsMargin = margin;
+		mCulled = false;
 
 		// если скин был скрыт, то покажем
 		_setSubSkinVisible(true);
@@ -407,6 +440,16 @@ namespace MyGUI
 	}
 
 	// удаляет всех детей
+	size_t Widget::_getMemoryUsage() const
+	{
+		size_t result = getTypeSize();
+		result += (mWidgetChild.capacity() + mWidgetChildSkin.capacity()) * sizeof(Widget*);
+		result += utility::getHeapSize(mName);
+		result += _getUserDataMemoryUsage();
+		result += _getSkinItemMemoryUsage();
+		return result;
+	}
+
 	void Widget::_destroyAllChildWidget()
 	{
 		WidgetManager& manager = WidgetManager::getInstance();
@@ -438,6 +481,9 @@ namespace MyGUI
 			return;
 		mAlpha = _alpha;
 
+		if (deferUpdate(DeferredAlpha))
+			return;
+
 		_updateAlpha();
 	}
 
@@ -510,7 +556,42 @@ namespace MyGUI
 		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
 			(*widget)->_updateAbsolutePoint();
 
-		_correctSkinItemView();
+		// скрытые сабскины пересчитаются в _updateView при возвращении во вьюпорт
+		if (!mCulled)
+			_correctSkinItemView();
+	}
+
+	void Widget::_shiftAbsolutePoint()
+	{
+		mAbsolutePosition = mCroppedParent->getAbsolutePosition() + mCoord.point();
+
+		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
+		{
+			// дети в своих нодах не зависят от нашей позиции
+			if ((*widget)->mCroppedParent != nullptr)
+				(*widget)->_shiftAbsolutePoint();
+		}
+		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
+		{
+			if ((*widget)->mCroppedParent != nullptr)
+				(*widget)->_shiftAbsolutePoint();
+		}
+	}
+
+	LayerNode* Widget::_getOriginLayerNode() const
+	{
+		if (mCroppedParent != nullptr)
+			return nullptr;
+
+		ILayerNode* node = getLayerNode();
+		if (node == nullptr)
+			return nullptr;
+
+		LayerNode* layerNode = node->castType<LayerNode>(false);
+		if (layerNode == nullptr || !layerNode->isOriginItem(this))
+			return nullptr;
+
+		return layerNode;
 	}
 
 	void Widget::_forcePick(Widget* _widget)
@@ -572,6 +653,18 @@ namespace MyGUI
 	{
 		const IntSize& size = _newSize;//getParentSize();
 
+		// координаты, заданные внутри отложенного обновления, сдвигаются
+		// только на изменение размера отца после их установки
+		IntSize oldsize = _oldsize;
+		if ((mDeferredUpdate & DeferredParentSize) != 0)
+		{
+			oldsize = mDeferredParentSize;
+			mDeferredParentSize = _newSize;
+			// отец не менялся после установки, центрирование тоже не нужно
+			if (oldsize == _newSize)
+				return;
+		}
+
 		bool need_move = false;
 		bool need_size = false;
 		IntCoord coord = mCoord;
@@ -580,13 +673,13 @@ namespace MyGUI
 		if (mAlign.isHStretch())
 		{
 			// растягиваем
-			coord.width = mCoord.width + (size.width - _oldsize.width);
+			coord.width = mCoord.width + (size.width - oldsize.width);
 			need_size = true;
 		}
 		else if (mAlign.isRight())
 		{
 			// двигаем по правому краю
-			coord.left = mCoord.left + (size.width - _oldsize.width);
+			coord.left = mCoord.left + (size.width - oldsize.width);
 			need_move = true;
 		}
 		else if (mAlign.isHCenter())
@@ -599,13 +692,13 @@ namespace MyGUI
 		if (mAlign.isVStretch())
 		{
 			// растягиваем
-			coord.height = mCoord.height + (size.height - _oldsize.height);
+			coord.height = mCoord.height + (size.height - oldsize.height);
 			need_size = true;
 		}
 		else if (mAlign.isBottom())
 		{
 			// двигаем по нижнему краю
-			coord.top = mCoord.top + (size.height - _oldsize.height);
+			coord.top = mCoord.top + (size.height - oldsize.height);
 			need_move = true;
 		}
 		else if (mAlign.isVCenter())
@@ -634,8 +727,47 @@ namespace MyGUI
 
 	void Widget::setPosition(const IntPoint& _point)
 	{
+		if (deferUpdate(DeferredCoord))
+		{
+			mAbsolutePosition += _point - mCoord.point();
+			mCoord = _point;
+			return;
+		}
+
+		// размер тоже ожидает обновления, пересчитываем все сразу,
+		// виртуально, чтобы наследники обновили свое представление
+		if ((mDeferredUpdate & DeferredCoord) != 0)
+		{
+			setCoord(IntCoord(_point, mCoord.size()));
+			return;
+		}
+
 		// обновляем абсолютные координаты
-		mAbsolutePosition += _point - mCoord.point();
+		IntPoint offset = _point - mCoord.point();
+		mAbsolutePosition += offset;
+
+		// весь нод сдвигается целиком, вершины пересчитает или сдвинет рендер айтем
+		LayerNode* node = _getOriginLayerNode();
+		if (node != nullptr)
+		{
+			mCoord = _point;
+
+			for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
+			{
+				if ((*widget)->mCroppedParent != nullptr)
+					(*widget)->_shiftAbsolutePoint();
+			}
+			for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
+			{
+				if ((*widget)->mCroppedParent != nullptr)
+					(*widget)->_shiftAbsolutePoint();
+			}
+
+			node->_notifyOriginChanged(offset);
+
+			eventChangeCoord(this);
+			return;
+		}
 
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
 			(*widget)->_updateAbsolutePoint();
@@ -651,8 +783,14 @@ namespace MyGUI
 
 	void Widget::setSize(const IntSize& _size)
 	{
+		if (deferUpdate(DeferredCoord))
+		{
+			mCoord = _size;
+			return;
+		}
+
 		// устанавливаем новую координату а старую пускаем в расчеты
-		IntSize old = mCoord.size();
+		IntSize old = takeDeferredCoord().size();
 		mCoord = _size;
 
 		bool visible = true;
@@ -671,6 +809,7 @@ namespace MyGUI
 		}
 
 		_setSubSkinVisible(visible);
+		mCulled = !visible;
 
 		// передаем старую координату , до вызова, текущая координата отца должна быть новой
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
@@ -691,13 +830,19 @@ namespace MyGUI
 		// обновляем абсолютные координаты
 		mAbsolutePosition += _coord.point() - mCoord.point();
 
+		if (deferUpdate(DeferredCoord))
+		{
+			mCoord = _coord;
+			return;
+		}
+
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
 			(*widget)->_updateAbsolutePoint();
 		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
 			(*widget)->_updateAbsolutePoint();
 
 		// устанавливаем новую координату а старую пускаем в расчеты
-		IntCoord old = mCoord;
+		IntCoord old = takeDeferredCoord();
 		mCoord = _coord;
 
 		bool visible = true;
@@ -716,6 +861,7 @@ namespace MyGUI
 		}
 
 		_setSubSkinVisible(visible);
+		mCulled = !visible;
 
 		// передаем старую координату , до вызова, текущая координата отца должна быть новой
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
@@ -968,6 +1114,9 @@ namespace MyGUI
 			return;
 		mVisible = _value;
 
+		if (deferUpdate(DeferredVisible))
+			return;
+
 		_updateVisible();
 	}
 
@@ -1141,6 +1290,16 @@ namespace MyGUI
 		return baseCreateWidget(_style, _type, _skin, _coord, _align, _layer, _name, true);
 	}
 
+	Widget* Widget::_createWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name)
+	{
+		return baseCreateWidget(_style, _type, _coord, _align, _layer, _name, false);
+	}
+
+	void Widget::_setPropertyChecked(const std::string& _key, const std::string& _value)
+	{
+		setPropertyOverride(_key, _value);
+	}
+
 	void Widget::setPropertyOverride(const std::string& _key, const std::string& _value)
 	{
 		/// @wproperty{Widget, Position, IntPoint} Set widget position.
@@ -1322,6 +1481,11 @@ namespace MyGUI
 		return mCoord;
 	}
 
+	IntPoint Widget::getLayerItemOrigin() const
+	{
+		return mAbsolutePosition;
+	}
+
 	float Widget::_getRealAlpha() const
 	{
 		return mRealAlpha;
@@ -1403,4 +1567,67 @@ namespace MyGUI
 		}
 	}
 
+	bool Widget::deferUpdate(unsigned char _flag)
+	{
+		WidgetManager& manager = WidgetManager::getInstance();
+		if (!manager.isUpdating())
+			return false;
+
+		if (mDeferredUpdate == 0)
+			mDeferredIndex = manager._addDeferredWidget(this);
+
+		// для выравнивания детей нужен размер до первого изменения
+		if ((_flag & DeferredCoord) != 0 && (mDeferredUpdate & DeferredCoord) == 0)
+			mDeferredCoord = mCoord;
+
+		if ((_flag & DeferredCoord) != 0 && mParent != nullptr)
+		{
+			mDeferredParentSize = mParent->getSize();
+			_flag |= DeferredParentSize;
+		}
+
+		mDeferredUpdate |= _flag;
+		return true;
+	}
+
+	IntCoord Widget::takeDeferredCoord()
+	{
+		if ((mDeferredUpdate & DeferredCoord) == 0)
+			return mCoord;
+
+		mDeferredUpdate &= ~DeferredCoord;
+		return mDeferredCoord;
+	}
+
+	bool Widget::_isCulled() const
+	{
+		return mCulled;
+	}
+
+	void Widget::_commitDeferredUpdate()
+	{
+		// координаты могли быть уже применены при выравнивании отцом,
+		// виртуальный вызов, пока шло отложенное обновление наследники
+		// (ScrollView, ScrollBar) считали свое представление по старым размерам
+		if ((mDeferredUpdate & DeferredCoord) != 0)
+		{
+			IntCoord coord = mCoord;
+			setCoord(coord);
+		}
+
+		if ((mDeferredUpdate & DeferredAlpha) != 0)
+			_updateAlpha();
+
+		if ((mDeferredUpdate & DeferredVisible) != 0)
+			_updateVisible();
+
+		// отец может примениться позже и должен знать о явных координатах
+		mDeferredUpdate &= DeferredParentSize;
+	}
+
+	void Widget::_resetDeferredUpdate()
+	{
+		mDeferredUpdate = 0;
+	}
+
 } // namespace MyGUI
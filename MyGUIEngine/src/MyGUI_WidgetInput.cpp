@@ -149,6 +149,11 @@ namespace MyGUI
 	}
 
 	const std::string& WidgetInput::getPointer() const
+	{
+		return mPointer.toString();
+	}
+
+	StringId WidgetInput::_getPointerId() const
 	{
 		return mPointer;
 	}
@@ -9,6 +9,9 @@
 #include "MyGUI_Gui.h"
 #include "MyGUI_Widget.h"
 #include "MyGUI_FactoryManager.h"
+#include "MyGUI_LayoutManager.h"
+#include "MyGUI_SkinManager.h"
+#include "MyGUI_ILayer.h"
 
 #include "MyGUI_Button.h"
 #include "MyGUI_Canvas.h"
@@ -30,6 +33,8 @@
 #include "MyGUI_TextBox.h"
 #include "MyGUI_TabControl.h"
 #include "MyGUI_TabItem.h"
+#include "MyGUI_TreeControl.h"
+#include "MyGUI_TreeControlItem.h"
 #include "MyGUI_Widget.h"
 #include "MyGUI_Window.h"
 
@@ -43,7 +48,8 @@ namespace MyGUI
 
 	WidgetManager::WidgetManager() :
 		mIsInitialise(false),
-		mCategoryName("Widget")
+		mCategoryName("Widget"),
+		mUpdateDepth(0)
 	{
 	}
 
@@ -74,6 +80,8 @@ namespace MyGUI
 		factory.registerFactory<TextBox>(mCategoryName);
 		factory.registerFactory<TabControl>(mCategoryName);
 		factory.registerFactory<TabItem>(mCategoryName);
+		factory.registerFactory<TreeControl>(mCategoryName);
+		factory.registerFactory<TreeControlItem>(mCategoryName);
 		factory.registerFactory<Widget>(mCategoryName);
 		factory.registerFactory<Window>(mCategoryName);
 
@@ -93,6 +101,8 @@ namespace MyGUI
 		Gui::getInstance().eventFrameStart -= newDelegate(this, &WidgetManager::notifyEventFrameStart);
 		_deleteDelayWidgets();
 
+		MYGUI_ASSERT(mUpdateDepth == 0, "beginUpdate without endUpdate");
+
 		mVectorIUnlinkWidget.clear();
 
 		FactoryManager::getInstance().unregisterFactory(mCategoryName);
@@ -103,16 +113,47 @@ namespace MyGUI
 
 	Widget* WidgetManager::createWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Widget* _parent, ICroppedRectangle* _cropeedParent, const std::string& _name)
 	{
-		IObject* object = FactoryManager::getInstance().createObject(mCategoryName, _type);
+		ResolvedWidgetType type;
+		resolveWidgetType(_type, _skin, type);
+		return createWidget(_style, type, _coord, _parent, _cropeedParent, _name);
+	}
+
+	Widget* WidgetManager::createWidget(WidgetStyle _style, const ResolvedWidgetType& _type, const IntCoord& _coord, Widget* _parent, ICroppedRectangle* _cropeedParent, const std::string& _name)
+	{
+		MYGUI_ASSERT(_type.factory != nullptr, "factory '" << _type.type << "' not resolved");
+
+		IObject* object = nullptr;
+		(*_type.factory)(object);
 		if (object != nullptr)
 		{
+			// скин выравнивается при создании, отложенные изменения должны быть применены
+			size_t depth = _pauseUpdate();
+
 			Widget* widget = object->castType<Widget>();
-			widget->_initialise(_style, _coord, _skin, _parent, _cropeedParent, _name);
+			widget->_initialise(_style, _coord, _type.skin, _type.templateLayout, _parent, _cropeedParent, _name);
+
+			_resumeUpdate(depth);
 
 			return widget;
 		}
 
-		MYGUI_EXCEPT("factory '" << _type << "' not found");
+		MYGUI_EXCEPT("factory '" << _type.type << "' not found");
+	}
+
+	void WidgetManager::resolveWidgetType(const std::string& _type, const std::string& _skin, ResolvedWidgetType& _result)
+	{
+		_result.type = _type;
+		_result.factory = FactoryManager::getInstance().getFactory(mCategoryName, _type);
+		if (_result.factory == nullptr)
+			MYGUI_EXCEPT("factory '" << _type << "' not found");
+
+		_result.skin = nullptr;
+		_result.templateLayout = nullptr;
+
+		if (LayoutManager::getInstance().isExist(_skin))
+			_result.templateLayout = LayoutManager::getInstance().getByName(_skin);
+		else
+			_result.skin = SkinManager::getInstance().getByName(_skin);
 	}
 
 	void WidgetManager::destroyWidget(Widget* _widget)
@@ -170,12 +211,15 @@ namespace MyGUI
 	{
 		_widget->_shutdown();
 
+// проверяем только в дебаге, при удалении большого дерева проверка квадратичная
+#if MYGUI_DEBUG_MODE == 1
 		for (VectorWidgetPtr::iterator entry = mDestroyWidgets.begin(); entry != mDestroyWidgets.end(); ++entry)
 		{
 			/*if ((*entry) == _widget)
 				return;*/
 			MYGUI_ASSERT((*entry) != _widget, "double delete widget");
 		}
+#endif
 
 		mDestroyWidgets.push_back(_widget);
 	}
@@ -195,4 +239,114 @@ namespace MyGUI
 		return mCategoryName;
 	}
 
+	void WidgetManager::beginUpdate()
+	{
+		mUpdateDepth ++;
+	}
+
+	void WidgetManager::endUpdate()
+	{
+		MYGUI_ASSERT(mUpdateDepth != 0, "endUpdate without beginUpdate");
+
+		mUpdateDepth --;
+		if (mUpdateDepth == 0)
+			commitDeferredWidgets();
+	}
+
+	bool WidgetManager::isUpdating() const
+	{
+		return mUpdateDepth != 0;
+	}
+
+	size_t WidgetManager::_addDeferredWidget(Widget* _widget)
+	{
+		mDeferredWidgets.push_back(_widget);
+		return mDeferredWidgets.size() - 1;
+	}
+
+	void WidgetManager::_removeDeferredWidget(Widget* _widget, size_t _index)
+	{
+		// не удаляем из списка, так как он может перебираться прямо сейчас
+		if (_index < mDeferredWidgets.size() && mDeferredWidgets[_index] == _widget)
+			mDeferredWidgets[_index] = nullptr;
+	}
+
+	size_t WidgetManager::_pauseUpdate()
+	{
+		size_t depth = mUpdateDepth;
+		if (depth != 0)
+		{
+			mUpdateDepth = 0;
+			commitDeferredWidgets();
+		}
+		return depth;
+	}
+
+	void WidgetManager::_resumeUpdate(size_t _depth)
+	{
+		mUpdateDepth = _depth;
+	}
+
+	void WidgetManager::commitDeferredWidgets()
+	{
+		// во время применения могут удаляться виджеты, поэтому по индексу
+		for (size_t index = 0; index < mDeferredWidgets.size(); ++index)
+		{
+			Widget* widget = mDeferredWidgets[index];
+			if (widget != nullptr)
+				widget->_commitDeferredUpdate();
+		}
+		for (size_t index = 0; index < mDeferredWidgets.size(); ++index)
+		{
+			Widget* widget = mDeferredWidgets[index];
+			if (widget != nullptr)
+				widget->_resetDeferredUpdate();
+		}
+		mDeferredWidgets.clear();
+	}
+
+	void WidgetManager::getMemoryReport(MemoryReport& _report) const
+	{
+		_report = MemoryReport();
+
+		EnumeratorWidgetPtr widgets = Gui::getInstance().getEnumerator();
+		while (widgets.next())
+			addMemoryReport(widgets.current(), "", _report);
+	}
+
+	void WidgetManager::addMemoryReport(Widget* _widget, const std::string& _layer, MemoryReport& _report) const
+	{
+		// дочерние виджеты в слое отца, если не приаттачены к своему
+		const std::string& layer = _widget->getLayer() != nullptr ? _widget->getLayer()->getName() : _layer;
+		size_t bytes = _widget->_getMemoryUsage();
+
+		MemoryReport::Item& type = _report.types[_widget->getTypeName()];
+		type.count ++;
+		type.bytes += bytes;
+
+		MemoryReport::Item& total = _report.layers[layer];
+		total.count ++;
+		total.bytes += bytes;
+
+		_report.total.count ++;
+		_report.total.bytes += bytes;
+
+		for (VectorWidgetPtr::const_iterator child = _widget->mWidgetChildSkin.begin(); child != _widget->mWidgetChildSkin.end(); ++child)
+			addMemoryReport(*child, layer, _report);
+		for (VectorWidgetPtr::const_iterator child = _widget->mWidgetChild.begin(); child != _widget->mWidgetChild.end(); ++child)
+			addMemoryReport(*child, layer, _report);
+	}
+
+	void WidgetManager::logMemoryReport() const
+	{
+		MemoryReport report;
+		getMemoryReport(report);
+
+		MYGUI_LOG(Info, "Widgets memory: " << report.total.count << " widgets, " << report.total.bytes << " bytes");
+		for (MemoryReport::MapItem::const_iterator item = report.types.begin(); item != report.types.end(); ++item)
+			MYGUI_LOG(Info, "  type '" << item->first << "' : " << item->second.count << " widgets, " << item->second.bytes << " bytes");
+		for (MemoryReport::MapItem::const_iterator item = report.layers.begin(); item != report.layers.end(); ++item)
+			MYGUI_LOG(Info, "  layer '" << item->first << "' : " << item->second.count << " widgets, " << item->second.bytes << " bytes");
+	}
+
 } // namespace MyGUI
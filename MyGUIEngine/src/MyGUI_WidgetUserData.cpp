@@ -7,43 +7,115 @@
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_WidgetUserData.h"
 #include "MyGUI_Constants.h"
+#include "MyGUI_StringUtility.h"
 
 namespace MyGUI
 {
 
-	UserData::UserData()
+	UserData::UserData() :
+		mStorage(nullptr)
 	{
 	}
 
+	UserData::UserData(const UserData& _other) :
+		mStorage(nullptr),
+		mInternalData(_other.mInternalData)
+	{
+		if (_other.mStorage != nullptr)
+		{
+			mStorage = new Storage();
+			mStorage->userStrings = _other.mStorage->userStrings;
+			mStorage->userData = _other.mStorage->userData;
+		}
+	}
+
 	UserData::~UserData()
 	{
+		deleteStorage();
+	}
+
+	UserData& UserData::operator = (const UserData& _other)
+	{
+		if (this != &_other)
+		{
+			deleteStorage();
+			if (_other.mStorage != nullptr)
+			{
+				mStorage = new Storage();
+				mStorage->userStrings = _other.mStorage->userStrings;
+				mStorage->userData = _other.mStorage->userData;
+			}
+			mInternalData = _other.mInternalData;
+		}
+		return *this;
 	}
 
 	void UserData::setUserString(const std::string& _key, const std::string& _value)
 	{
-		mMapUserString[_key] = _value;
+		setUserString(StringId(_key), _value);
+	}
+
+	void UserData::setUserString(StringId _key, const std::string& _value)
+	{
+		Storage& storage = getStorage();
+		resetUserStringsMap();
+
+		VectorUserString::iterator iter = findUserString(_key);
+		if (iter != storage.userStrings.end() && iter->first == _key)
+			iter->second = _value;
+		else
+			storage.userStrings.insert(iter, PairUserString(_key, _value));
 	}
 
 	/** Get user string or "" if not found */
 	const std::string& UserData::getUserString(const std::string& _key) const
 	{
-		MapString::const_iterator iter = mMapUserString.find(_key);
-		if (iter != mMapUserString.end())
+		// ключа нет в таблице, значит его нет ни у одного виджета
+		StringId key;
+		if (!StringId::find(_key, key))
+			return Constants::getEmptyString();
+		return getUserString(key);
+	}
+
+	const std::string& UserData::getUserString(StringId _key) const
+	{
+		if (mStorage == nullptr)
+			return Constants::getEmptyString();
+
+		VectorUserString::const_iterator iter = findUserString(_key);
+		if (iter != mStorage->userStrings.end() && iter->first == _key)
 			return iter->second;
 		return Constants::getEmptyString();
 	}
 
 	const MapString& UserData::getUserStrings() const
 	{
-		return mMapUserString;
+		if (mStorage == nullptr)
+		{
+			static MapString empty;
+			return empty;
+		}
+
+		if (mStorage->userStringsMap == nullptr)
+		{
+			mStorage->userStringsMap = new MapString();
+			for (VectorUserString::const_iterator iter = mStorage->userStrings.begin(); iter != mStorage->userStrings.end(); ++iter)
+				(*mStorage->userStringsMap)[iter->first.toString()] = iter->second;
+		}
+		return *mStorage->userStringsMap;
 	}
 
 	bool UserData::clearUserString(const std::string& _key)
 	{
-		MapString::iterator iter = mMapUserString.find(_key);
-		if (iter != mMapUserString.end())
+		StringId key;
+		if (mStorage == nullptr || !StringId::find(_key, key))
+			return false;
+
+		VectorUserString::iterator iter = findUserString(key);
+		if (iter != mStorage->userStrings.end() && iter->first == key)
 		{
-			mMapUserString.erase(iter);
+			resetUserStringsMap();
+			mStorage->userStrings.erase(iter);
 			return true;
 		}
 		return false;
@@ -51,17 +123,93 @@ namespace MyGUI
 
 	bool UserData::isUserString(const std::string& _key) const
 	{
-		return mMapUserString.find(_key) != mMapUserString.end();
+		StringId key;
+		if (mStorage == nullptr || !StringId::find(_key, key))
+			return false;
+
+		VectorUserString::const_iterator iter = findUserString(key);
+		return iter != mStorage->userStrings.end() && iter->first == key;
 	}
 
 	void UserData::clearUserStrings()
 	{
-		mMapUserString.clear();
+		if (mStorage == nullptr)
+			return;
+
+		resetUserStringsMap();
+		mStorage->userStrings.clear();
+	}
+
+	UserData::Storage& UserData::getStorage()
+	{
+		if (mStorage == nullptr)
+			mStorage = new Storage();
+		return *mStorage;
+	}
+
+	UserData::VectorUserString::iterator UserData::findUserString(StringId _key)
+	{
+		// строк у виджета обычно мало, линейный поиск быстрее двоичного
+		VectorUserString::iterator iter = mStorage->userStrings.begin();
+		while (iter != mStorage->userStrings.end() && iter->first < _key)
+			++iter;
+		return iter;
+	}
+
+	UserData::VectorUserString::const_iterator UserData::findUserString(StringId _key) const
+	{
+		VectorUserString::const_iterator iter = mStorage->userStrings.begin();
+		while (iter != mStorage->userStrings.end() && iter->first < _key)
+			++iter;
+		return iter;
+	}
+
+	void UserData::resetUserStringsMap() const
+	{
+		delete mStorage->userStringsMap;
+		mStorage->userStringsMap = nullptr;
+	}
+
+	void UserData::deleteStorage()
+	{
+		if (mStorage == nullptr)
+			return;
+
+		resetUserStringsMap();
+		delete mStorage;
+		mStorage = nullptr;
 	}
 
 	void UserData::setUserData(Any _data)
 	{
-		mUserData = _data;
+		// пустые данные не требуют хранилища
+		if (mStorage == nullptr && _data.empty())
+			return;
+		getStorage().userData = _data;
+	}
+
+	const Any& UserData::_getUserDataAny() const
+	{
+		if (mStorage == nullptr)
+		{
+			static Any empty;
+			return empty;
+		}
+		return mStorage->userData;
+	}
+
+	size_t UserData::_getUserDataMemoryUsage() const
+	{
+		if (mStorage == nullptr)
+			return 0;
+
+		size_t result = sizeof(Storage) + mStorage->userStrings.capacity() * sizeof(PairUserString);
+		for (VectorUserString::const_iterator iter = mStorage->userStrings.begin(); iter != mStorage->userStrings.end(); ++iter)
+			result += utility::getHeapSize(iter->second);
+		// узел map это значение и три указателя с цветом
+		if (mStorage->userStringsMap != nullptr)
+			result += mStorage->userStringsMap->size() * (sizeof(MapString::value_type) + 4 * sizeof(void*));
+		return result;
 	}
 
 	void UserData::_setInternalData(Any _data)
@@ -341,6 +341,14 @@ namespace MyGUI
 			Base::setCaption(_caption);
 	}
 
+	void Window::setCaptionUTF8(const std::string& _value)
+	{
+		if (mWidgetCaption != nullptr)
+			mWidgetCaption->setCaptionUTF8(_value);
+		else
+			Base::setCaptionUTF8(_value);
+	}
+
 	const UString& Window::getCaption()
 	{
 		if (mWidgetCaption != nullptr)
@@ -34,6 +34,7 @@ namespace MyGUI
 		virtual void* lock(TextureUsage _access);
 		virtual void unlock();
 		virtual bool isLocked();
+		virtual void* lockRegion(const IntRect& _rect);
 
 		virtual int getWidth();
 		virtual int getHeight();
@@ -198,6 +198,23 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	void* DirectXTexture::lockRegion(const IntRect& _rect)
+	{
+		// без D3DLOCK_DISCARD содержимое вне области сохраняется
+		RECT rect = { _rect.left, _rect.top, _rect.right, _rect.bottom };
+		D3DLOCKED_RECT d3dlr;
+
+		HRESULT result = mpTexture->LockRect(0, &d3dlr, &rect, 0);
+		if (FAILED(result))
+		{
+			MYGUI_PLATFORM_EXCEPT("Failed to lock texture (error code " << result << ").");
+		}
+
+		mLock = true;
+		// указатель на начало текстуры, как при блокировке всей текстуры
+		return static_cast<uint8*>(d3dlr.pBits) - _rect.top * d3dlr.Pitch - _rect.left * mNumElemBytes;
+	}
+
 	bool DirectXTexture::isLocked()
 	{
 		return mLock;
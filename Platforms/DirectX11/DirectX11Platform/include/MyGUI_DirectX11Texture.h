@@ -36,6 +36,7 @@ namespace MyGUI
 		virtual void* lock(TextureUsage _access);
 		virtual void unlock();
 		virtual bool isLocked();
+		virtual void* lockRegion(const IntRect& _rect);
 
 		virtual int getWidth();
 		virtual int getHeight();
@@ -50,6 +51,7 @@ namespace MyGUI
 		friend class DirectX11RTTexture;
 		ID3D11Texture2D*          mTexture;
 		void*                     mWriteData;
+		IntRect                   mWriteRect;
 
 	public:
 		ID3D11ShaderResourceView* mResourceView;
@@ -158,12 +158,31 @@ namespace MyGUI
 
 		if ( mWriteData )
 		{
-			mManager->mpD3DContext->UpdateSubresource(mTexture, D3D11CalcSubresource(0, 0, 0), 0, mWriteData, mWidth * 4, 0);
+			if ( mWriteRect.empty() )
+			{
+				mManager->mpD3DContext->UpdateSubresource(mTexture, D3D11CalcSubresource(0, 0, 0), 0, mWriteData, mWidth * 4, 0);
+			}
+			else
+			{
+				// строки области идут в буфере с шагом ширины текстуры
+				D3D11_BOX box = { (UINT)mWriteRect.left, (UINT)mWriteRect.top, 0, (UINT)mWriteRect.right, (UINT)mWriteRect.bottom, 1 };
+				const char* data = static_cast<const char*>(mWriteData) + (mWriteRect.top * mWidth + mWriteRect.left) * 4;
+				mManager->mpD3DContext->UpdateSubresource(mTexture, D3D11CalcSubresource(0, 0, 0), &box, data, mWidth * 4, 0);
+				mWriteRect.clear();
+			}
 			free(mWriteData);
 			mWriteData = 0;
 		}
 	}
 
+	void* DirectX11Texture::lockRegion(const IntRect& _rect)
+	{
+		void* data = lock(TextureUsage::Write);
+		if ( data )
+			mWriteRect = _rect;
+		return data;
+	}
+
 	bool DirectX11Texture::isLocked()
 	{
 		return mLock;
@@ -123,6 +123,20 @@ namespace MyGUI
 		}
 	}
 
+	void* OgreTexture::lockRegion(const IntRect& _rect)
+	{
+		// без HBL_DISCARD содержимое вне области сохраняется
+		const Ogre::PixelBox& box = mTexture->getBuffer()->lock(
+			Ogre::Image::Box(_rect.left, _rect.top, _rect.right, _rect.bottom),
+			Ogre::HardwareBuffer::HBL_NORMAL);
+
+		// в зависимости от рендер системы data указывает на начало области (left и top бокса равны нулю)
+		// или на начало всей текстуры, возвращаем указатель на начало текстуры, как при блокировке всей текстуры
+		int left = (int)box.left - _rect.left;
+		int top = (int)box.top - _rect.top;
+		return static_cast<uint8*>(box.data) + (top * (int)box.rowPitch + left) * (int)Ogre::PixelUtil::getNumElemBytes(box.format);
+	}
+
 	bool OgreTexture::isLocked()
 	{
 		return mTexture->getBuffer()->isLocked();
@@ -60,6 +60,13 @@ namespace MyGUI
 		/** @see IRenderTarget::getInfo */
 		virtual const RenderTargetInfo& getInfo();
 
+		/** Send quads as four vertexes and draw them with shared index buffer, enabled by default.
+			Buffers with other triangles are always sent as is.
+		*/
+		void setIndexedQuads(bool _value);
+		/** Are quads sent as four vertexes */
+		bool getIndexedQuads() const;
+
 
 	/*internal:*/
 		void drawOneFrame();
@@ -68,6 +75,7 @@ namespace MyGUI
 
 	private:
 		void destroyAllResources();
+		void bindQuadIndexBuffer(size_t _indexCount);
 
 	private:
 		IntSize mViewSize;
@@ -80,6 +88,10 @@ namespace MyGUI
 		OpenGLImageLoader* mImageLoader;
 		bool mPboIsSupported;
 
+		bool mIndexedQuads;
+		unsigned int mQuadIndexBufferID;
+		size_t mQuadIndexCount;
+
 		bool mIsInitialise;
 	};
 
@@ -37,6 +37,7 @@ namespace MyGUI
 		virtual void* lock(TextureUsage _access);
 		virtual void unlock();
 		virtual bool isLocked();
+		virtual void* lockRegion(const IntRect& _rect);
 
 		virtual PixelFormat getFormat();
 		virtual TextureUsage getUsage();
@@ -51,6 +52,7 @@ namespace MyGUI
 
 	private:
 		void _create();
+		void uploadLockedData(const void* _data);
 
 	private:
 		std::string mName;
@@ -66,6 +68,7 @@ namespace MyGUI
 		unsigned int mPboID;
 		bool mLock;
 		void* mBuffer;
+		IntRect mLockRect;
 		PixelFormat mOriginalFormat;
 		TextureUsage mOriginalUsage;
 		OpenGLImageLoader* mImageLoader;
@@ -26,6 +26,8 @@ namespace MyGUI
 		virtual Vertex* lock();
 		virtual void unlock();
 
+		virtual void setWrittenVertexCount(size_t _value);
+
 	/*internal:*/
 		void destroy();
 		void create();
@@ -35,11 +37,22 @@ namespace MyGUI
 			return mBufferID;
 		}
 
+		/** Uploaded vertexes are quads packed into four vertexes, draw them with quad index buffer */
+		bool isPackedQuads() const
+		{
+			return mPackedQuads;
+		}
+
 	private:
 		unsigned int mBufferID;
         //size_t mVertexCount;
 		size_t mNeedVertexCount;
 		size_t mSizeInBytes;
+
+		// вершины пишутся в память и при unlock отправляются в буфер, по возможности сжатыми квадами
+		std::vector<Vertex> mVertexes;
+		size_t mWrittenCount;
+		bool mPackedQuads;
 	};
 
 } // namespace MyGUI
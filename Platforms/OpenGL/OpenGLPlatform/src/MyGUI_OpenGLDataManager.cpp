@@ -63,48 +63,39 @@ namespace MyGUI
 
 	bool OpenGLDataManager::isDataExist(const std::string& _name)
 	{
-		const VectorString& files = getDataListNames(_name);
-		return !files.empty();
+		return !getDataPath(_name).empty();
 	}
 
 	const VectorString& OpenGLDataManager::getDataListNames(const std::string& _pattern)
 	{
 		static VectorString result;
-		common::VectorWString wresult;
 		result.clear();
-
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_pattern).asWStr(), false);
-		}
-
-		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
-		{
-			result.push_back(MyGUI::UString(*item).asUTF8());
-		}
-
+		scanFiles(result, _pattern, false);
 		return result;
 	}
 
 	const std::string& OpenGLDataManager::getDataPath(const std::string& _name)
 	{
 		static std::string path;
-		VectorString result;
-		common::VectorWString wresult;
+		path.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
+		MapString::const_iterator found = mDataPaths.find(_name);
+		if (found != mDataPaths.end())
 		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_name).asWStr(), true);
+			path = found->second;
+			return path;
 		}
 
-		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
-		{
-			result.push_back(MyGUI::UString(*item).asUTF8());
-		}
+		VectorString result;
+		scanFiles(result, _name, true);
 
 		if (!result.empty())
 		{
 			path = result[0];
+			// маски не кешируем, под них могут попасть новые файлы
+			if (_name.find_first_of("*?[") == std::string::npos)
+				mDataPaths[_name] = path;
+
 			if (result.size() > 1)
 			{
 				MYGUI_PLATFORM_LOG(Warning, "There are several files with name '" << _name << "'. '" << path << "' was used.");
@@ -123,6 +114,25 @@ namespace MyGUI
 		info.name = MyGUI::UString(_name).asWStr();
 		info.recursive = _recursive;
 		mPaths.push_back(info);
+
+		// файлы в новой папке могут перекрыть уже найденные
+		mDataPaths.clear();
+	}
+
+	void OpenGLDataManager::scanFiles(VectorString& _result, const std::string& _pattern, bool _fullpath)
+	{
+		common::VectorWString wresult;
+		std::wstring pattern = MyGUI::UString(_pattern).asWStr();
+
+		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
+		{
+			common::scanFolder(wresult, (*item).name, (*item).recursive, pattern, _fullpath);
+		}
+
+		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
+		{
+			_result.push_back(MyGUI::UString(*item).asUTF8());
+		}
 	}
 
 } // namespace MyGUI
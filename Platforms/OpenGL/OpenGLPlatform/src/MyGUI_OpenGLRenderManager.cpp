@@ -9,6 +9,7 @@
 #include "MyGUI_OpenGLVertexBuffer.h"
 #include "MyGUI_OpenGLDiagnostic.h"
 #include "MyGUI_VertexData.h"
+#include "MyGUI_VertexUtility.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_Timer.h"
 
@@ -31,6 +32,9 @@ namespace MyGUI
 		mUpdate(false),
 		mImageLoader(nullptr),
 		mPboIsSupported(false),
+		mIndexedQuads(true),
+		mQuadIndexBufferID(0),
+		mQuadIndexCount(0),
 		mIsInitialise(false)
 	{
 	}
@@ -105,7 +109,16 @@ namespace MyGUI
 		offset += (4);
 		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), (void*)offset);
 
-		glDrawArrays(GL_TRIANGLES, 0, _count);
+		if (buffer->isPackedQuads())
+		{
+			bindQuadIndexBuffer(_count);
+			glDrawElements(GL_TRIANGLES, (GLsizei)_count, GL_UNSIGNED_INT, 0);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		}
+		else
+		{
+			glDrawArrays(GL_TRIANGLES, 0, _count);
+		}
 
 		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 		glDisableClientState(GL_COLOR_ARRAY);
@@ -165,6 +178,37 @@ namespace MyGUI
 		glPopClientAttrib();
 	}
 
+	void OpenGLRenderManager::setIndexedQuads(bool _value)
+	{
+		mIndexedQuads = _value;
+	}
+
+	bool OpenGLRenderManager::getIndexedQuads() const
+	{
+		return mIndexedQuads;
+	}
+
+	void OpenGLRenderManager::bindQuadIndexBuffer(size_t _indexCount)
+	{
+		if (mQuadIndexCount < _indexCount)
+		{
+			// индексы у всех квадов одинаковые, буфер общий и растет с запасом
+			size_t quadCount = (std::max)(_indexCount, mQuadIndexCount * 2) / vertex_utility::PackedQuadIndexCount;
+			std::vector<uint32> indexes(quadCount * vertex_utility::PackedQuadIndexCount);
+			vertex_utility::writeQuadIndexes(&indexes[0], quadCount);
+
+			if (mQuadIndexBufferID == 0)
+				glGenBuffers(1, &mQuadIndexBufferID);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferID);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexes.size() * sizeof(uint32), &indexes[0], GL_STATIC_DRAW);
+			mQuadIndexCount = indexes.size();
+		}
+		else
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferID);
+		}
+	}
+
 	const RenderTargetInfo& OpenGLRenderManager::getInfo()
 	{
 		return mInfo;
@@ -271,6 +315,13 @@ namespace MyGUI
 			delete item->second;
 		}
 		mTextures.clear();
+
+		if (mQuadIndexBufferID != 0)
+		{
+			glDeleteBuffers(1, &mQuadIndexBufferID);
+			mQuadIndexBufferID = 0;
+			mQuadIndexCount = 0;
+		}
 	}
 
 } // namespace MyGUI
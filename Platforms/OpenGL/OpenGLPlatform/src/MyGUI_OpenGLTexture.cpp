@@ -301,7 +301,7 @@ namespace MyGUI
 		if (!OpenGLRenderManager::getInstance().isPixelBufferObjectSupported())
 		{
 			//Fallback if PBO's are not supported
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, mBuffer);
+			uploadLockedData(mBuffer);
             delete[] (char*)mBuffer;
 		}
 		else
@@ -311,7 +311,7 @@ namespace MyGUI
 
 			// copy pixels from PBO to texture object
 			// Use offset instead of ponter.
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, 0);
+			uploadLockedData(0);
 
 			// it is good idea to release PBOs with ID 0 after use.
 			// Once bound with 0, all pixel operations are back to normal ways.
@@ -323,6 +323,30 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	void* OpenGLTexture::lockRegion(const IntRect& _rect)
+	{
+		void* data = lock(TextureUsage::Write);
+		mLockRect = _rect;
+		return data;
+	}
+
+	void OpenGLTexture::uploadLockedData(const void* _data)
+	{
+		if (mLockRect.empty())
+		{
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, _data);
+			return;
+		}
+
+		// строки области идут в буфере с шагом ширины текстуры
+		size_t offset = ((size_t)mLockRect.top * mWidth + mLockRect.left) * mNumElemBytes;
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, mWidth);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, mLockRect.left, mLockRect.top, mLockRect.width(), mLockRect.height(), mPixelFormat, GL_UNSIGNED_BYTE, static_cast<const char*>(_data) + offset);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+		mLockRect.clear();
+	}
+
 	void OpenGLTexture::loadFromFile(const std::string& _filename)
 	{
 		destroy();
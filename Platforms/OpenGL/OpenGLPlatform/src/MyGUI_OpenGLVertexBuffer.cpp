@@ -7,6 +7,8 @@
 #include "MyGUI_OpenGLVertexBuffer.h"
 #include "MyGUI_VertexData.h"
 #include "MyGUI_OpenGLDiagnostic.h"
+#include "MyGUI_OpenGLRenderManager.h"
+#include "MyGUI_VertexUtility.h"
 
 #include "GL/glew.h"
 
@@ -20,7 +22,9 @@ namespace MyGUI
         mBufferID(0),
         //mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
         mNeedVertexCount(0),
-		mSizeInBytes(0)
+		mSizeInBytes(0),
+		mWrittenCount(0),
+		mPackedQuads(false)
 	{
 	}
 
@@ -34,6 +38,8 @@ namespace MyGUI
 		if (_count != mNeedVertexCount)
 		{
 			mNeedVertexCount = _count;
+			mVertexes.resize(mNeedVertexCount);
+			mPackedQuads = false;
 			destroy();
 			create();
 		}
@@ -48,31 +54,34 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
-		// Use glMapBuffer
-		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
-
-		// Discard the buffer
-		glBufferData(GL_ARRAY_BUFFER, mSizeInBytes, 0, GL_STREAM_DRAW);
-
-
-		Vertex* pBuffer = reinterpret_cast<Vertex*>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
-
-		MYGUI_PLATFORM_ASSERT(pBuffer, "Error lock vertex buffer");
-
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-		return pBuffer;
+		mWrittenCount = mNeedVertexCount;
+		return mVertexes.empty() ? nullptr : &mVertexes[0];
 	}
 
 	void OpenGLVertexBuffer::unlock()
 	{
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
+		size_t count = mWrittenCount;
+		mPackedQuads = false;
+		if (count != 0 && OpenGLRenderManager::getInstance().getIndexedQuads())
+		{
+			size_t packedCount = vertex_utility::packQuads(&mVertexes[0], count);
+			mPackedQuads = packedCount != count;
+			count = packedCount;
+		}
+
 		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
-		GLboolean result = glUnmapBuffer(GL_ARRAY_BUFFER);
+
+		// новое хранилище, чтобы не ждать отрисовку прошлого кадра
+		glBufferData(GL_ARRAY_BUFFER, count * sizeof(Vertex), count != 0 ? &mVertexes[0] : 0, GL_STREAM_DRAW);
+
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
 
-		MYGUI_PLATFORM_ASSERT(result, "Error unlock vertex buffer");
+	void OpenGLVertexBuffer::setWrittenVertexCount(size_t _value)
+	{
+		mWrittenCount = (std::min)(_value, mNeedVertexCount);
 	}
 
 	void OpenGLVertexBuffer::destroy()
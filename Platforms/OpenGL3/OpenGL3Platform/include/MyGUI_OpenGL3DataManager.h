@@ -49,6 +49,9 @@ namespace MyGUI
 	/*internal:*/
 		void addResourceLocation(const std::string& _name, bool _recursive);
 
+	private:
+		void scanFiles(VectorString& _result, const std::string& _pattern, bool _fullpath);
+
 	private:
 		struct ArhivInfo
 		{
@@ -57,6 +60,8 @@ namespace MyGUI
 		};
 		typedef std::vector<ArhivInfo> VectorArhivInfo;
 		VectorArhivInfo mPaths;
+		// найденные пути к файлам по имени, чтобы не сканировать папки и не конвертировать пути на каждый запрос
+		MapString mDataPaths;
 
 		bool mIsInitialise;
 	};
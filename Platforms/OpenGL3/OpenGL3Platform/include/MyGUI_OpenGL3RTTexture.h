@@ -32,6 +32,9 @@ namespace MyGUI
 			return mRenderTargetInfo;
 		}
 
+		virtual bool isTranslationSupported();
+		virtual void setTranslation(float _left, float _top);
+
 	private:
 		RenderTargetInfo mRenderTargetInfo;
 		unsigned int mTextureID;
@@ -59,6 +59,22 @@ namespace MyGUI
 		virtual void doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count);
 		/** @see IRenderTarget::getInfo */
 		virtual const RenderTargetInfo& getInfo();
+		/** @see IRenderTarget::isTranslationSupported */
+		virtual bool isTranslationSupported();
+		/** @see IRenderTarget::setTranslation */
+		virtual void setTranslation(float _left, float _top);
+
+		/** Send quads as four vertexes and draw them with shared index buffer, enabled by default.
+			Buffers with other triangles are always sent as is.
+		*/
+		void setIndexedQuads(bool _value);
+		/** Are quads sent as four vertexes */
+		bool getIndexedQuads() const;
+
+		/** Send vertexes as CompactVertex of half size when they fit (see vertex_utility::compactVertexes), disabled by default */
+		void setCompactVertexes(bool _value);
+		/** Are vertexes sent as CompactVertex */
+		bool getCompactVertexes() const;
 
     /* for use with RTT, flips Y coordinate when rendering */
     void doRenderRTT(IVertexBuffer* _buffer, ITexture* _texture, size_t _count); 
@@ -71,6 +87,7 @@ namespace MyGUI
 
 	private:
 		void destroyAllResources();
+		void bindQuadIndexBuffer(size_t _indexCount);
 
 	private:
 		IntSize mViewSize;
@@ -80,11 +97,17 @@ namespace MyGUI
     unsigned int mProgramID;
     unsigned int mReferenceCount; // for nested rendering
     int mYScaleUniformLocation;
+    int mTranslationUniformLocation;
 
 		typedef std::map<std::string, ITexture*> MapTexture;
 		MapTexture mTextures;
 		OpenGL3ImageLoader* mImageLoader;
 		bool mPboIsSupported;
+
+		bool mIndexedQuads;
+		bool mCompactVertexes;
+		unsigned int mQuadIndexBufferID;
+		size_t mQuadIndexCount;
         
 		bool mIsInitialise;
   };
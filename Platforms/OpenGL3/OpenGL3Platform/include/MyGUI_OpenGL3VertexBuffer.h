@@ -26,6 +26,8 @@ namespace MyGUI
 		virtual Vertex* lock();
 		virtual void unlock();
 
+		virtual void setWrittenVertexCount(size_t _value);
+
 	/*internal:*/
 		void destroy();
 		void create();
@@ -35,12 +37,29 @@ namespace MyGUI
 			return mVAOID;
 		}
 
+		/** Uploaded vertexes are quads packed into four vertexes, draw them with quad index buffer */
+		bool isPackedQuads() const
+		{
+			return mPackedQuads;
+		}
+
+	private:
+		void setupVertexFormat();
+
 	private:
     unsigned int mVAOID;
     unsigned int mBufferID;
         //size_t mVertexCount;
 		size_t mNeedVertexCount;
 		size_t mSizeInBytes;
+
+		// вершины пишутся в память и при unlock отправляются в буфер, по возможности сжатыми квадами
+		std::vector<Vertex> mVertexes;
+		std::vector<CompactVertex> mCompactVertexes;
+		size_t mWrittenCount;
+		bool mPackedQuads;
+		// в буфере CompactVertex
+		bool mCompact;
 	};
 
 } // namespace MyGUI
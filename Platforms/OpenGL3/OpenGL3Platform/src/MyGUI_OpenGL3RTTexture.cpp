@@ -97,4 +97,14 @@ namespace MyGUI
 		OpenGL3RenderManager::getInstance().doRenderRTT(_buffer, _texture, _count);
 	}
 
+	bool OpenGL3RTTexture::isTranslationSupported()
+	{
+		return true;
+	}
+
+	void OpenGL3RTTexture::setTranslation(float _left, float _top)
+	{
+		OpenGL3RenderManager::getInstance().setTranslation(_left, _top);
+	}
+
 } // namespace MyGUI
@@ -9,6 +9,7 @@
 #include "MyGUI_OpenGL3VertexBuffer.h"
 #include "MyGUI_OpenGL3Diagnostic.h"
 #include "MyGUI_VertexData.h"
+#include "MyGUI_VertexUtility.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_Timer.h"
 
@@ -31,6 +32,10 @@ namespace MyGUI
 		mUpdate(false),
 		mImageLoader(nullptr),
 		mPboIsSupported(false),
+		mIndexedQuads(true),
+		mCompactVertexes(false),
+		mQuadIndexBufferID(0),
+		mQuadIndexCount(0),
 		mIsInitialise(false)
 	{
 	}
@@ -70,11 +75,13 @@ namespace MyGUI
       "in vec4 VertexColor;\n"
       "in vec2 VertexTexCoord;\n"
       "uniform float YScale;\n"
+      "uniform vec2 Translation;\n"
       "void main()\n"
       "{\n"
       "  TexCoord = VertexTexCoord;\n"
       "  Color = VertexColor;\n"
       "  vec4 vpos = vec4(VertexPosition,1.0);\n"
+      "  vpos.xy += Translation;\n"
       "  vpos.y *= YScale;\n"
       "  gl_Position = vpos;\n"
       "}\n"
@@ -132,9 +139,14 @@ namespace MyGUI
     if (mYScaleUniformLocation == -1) {
       MYGUI_PLATFORM_EXCEPT("Unable to retrieve YScale variable location");
     }
+    mTranslationUniformLocation = glGetUniformLocation(progID, "Translation");
+    if (mTranslationUniformLocation == -1) {
+      MYGUI_PLATFORM_EXCEPT("Unable to retrieve Translation variable location");
+    }
     glUseProgram(progID);
     glUniform1i(textureUniLoc, 0); // set active sampler for 'Texture' to GL_TEXTURE0
     glUniform1f(mYScaleUniformLocation, 1.0f);
+    glUniform2f(mTranslationUniformLocation, 0.0f, 0.0f);
     glUseProgram(0);
 
     return progID;
@@ -212,12 +224,31 @@ namespace MyGUI
 		glBindTexture(GL_TEXTURE_2D, texture_id);
 
     glBindVertexArray(buffer_id);
-    glDrawArrays(GL_TRIANGLES, 0, _count);
+    if (buffer->isPackedQuads())
+    {
+      // индексный буфер запоминается в VAO
+      bindQuadIndexBuffer(_count);
+      glDrawElements(GL_TRIANGLES, (GLsizei)_count, GL_UNSIGNED_INT, 0);
+    }
+    else
+    {
+      glDrawArrays(GL_TRIANGLES, 0, _count);
+    }
     glBindVertexArray(0);
 
     glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
+	bool OpenGL3RenderManager::isTranslationSupported()
+	{
+		return true;
+	}
+
+	void OpenGL3RenderManager::setTranslation(float _left, float _top)
+	{
+		glUniform2f(mTranslationUniformLocation, _left, _top);
+	}
+
 	void OpenGL3RenderManager::begin()
 	{
     ++mReferenceCount;
@@ -237,6 +268,47 @@ namespace MyGUI
     }
   }
 
+	void OpenGL3RenderManager::setIndexedQuads(bool _value)
+	{
+		mIndexedQuads = _value;
+	}
+
+	bool OpenGL3RenderManager::getIndexedQuads() const
+	{
+		return mIndexedQuads;
+	}
+
+	void OpenGL3RenderManager::setCompactVertexes(bool _value)
+	{
+		mCompactVertexes = _value;
+	}
+
+	bool OpenGL3RenderManager::getCompactVertexes() const
+	{
+		return mCompactVertexes;
+	}
+
+	void OpenGL3RenderManager::bindQuadIndexBuffer(size_t _indexCount)
+	{
+		if (mQuadIndexCount < _indexCount)
+		{
+			// индексы у всех квадов одинаковые, буфер общий и растет с запасом
+			size_t quadCount = (std::max)(_indexCount, mQuadIndexCount * 2) / vertex_utility::PackedQuadIndexCount;
+			std::vector<uint32> indexes(quadCount * vertex_utility::PackedQuadIndexCount);
+			vertex_utility::writeQuadIndexes(&indexes[0], quadCount);
+
+			if (mQuadIndexBufferID == 0)
+				glGenBuffers(1, &mQuadIndexBufferID);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferID);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexes.size() * sizeof(uint32), &indexes[0], GL_STATIC_DRAW);
+			mQuadIndexCount = indexes.size();
+		}
+		else
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferID);
+		}
+	}
+
 	const RenderTargetInfo& OpenGL3RenderManager::getInfo()
 	{
 		return mInfo;
@@ -346,6 +418,13 @@ namespace MyGUI
 		}
 		mTextures.clear();
 
+		if (mQuadIndexBufferID != 0)
+		{
+			glDeleteBuffers(1, &mQuadIndexBufferID);
+			mQuadIndexBufferID = 0;
+			mQuadIndexCount = 0;
+		}
+
     if (mProgramID) {
       glDeleteProgram(mProgramID);
       mProgramID = 0;
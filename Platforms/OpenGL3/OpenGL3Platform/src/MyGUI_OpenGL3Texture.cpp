@@ -294,7 +294,7 @@ namespace MyGUI
 		if (!OpenGL3RenderManager::getInstance().isPixelBufferObjectSupported())
 		{
 			//Fallback if PBO's are not supported
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, mBuffer);
+			uploadLockedData(mBuffer);
             delete[] (char*)mBuffer;
 		}
 		else
@@ -304,7 +304,7 @@ namespace MyGUI
 
 			// copy pixels from PBO to texture object
 			// Use offset instead of ponter.
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, 0);
+			uploadLockedData(0);
 
 			// it is good idea to release PBOs with ID 0 after use.
 			// Once bound with 0, all pixel operations are back to normal ways.
@@ -316,6 +316,30 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	void* OpenGL3Texture::lockRegion(const IntRect& _rect)
+	{
+		void* data = lock(TextureUsage::Write);
+		mLockRect = _rect;
+		return data;
+	}
+
+	void OpenGL3Texture::uploadLockedData(const void* _data)
+	{
+		if (mLockRect.empty())
+		{
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mPixelFormat, GL_UNSIGNED_BYTE, _data);
+			return;
+		}
+
+		// строки области идут в буфере с шагом ширины текстуры
+		size_t offset = ((size_t)mLockRect.top * mWidth + mLockRect.left) * mNumElemBytes;
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, mWidth);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, mLockRect.left, mLockRect.top, mLockRect.width(), mLockRect.height(), mPixelFormat, GL_UNSIGNED_BYTE, static_cast<const char*>(_data) + offset);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+		mLockRect.clear();
+	}
+
 	void OpenGL3Texture::loadFromFile(const std::string& _filename)
 	{
 		destroy();
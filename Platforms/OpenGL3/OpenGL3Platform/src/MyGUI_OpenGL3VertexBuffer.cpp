@@ -7,6 +7,8 @@
 #include "MyGUI_OpenGL3VertexBuffer.h"
 #include "MyGUI_VertexData.h"
 #include "MyGUI_OpenGL3Diagnostic.h"
+#include "MyGUI_OpenGL3RenderManager.h"
+#include "MyGUI_VertexUtility.h"
 
 #include "GL/glew.h"
 
@@ -20,7 +22,10 @@ namespace MyGUI
       mBufferID(0), mVAOID(0),
         //mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
         mNeedVertexCount(0),
-		mSizeInBytes(0)
+		mSizeInBytes(0),
+		mWrittenCount(0),
+		mPackedQuads(false),
+		mCompact(false)
 	{
 	}
 
@@ -34,6 +39,9 @@ namespace MyGUI
 		if (_count != mNeedVertexCount)
 		{
 			mNeedVertexCount = _count;
+			mVertexes.resize(mNeedVertexCount);
+			mCompactVertexes.clear();
+			mPackedQuads = false;
 			destroy();
 			create();
 		}
@@ -48,31 +56,50 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
-		// Use glMapBuffer
-		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
-
-		// Discard the buffer
-		glBufferData(GL_ARRAY_BUFFER, mSizeInBytes, 0, GL_STREAM_DRAW);
-
-
-		Vertex* pBuffer = reinterpret_cast<Vertex*>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
-
-		MYGUI_PLATFORM_ASSERT(pBuffer, "Error lock vertex buffer");
-
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-		return pBuffer;
+		mWrittenCount = mNeedVertexCount;
+		return mVertexes.empty() ? nullptr : &mVertexes[0];
 	}
 
 	void OpenGL3VertexBuffer::unlock()
 	{
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
+		size_t count = mWrittenCount;
+		mPackedQuads = false;
+		if (count != 0 && OpenGL3RenderManager::getInstance().getIndexedQuads())
+		{
+			size_t packedCount = vertex_utility::packQuads(&mVertexes[0], count);
+			mPackedQuads = packedCount != count;
+			count = packedCount;
+		}
+
+		bool compact = false;
+		if (count != 0 && OpenGL3RenderManager::getInstance().getCompactVertexes())
+		{
+			mCompactVertexes.resize(mNeedVertexCount);
+			compact = vertex_utility::compactVertexes(&mVertexes[0], count, &mCompactVertexes[0]);
+		}
+
+		if (compact != mCompact)
+		{
+			mCompact = compact;
+			setupVertexFormat();
+		}
+
 		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
-		GLboolean result = glUnmapBuffer(GL_ARRAY_BUFFER);
+
+		// новое хранилище, чтобы не ждать отрисовку прошлого кадра
+		if (mCompact)
+			glBufferData(GL_ARRAY_BUFFER, count * sizeof(CompactVertex), &mCompactVertexes[0], GL_STREAM_DRAW);
+		else
+			glBufferData(GL_ARRAY_BUFFER, count * sizeof(Vertex), count != 0 ? &mVertexes[0] : 0, GL_STREAM_DRAW);
+
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
 
-		MYGUI_PLATFORM_ASSERT(result, "Error unlock vertex buffer");
+	void OpenGL3VertexBuffer::setWrittenVertexCount(size_t _value)
+	{
+		mWrittenCount = (std::min)(_value, mNeedVertexCount);
 	}
 
 	void OpenGL3VertexBuffer::destroy()
@@ -114,9 +141,7 @@ namespace MyGUI
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
     glEnableVertexAttribArray(2);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)NULL);
-    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLubyte *)offsetof(struct Vertex, colour));
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)offsetof(struct Vertex, u));
+    setupVertexFormat();
 
     //glVertexPointer(3, GL_FLOAT, sizeof(Vertex), (void*)offset);
     //offset += (sizeof(float) * 3);
@@ -129,4 +154,27 @@ namespace MyGUI
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
+	void OpenGL3VertexBuffer::setupVertexFormat()
+	{
+		glBindVertexArray(mVAOID);
+		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
+
+		if (mCompact)
+		{
+			// z не передается и в шейдере равен 0
+			glVertexAttribPointer(0, 2, GL_SHORT, GL_TRUE, sizeof(CompactVertex), (GLubyte *)offsetof(struct CompactVertex, x));
+			glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CompactVertex), (GLubyte *)offsetof(struct CompactVertex, colour));
+			glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CompactVertex), (GLubyte *)offsetof(struct CompactVertex, u));
+		}
+		else
+		{
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)NULL);
+			glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLubyte *)offsetof(struct Vertex, colour));
+			glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)offsetof(struct Vertex, u));
+		}
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
 } // namespace MyGUI
@@ -0,0 +1,143 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+// Headless test: widgets resized inside WidgetManager::beginUpdate/endUpdate must end up
+// in the same state as widgets resized immediately, including ScrollView view and scroll range.
+
+#include "MyGUI.h"
+#include "MyGUI_DummyPlatform.h"
+#include <cstdio>
+
+namespace test
+{
+
+	const char* SkinXml =
+		"<MyGUI type=\"Resource\" version=\"1.1\">"
+		"<Resource type=\"ResourceSkin\" name=\"TestScrollView\" size=\"100 100\">"
+		"<Child type=\"Widget\" skin=\"Default\" offset=\"0 0 84 100\" align=\"Stretch\" name=\"Client\"/>"
+		"<Child type=\"ScrollBar\" skin=\"Default\" offset=\"84 0 16 100\" align=\"Right VStretch\" name=\"VScroll\"/>"
+		"</Resource>"
+		"</MyGUI>";
+
+	// exposes scroll bar created from skin
+	class ScrollViewAccess :
+		public MyGUI::ScrollView
+	{
+	public:
+		MyGUI::ScrollBar* getVScroll()
+		{
+			return mVScroll;
+		}
+	};
+
+	std::string dumpScrollView(MyGUI::ScrollView* _view)
+	{
+		MyGUI::ScrollBar* scroll = static_cast<ScrollViewAccess*>(_view)->getVScroll();
+		return MyGUI::utility::toString(
+			"coord ", _view->getCoord().print(),
+			" view ", _view->getViewCoord().print(),
+			" offset ", _view->getViewOffset().print(),
+			" range ", scroll->getScrollRange());
+	}
+
+	MyGUI::ScrollView* createScrollView()
+	{
+		MyGUI::ScrollView* view = MyGUI::Gui::getInstance().createWidget<MyGUI::ScrollView>("TestScrollView", MyGUI::IntCoord(0, 0, 200, 200), MyGUI::Align::Default, "Main");
+		view->setCanvasSize(150, 1000);
+		view->setViewOffset(MyGUI::IntPoint(0, -300));
+		return view;
+	}
+
+	void resize(MyGUI::ScrollView* _view)
+	{
+		_view->setSize(300, 400);
+		_view->setCoord(10, 20, 250, 600);
+	}
+
+	// child coordinates set explicitly after parent resize must not get alignment delta,
+	// set before resize they must get it as with immediate update
+	std::string resizeWithChildren(bool _batched)
+	{
+		MyGUI::Widget* parent = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(0, 0, 200, 200), MyGUI::Align::Default, "Main");
+		MyGUI::Widget* after = parent->createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(150, 150, 40, 40), MyGUI::Align::Right | MyGUI::Align::Bottom);
+		MyGUI::Widget* before = parent->createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(150, 150, 40, 40), MyGUI::Align::Stretch);
+		MyGUI::Widget* center = parent->createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(80, 80, 40, 40), MyGUI::Align::Center);
+
+		if (_batched)
+			MyGUI::WidgetManager::getInstance().beginUpdate();
+		before->setCoord(10, 10, 50, 50);
+		parent->setSize(300, 250);
+		after->setCoord(10, 10, 50, 50);
+		center->setPosition(5, 5);
+		if (_batched)
+			MyGUI::WidgetManager::getInstance().endUpdate();
+
+		std::string result = MyGUI::utility::toString(
+			"after ", after->getCoord().print(),
+			" before ", before->getCoord().print(),
+			" center ", center->getCoord().print());
+		MyGUI::Gui::getInstance().destroyWidget(parent);
+		return result;
+	}
+
+	int run()
+	{
+		MyGUI::xml::Document doc;
+		std::istringstream stream(SkinXml);
+		doc.open(stream);
+		MyGUI::ResourceManager::getInstance().loadFromXmlNode(doc.getRoot(), "", MyGUI::Version(1, 1, 0));
+
+		MyGUI::ScrollView* immediate = createScrollView();
+		resize(immediate);
+		std::string expected = dumpScrollView(immediate);
+
+		MyGUI::ScrollView* batched = createScrollView();
+		MyGUI::WidgetManager::getInstance().beginUpdate();
+		resize(batched);
+		MyGUI::WidgetManager::getInstance().endUpdate();
+		std::string result = dumpScrollView(batched);
+
+		MyGUI::Gui::getInstance().destroyWidget(immediate);
+		MyGUI::Gui::getInstance().destroyWidget(batched);
+
+		if (result != expected)
+		{
+			printf("FAILED: batched ScrollView differs\n  immediate %s\n  batched   %s\n", expected.c_str(), result.c_str());
+			return 1;
+		}
+
+		expected = resizeWithChildren(false);
+		result = resizeWithChildren(true);
+		if (result != expected)
+		{
+			printf("FAILED: batched children differ\n  immediate %s\n  batched   %s\n", expected.c_str(), result.c_str());
+			return 1;
+		}
+
+		printf("PASSED: %s\n", result.c_str());
+		return 0;
+	}
+
+} // namespace test
+
+int main()
+{
+	MyGUI::DummyPlatform* platform = new MyGUI::DummyPlatform();
+	platform->initialise("");
+	platform->getRenderManagerPtr()->setViewSize(1024, 768);
+
+	MyGUI::Gui* gui = new MyGUI::Gui();
+	gui->initialise("");
+	MyGUI::LayerManager::getInstance().createLayerAt("Main", "OverlappedLayer", 0);
+
+	int result = test::run();
+
+	gui->shutdown();
+	delete gui;
+	platform->shutdown();
+	delete platform;
+
+	return result;
+}
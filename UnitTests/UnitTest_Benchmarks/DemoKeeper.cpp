@@ -0,0 +1,1058 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "Precompiled.h"
+#include "DemoKeeper.h"
+#include "Base/Main.h"
+#include "MyGUI_FileLogListener.h"
+#include "MyGUI_AsyncLogListener.h"
+#include "MyGUI_EditText.h"
+#include "MyGUI_VertexUtility.h"
+#include "MyGUI_TextureUtility.h"
+
+#ifdef MYGUI_OPENGL3_PLATFORM
+#include "MyGUI_OpenGL3RenderManager.h"
+#endif
+
+namespace demo
+{
+
+	const size_t HudItemCount = 2000;
+	const size_t HudFrameCount = 100;
+	const size_t PanelItemCount = 5000;
+	const size_t PanelFrameCount = 200;
+	const size_t LogMessageCount = 1000000;
+	const size_t ScrollItemCount = 10000;
+	const size_t ScrollFrameCount = 500;
+	const size_t RichTextPageCount = 10;
+	const size_t RichTextParagraphCount = 8;
+	const size_t RichTextWordCount = 60;
+	const size_t TreeFolderCount = 1000;
+	const size_t TreeFileCount = 1000;
+	const size_t TreeFrameCount = 500;
+	const size_t LabelRowCount = 10000;
+	const size_t LabelCount = 50;
+	const size_t LabelPassCount = 10;
+	const size_t StringConversionCount = 1000000;
+	const size_t GlyphCount = 1000;
+	const size_t GlyphPassCount = 1000;
+	const size_t UploadTextCount = 1000;
+	const size_t UploadFrameCount = 100;
+	const size_t DragItemCount = 2000;
+	const size_t DragFrameCount = 200;
+	const size_t TweenItemCount = 25000;
+	const size_t TweenFrameCount = 60;
+	const size_t PoolRowCount = 10;
+	const size_t PoolCycleCount = 1000;
+	const size_t CompiledRowCount = 66;
+	const size_t CompiledInstanceCount = 1000;
+	const size_t CompiledBatchSize = 50;
+	const size_t InternRowCount = 100;
+	const size_t InternColumnCount = 200;
+	const size_t InternLookupPassCount = 20;
+	const size_t MemoryRowCount = 100;
+	const size_t MemoryColumnCount = 200;
+	const size_t EventWidgetCount = 20000;
+	const size_t EventPassCount = 5;
+	const size_t EventSubscribeStep = 10;
+	const size_t TextureFrameCount = 10;
+	const int CanvasSize = 2048;
+	const int CanvasTileSize = 32;
+	const size_t CanvasTileCount = 16;
+	const size_t CanvasFrameCount = 100;
+
+	DemoKeeper::DemoKeeper() :
+		mOutput(nullptr)
+	{
+	}
+
+	void DemoKeeper::setupResources()
+	{
+		base::BaseManager::setupResources();
+		addResourceLocation(getRootMedia() + "/Common/Demos");
+		addResourceLocation(getRootMedia() + "/UnitTests/UnitTest_TreeControl");
+	}
+
+	void DemoKeeper::createScene()
+	{
+		base::BaseDemoManager::createScene();
+
+		mOutput = MyGUI::Gui::getInstance().createWidget<MyGUI::EditBox>("EditBoxStretch", MyGUI::IntCoord(10, 10, 600, 400), MyGUI::Align::Default, "Overlapped");
+		mOutput->setEditMultiLine(true);
+		mOutput->setEditReadOnly(true);
+
+		benchmarkHudUpdate();
+		benchmarkCachedLayer();
+		benchmarkLogging();
+		benchmarkScrollView();
+		benchmarkRichText();
+		benchmarkTreeControl();
+		benchmarkTextViewCache();
+		benchmarkStringConversion();
+		benchmarkGlyphVertices();
+		benchmarkVertexUpload();
+		benchmarkWindowDrag();
+		benchmarkTweens();
+		benchmarkLayoutPool();
+		benchmarkCompiledLayout();
+		benchmarkStringIds();
+		benchmarkWidgetMemory();
+		benchmarkWidgetEvents();
+		benchmarkTextureBudget();
+		benchmarkCanvasUpdate();
+	}
+
+	void DemoKeeper::destroyScene()
+	{
+		MyGUI::Gui::getInstance().destroyWidget(mOutput);
+		mOutput = nullptr;
+	}
+
+	void DemoKeeper::addResult(const std::string& _name, unsigned long _time, const std::string& _info)
+	{
+		std::string line = MyGUI::utility::toString(_name, " : ", _time, " ms");
+		if (!_info.empty())
+			line += " (" + _info + ")";
+
+		MYGUI_LOG(Info, "benchmark " << line);
+		mOutput->addText(line + "\n");
+	}
+
+	void updateHud(const MyGUI::VectorWidgetPtr& _items, size_t _frame)
+	{
+		for (size_t index = 0; index < _items.size(); ++index)
+		{
+			MyGUI::Widget* item = _items[index];
+			int offset = (int)((_frame + index) % 10);
+
+			// typical HUD element update: move, resize and fade
+			item->setPosition((int)(index % 50) * 20 + offset, (int)(index / 50) * 20);
+			item->setSize(16 + offset, 16);
+			item->setAlpha(0.5f + (float)offset / 20.0f);
+			item->setVisible((_frame + index) % 7 != 0);
+		}
+	}
+
+	void DemoKeeper::benchmarkHudUpdate()
+	{
+		MyGUI::Widget* hud = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+		MyGUI::VectorWidgetPtr items;
+		for (size_t index = 0; index < HudItemCount; ++index)
+			items.push_back(hud->createWidget<MyGUI::ImageBox>("ImageBox", MyGUI::IntCoord(0, 0, 16, 16), MyGUI::Align::Default));
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < HudFrameCount; ++frame)
+		{
+			hud->setPosition((int)(frame % 2), 0);
+			updateHud(items, frame);
+		}
+		addResult("HUD update immediate", timer.getMilliseconds(), MyGUI::utility::toString(HudItemCount, " widgets x ", HudFrameCount, " frames"));
+
+		MyGUI::WidgetManager& manager = MyGUI::WidgetManager::getInstance();
+		timer.reset();
+		for (size_t frame = 0; frame < HudFrameCount; ++frame)
+		{
+			manager.beginUpdate();
+			hud->setPosition((int)(frame % 2), 0);
+			updateHud(items, frame);
+			manager.endUpdate();
+		}
+		addResult("HUD update batched", timer.getMilliseconds(), MyGUI::utility::toString(HudItemCount, " widgets x ", HudFrameCount, " frames"));
+
+		MyGUI::Gui::getInstance().destroyWidget(hud);
+	}
+
+	unsigned long renderStaticPanel(const std::string& _layerType)
+	{
+		MyGUI::LayerManager& layers = MyGUI::LayerManager::getInstance();
+		MyGUI::ILayer* layer = layers.createLayerAt("Benchmark" + _layerType, _layerType, 0);
+
+		MyGUI::Widget* panel = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, layer->getName());
+		for (size_t index = 0; index < PanelItemCount; ++index)
+			panel->createWidget<MyGUI::ImageBox>("ImageBox", MyGUI::IntCoord((int)(index % 100) * 10, (int)(index / 100) * 10, 8, 8), MyGUI::Align::Default);
+
+		MyGUI::IRenderTarget* target = dynamic_cast<MyGUI::IRenderTarget*>(MyGUI::RenderManager::getInstancePtr());
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < PanelFrameCount; ++frame)
+		{
+			target->begin();
+			layer->renderToTarget(target, false);
+			target->end();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		MyGUI::Gui::getInstance().destroyWidget(panel);
+
+		return result;
+	}
+
+	void DemoKeeper::benchmarkCachedLayer()
+	{
+		std::string info = MyGUI::utility::toString(PanelItemCount, " widgets x ", PanelFrameCount, " frames");
+		addResult("Static panel OverlappedLayer", renderStaticPanel("OverlappedLayer"), info);
+		addResult("Static panel CachedLayer", renderStaticPanel("CachedLayer"), info);
+	}
+
+	unsigned long writeLogMessages(MyGUI::ILogListener* _listener)
+	{
+		MyGUI::LogSource source;
+		source.addLogListener(_listener);
+		source.open();
+
+		time_t ctTime;
+		time(&ctTime);
+		struct tm currentTime = *localtime(&ctTime);
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t index = 0; index < LogMessageCount; ++index)
+			source.log("Benchmark", MyGUI::LogLevel::Info, &currentTime, MyGUI::LogStream() << "message " << index << MyGUI::LogStream::End(), __FILE__, __LINE__);
+		source.close();
+
+		return timer.getMilliseconds();
+	}
+
+	void DemoKeeper::benchmarkLogging()
+	{
+		std::string info = MyGUI::utility::toString(LogMessageCount, " messages");
+
+		// messages below filter level are not formatted at all
+		MyGUI::LogManager& manager = MyGUI::LogManager::getInstance();
+		MyGUI::LogLevel level = manager.getLoggingLevel();
+		manager.setLoggingLevel(MyGUI::LogLevel::Warning);
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t index = 0; index < LogMessageCount; ++index)
+			MYGUI_LOGGING("Benchmark", Info, "message " << index);
+		unsigned long filteredTime = timer.getMilliseconds();
+
+		manager.setLoggingLevel(level);
+		addResult("Log filtered level", filteredTime, info);
+
+		MyGUI::FileLogListener file;
+		file.setFileName("Benchmark.log");
+		addResult("Log unfiltered FileLogListener", writeLogMessages(&file), info);
+
+		MyGUI::AsyncLogListener async;
+		async.addLogListener(&file);
+		addResult("Log unfiltered AsyncLogListener", writeLogMessages(&async), info);
+	}
+
+	void DemoKeeper::benchmarkScrollView()
+	{
+		const int itemHeight = 20;
+		MyGUI::ScrollView* view = MyGUI::Gui::getInstance().createWidget<MyGUI::ScrollView>("ScrollView", MyGUI::IntCoord(620, 10, 300, 400), MyGUI::Align::Default, "Overlapped");
+		view->setCanvasSize(280, (int)ScrollItemCount * itemHeight);
+
+		MyGUI::VectorWidgetPtr items;
+		for (size_t index = 0; index < ScrollItemCount; ++index)
+		{
+			MyGUI::Button* item = view->createWidget<MyGUI::Button>("Button", MyGUI::IntCoord(0, (int)index * itemHeight, 280, itemHeight - 2), MyGUI::Align::Default);
+			item->setCaption(MyGUI::utility::toString("Item ", index));
+			items.push_back(item);
+		}
+
+		MyGUI::IRenderTarget* target = dynamic_cast<MyGUI::IRenderTarget*>(MyGUI::RenderManager::getInstancePtr());
+		int range = (int)ScrollItemCount * itemHeight - view->getViewCoord().height;
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < ScrollFrameCount; ++frame)
+		{
+			view->setViewOffset(MyGUI::IntPoint(0, -(int)((frame * 37) % range)));
+			target->begin();
+			MyGUI::LayerManager::getInstance().renderToTarget(target, false);
+			target->end();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		size_t culled = 0;
+		for (size_t index = 0; index < items.size(); ++index)
+		{
+			if (items[index]->_isCulled())
+				culled ++;
+		}
+
+		addResult("ScrollView scroll", result, MyGUI::utility::toString(ScrollItemCount, " items x ", ScrollFrameCount, " frames, ", culled, " culled"));
+
+		MyGUI::Gui::getInstance().destroyWidget(view);
+	}
+
+	const char* RichTextSkinXml =
+		"<MyGUI type=\"Resource\" version=\"1.1\">"
+		"  <Resource type=\"ResourceSkin\" name=\"BenchmarkRichText\" size=\"16 16\">"
+		"    <BasisSkin type=\"RichText\" offset=\"0 0 16 16\" align=\"Stretch\">"
+		"      <State name=\"normal\" colour=\"1 1 1\"/>"
+		"    </BasisSkin>"
+		"  </Resource>"
+		"</MyGUI>";
+
+	// слово документа и его стиль, 0 - обычный текст, 1 - цветной, 2 - ссылка
+	int getWordStyle(size_t _index)
+	{
+		return (_index % 17) == 0 ? 1 : ((_index % 23) == 0 ? 2 : 0);
+	}
+
+	std::string getWord(size_t _index)
+	{
+		static const char* words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do" };
+		return words[_index % 10];
+	}
+
+	// старый способ HyperTextBox, каждое слово отдельный TextBox с раскладкой потоком
+	size_t layoutWordWidgets(MyGUI::Widget* _parent, int _width)
+	{
+		size_t result = 0;
+		int top = 0;
+		for (size_t paragraph = 0; paragraph < RichTextPageCount * RichTextParagraphCount; ++paragraph)
+		{
+			int left = 0;
+			int lineHeight = 0;
+			for (size_t word = 0; word < RichTextWordCount; ++word)
+			{
+				size_t index = paragraph * RichTextWordCount + word;
+				MyGUI::TextBox* text = _parent->createWidget<MyGUI::TextBox>("TextBox", MyGUI::IntCoord(), MyGUI::Align::Default);
+				text->setCaption(getWord(index) + " ");
+				int style = getWordStyle(index);
+				if (style == 1)
+					text->setTextColour(MyGUI::Colour::Red);
+				else if (style == 2)
+					text->setTextColour(MyGUI::Colour::Blue);
+				result ++;
+
+				MyGUI::IntSize size = text->getTextSize();
+				if (left + size.width > _width && left != 0)
+				{
+					left = 0;
+					top += lineHeight;
+					lineHeight = 0;
+				}
+				text->setCoord(left, top, size.width, size.height);
+				left += size.width;
+				lineHeight = (std::max)(lineHeight, size.height);
+			}
+			top += lineHeight * 3 / 2;
+		}
+		return result;
+	}
+
+	std::string makeRichTextDocument()
+	{
+		std::string result;
+		for (size_t paragraph = 0; paragraph < RichTextPageCount * RichTextParagraphCount; ++paragraph)
+		{
+			result += "<p>";
+			for (size_t word = 0; word < RichTextWordCount; ++word)
+			{
+				size_t index = paragraph * RichTextWordCount + word;
+				int style = getWordStyle(index);
+				if (style == 1)
+					result += "<color value='#FF0000'>" + getWord(index) + "</color> ";
+				else if (style == 2)
+					result += "<url value='link" + MyGUI::utility::toString(index) + "'>" + getWord(index) + "</url> ";
+				else
+					result += getWord(index) + " ";
+			}
+			result += "</p>";
+		}
+		return result;
+	}
+
+	void DemoKeeper::benchmarkRichText()
+	{
+		const int width = 500;
+		std::string info = MyGUI::utility::toString(RichTextPageCount, " pages, ");
+
+		MyGUI::Widget* panel = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(620, 10, width, 400), MyGUI::Align::Default, "Overlapped");
+		MyGUI::Timer timer;
+		timer.reset();
+		size_t widgets = layoutWordWidgets(panel, width);
+		unsigned long wordTime = timer.getMilliseconds();
+		size_t wordBytes = widgets * (sizeof(MyGUI::TextBox) + sizeof(MyGUI::EditText));
+		addResult("Rich text per word widgets", wordTime, MyGUI::utility::toString(info, widgets, " widgets, ~", wordBytes / 1024, " KB objects"));
+		MyGUI::Gui::getInstance().destroyWidget(panel);
+
+		MyGUI::xml::Document doc;
+		std::istringstream stream(RichTextSkinXml);
+		doc.open(stream);
+		MyGUI::ResourceManager::getInstance().loadFromXmlNode(doc.getRoot(), "", MyGUI::Version(1, 1, 0));
+
+		std::string document = makeRichTextDocument();
+		timer.reset();
+		MyGUI::TextBox* box = MyGUI::Gui::getInstance().createWidget<MyGUI::TextBox>("BenchmarkRichText", MyGUI::IntCoord(620, 10, width, 400), MyGUI::Align::Default, "Overlapped");
+		box->setCaption(document);
+		unsigned long richTime = timer.getMilliseconds();
+
+		MyGUI::RichText* text = box->getSubWidgetText()->castType<MyGUI::RichText>();
+		size_t richBytes = sizeof(MyGUI::TextBox) + sizeof(MyGUI::RichText) + text->getQuadCount() * (sizeof(MyGUI::FloatRect) * 2 + sizeof(float) + sizeof(MyGUI::uint32) * 2);
+		addResult("Rich text RichText", richTime, MyGUI::utility::toString(info, "1 widget, ", text->getBatchCount(), " draw items, ", text->getQuadCount(), " quads, ~", richBytes / 1024, " KB objects"));
+
+		MyGUI::Gui::getInstance().destroyWidget(box);
+		MyGUI::ResourceManager::getInstance().removeByName("BenchmarkRichText");
+	}
+
+	void DemoKeeper::benchmarkTreeControl()
+	{
+		MyGUI::ResourceManager::getInstance().load("TreeControlSkin.xml");
+		MyGUI::ResourceManager::getInstance().load("TreeControlTemplate.xml");
+
+		MyGUI::TreeControl* tree = MyGUI::Gui::getInstance().createWidget<MyGUI::TreeControl>("Tree", MyGUI::IntCoord(620, 10, 300, 400), MyGUI::Align::Default, "Overlapped");
+		MyGUI::TreeControl::Node* root = tree->getRoot();
+		for (size_t folder = 0; folder < TreeFolderCount; ++folder)
+		{
+			MyGUI::TreeControl::Node* node = new MyGUI::TreeControl::Node(MyGUI::utility::toString("Folder ", folder), root);
+			node->setPrepared(true);
+			for (size_t file = 0; file < TreeFileCount; ++file)
+			{
+				MyGUI::TreeControl::Node* child = new MyGUI::TreeControl::Node(MyGUI::utility::toString("File ", file), "Unknown", node);
+				child->setPrepared(true);
+			}
+		}
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t folder = 0; folder < TreeFolderCount; ++folder)
+			root->getChildren()[folder]->setExpanded(true);
+		size_t rows = tree->getRowCount();
+		addResult("TreeControl expand", timer.getMilliseconds(), MyGUI::utility::toString(rows, " rows"));
+
+		MyGUI::IRenderTarget* target = dynamic_cast<MyGUI::IRenderTarget*>(MyGUI::RenderManager::getInstancePtr());
+
+		timer.reset();
+		for (size_t frame = 0; frame < TreeFrameCount; ++frame)
+		{
+			tree->beginToRow((frame * 7919) % rows);
+			target->begin();
+			MyGUI::LayerManager::getInstance().renderToTarget(target, false);
+			target->end();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		addResult("TreeControl scroll", result, MyGUI::utility::toString(rows, " rows x ", TreeFrameCount, " frames, ", tree->getClientWidget()->getChildCount(), " line widgets"));
+
+		MyGUI::Gui::getInstance().destroyWidget(tree);
+	}
+
+	unsigned long updateLabelRows(const MyGUI::VectorWidgetPtr& _rows, bool _utf8)
+	{
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t pass = 0; pass < LabelPassCount; ++pass)
+		{
+			for (size_t index = 0; index < _rows.size(); ++index)
+			{
+				// text is laid out on first request of its size
+				MyGUI::TextBox* row = _rows[index]->castType<MyGUI::TextBox>();
+				std::string caption = MyGUI::utility::toString("Label ", (index + pass) % LabelCount);
+				if (_utf8)
+					row->setCaptionUTF8(caption);
+				else
+					row->setCaption(caption);
+				row->getTextSize();
+			}
+		}
+		return timer.getMilliseconds();
+	}
+
+	void DemoKeeper::benchmarkTextViewCache()
+	{
+		MyGUI::Widget* panel = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+		MyGUI::VectorWidgetPtr rows;
+		for (size_t index = 0; index < LabelRowCount; ++index)
+			rows.push_back(panel->createWidget<MyGUI::TextBox>("TextBox", MyGUI::IntCoord(0, (int)index * 20, 200, 20), MyGUI::Align::Default));
+
+		std::string info = MyGUI::utility::toString(LabelRowCount, " rows x ", LabelPassCount, " passes, ", LabelCount, " labels");
+		MyGUI::TextViewCache& cache = MyGUI::TextViewCache::getInstance();
+
+		addResult("Text layout without cache", updateLabelRows(rows, false), info);
+		addResult("Text layout from UTF-8 caption", updateLabelRows(rows, true), info);
+
+		cache.setEnabled(true);
+		cache.resetStatistics();
+		unsigned long result = updateLabelRows(rows, false);
+		addResult("Text layout with TextViewCache", result, MyGUI::utility::toString(info, ", hit rate ", (int)(cache.getHitRate() * 100), "%, ", cache.getSize(), " layouts"));
+
+		MyGUI::Gui::getInstance().destroyWidget(panel);
+		cache.setEnabled(false);
+	}
+
+	void DemoKeeper::benchmarkStringConversion()
+	{
+		const std::string source = "Caption \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+
+		MyGUI::UString::resetConversionStatistics();
+		size_t length = 0;
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t index = 0; index < StringConversionCount; ++index)
+		{
+			MyGUI::UString value(source);
+			length += value.asUTF8().size();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+#ifdef MYGUI_USTRING_STATISTICS
+		const MyGUI::UString::ConversionStatistics& statistics = MyGUI::UString::getConversionStatistics();
+		addResult("UString UTF-8 round trip", result, MyGUI::utility::toString(statistics.fromUTF8, " from UTF-8, ", statistics.toUTF8, " to UTF-8, ", length, " bytes"));
+#else
+		addResult("UString UTF-8 round trip", result, MyGUI::utility::toString(StringConversionCount, " round trips, ", length, " bytes"));
+#endif
+	}
+
+	std::string getGlyphRate(size_t _count, unsigned long _time)
+	{
+		return MyGUI::utility::toString(_count, " glyphs, ", (size_t)((double)_count / std::max(_time, 1ul) / 1000.0), "M glyphs/s");
+	}
+
+	void DemoKeeper::benchmarkGlyphVertices()
+	{
+		MyGUI::RenderTargetInfo info;
+		info.pixScaleX = 1.0f / 1024;
+		info.pixScaleY = 1.0f / 768;
+
+		std::vector<MyGUI::FloatRect> glyphs;
+		for (size_t index = 0; index < GlyphCount; ++index)
+		{
+			float left = (float)(index % 100) * 9.0f;
+			float top = (float)(index / 100) * 16.0f;
+			glyphs.push_back(MyGUI::FloatRect(left, top, left + 8.0f, top + 14.0f));
+		}
+		MyGUI::FloatRect uv(0.0f, 0.0f, 0.1f, 0.1f);
+		std::vector<MyGUI::Vertex> vertexes(GlyphCount * MyGUI::VertexQuad::VertexCount);
+		size_t total = GlyphCount * GlyphPassCount;
+
+		// per glyph transform and scalar vertex writes, as sub widgets did before
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t pass = 0; pass < GlyphPassCount; ++pass)
+		{
+			MyGUI::VertexQuad* quad = reinterpret_cast<MyGUI::VertexQuad*>(&vertexes[0]);
+			for (size_t index = 0; index < GlyphCount; ++index)
+			{
+				const MyGUI::FloatRect& rect = glyphs[index];
+				float left = ((info.pixScaleX * (rect.left + pass % 2) + info.hOffset) * 2.0f) - 1.0f;
+				float top = -(((info.pixScaleY * rect.top + info.vOffset) * 2.0f) - 1.0f);
+				float right = ((info.pixScaleX * (rect.right + pass % 2) + info.hOffset) * 2.0f) - 1.0f;
+				float bottom = -(((info.pixScaleY * rect.bottom + info.vOffset) * 2.0f) - 1.0f);
+				quad[index].set(left, top, right, bottom, 0.0f, uv.left, uv.top, uv.right, uv.bottom, 0xFFFFFFFF);
+			}
+		}
+		unsigned long result = timer.getMilliseconds();
+		addResult("Glyph vertexes scalar", result, getGlyphRate(total, result));
+
+		timer.reset();
+		for (size_t pass = 0; pass < GlyphPassCount; ++pass)
+		{
+			MyGUI::vertex_utility::QuadBatch batch(&vertexes[0], info, (float)(pass % 2), 0.0f, 0.0f);
+			for (size_t index = 0; index < GlyphCount; ++index)
+				batch.add(glyphs[index], uv, 0xFFFFFFFF);
+			batch.flush();
+		}
+		result = timer.getMilliseconds();
+		addResult(MyGUI::utility::toString("Glyph vertexes QuadBatch ", MyGUI::vertex_utility::getInstructionSet()), result, getGlyphRate(total, result));
+	}
+
+	void DemoKeeper::measureVertexUpload(const std::string& _name)
+	{
+		MyGUI::IRenderTarget* target = dynamic_cast<MyGUI::IRenderTarget*>(MyGUI::RenderManager::getInstancePtr());
+
+		// every frame regenerates and uploads all vertexes
+		MyGUI::vertex_utility::resetUploadStatistics();
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < UploadFrameCount; ++frame)
+		{
+			target->begin();
+			MyGUI::LayerManager::getInstance().renderToTarget(target, true);
+			target->end();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		const MyGUI::vertex_utility::UploadStatistics& statistics = MyGUI::vertex_utility::getUploadStatistics();
+		std::string info = MyGUI::utility::toString(UploadTextCount, " text widgets x ", UploadFrameCount, " frames, ");
+		if (statistics.writtenCount != 0)
+		{
+			size_t written = statistics.writtenCount * sizeof(MyGUI::Vertex) / UploadFrameCount;
+			size_t uploaded = ((statistics.uploadedCount - statistics.compactCount) * sizeof(MyGUI::Vertex) + statistics.compactCount * sizeof(MyGUI::CompactVertex)) / UploadFrameCount;
+			info += MyGUI::utility::toString(written / 1024, " KB per frame as triangle list, ", uploaded / 1024, " KB uploaded (-", 100 - uploaded * 100 / written, "%), ");
+			info += MyGUI::utility::toString(statistics.packedBufferCount, " packed, ", statistics.plainBufferCount, " plain, ", statistics.compactBufferCount, " compact buffers");
+		}
+		else
+		{
+			info += "render system does not pack vertexes";
+		}
+		// other render systems upload through their own buffers, timing says nothing about packing there
+		info += ", meaningful only with OpenGL, OpenGL3 and DirectX render systems";
+		addResult(_name, result, info);
+	}
+
+	void DemoKeeper::benchmarkVertexUpload()
+	{
+		MyGUI::Widget* panel = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+		for (size_t index = 0; index < UploadTextCount; ++index)
+		{
+			MyGUI::TextBox* text = panel->createWidget<MyGUI::TextBox>("TextBox", MyGUI::IntCoord((int)(index % 5) * 200, (int)(index / 5) * 4, 200, 20), MyGUI::Align::Default);
+			text->setCaption(MyGUI::utility::toString("Text line ", index, " with several words"));
+		}
+
+		measureVertexUpload("Text vertex upload");
+
+#ifdef MYGUI_OPENGL3_PLATFORM
+		MyGUI::OpenGL3RenderManager::getInstance().setCompactVertexes(true);
+		measureVertexUpload("Text vertex upload compact");
+		MyGUI::OpenGL3RenderManager::getInstance().setCompactVertexes(false);
+#endif
+
+		MyGUI::Gui::getInstance().destroyWidget(panel);
+	}
+
+	void DemoKeeper::measureWindowDrag(const std::string& _name, MyGUI::Widget* _window)
+	{
+		MyGUI::IRenderTarget* target = dynamic_cast<MyGUI::IRenderTarget*>(MyGUI::RenderManager::getInstancePtr());
+		MyGUI::LayerManager& layers = MyGUI::LayerManager::getInstance();
+
+		target->begin();
+		layers.renderToTarget(target, false);
+		target->end();
+
+		size_t generated = 0;
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < DragFrameCount; ++frame)
+		{
+			_window->setPosition(100 + (int)(frame % 50), 50 + (int)(frame % 30));
+
+			target->begin();
+			layers.renderToTarget(target, false);
+			target->end();
+			generated += layers.getGeneratedVertexCount();
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		std::string info = MyGUI::utility::toString(DragItemCount, " widgets x ", DragFrameCount, " frames, ", generated / DragFrameCount, " vertexes regenerated per frame");
+		if (layers.getNodeTranslation() && !target->isTranslationSupported())
+			info += ", render system does not support translation";
+		addResult(_name, result, info);
+	}
+
+	void DemoKeeper::benchmarkWindowDrag()
+	{
+		MyGUI::Window* window = MyGUI::Gui::getInstance().createWidget<MyGUI::Window>("WindowCS", MyGUI::IntCoord(100, 50, 820, 640), MyGUI::Align::Default, "Overlapped");
+		window->setCaption("Drag");
+		for (size_t index = 0; index < DragItemCount; ++index)
+		{
+			MyGUI::IntCoord coord((int)(index % 20) * 40, (int)(index / 20) * 6, 38, 20);
+			if (index % 2 == 0)
+				window->createWidget<MyGUI::ImageBox>("ImageBox", coord, MyGUI::Align::Default);
+			else
+				window->createWidget<MyGUI::TextBox>("TextBox", coord, MyGUI::Align::Default)->setCaption(MyGUI::utility::toString(index));
+		}
+
+		// window drag moves root widget of overlapped layer node
+		measureWindowDrag("Window drag", window);
+
+		MyGUI::LayerManager::getInstance().setNodeTranslation(true);
+		measureWindowDrag("Window drag translated", window);
+		MyGUI::LayerManager::getInstance().setNodeTranslation(false);
+
+		MyGUI::Gui::getInstance().destroyWidget(window);
+	}
+
+	void DemoKeeper::benchmarkTweens()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::Widget* panel = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+		MyGUI::VectorWidgetPtr items;
+		for (size_t index = 0; index < TweenItemCount; ++index)
+			items.push_back(panel->createWidget<MyGUI::ImageBox>("ImageBox", MyGUI::IntCoord((int)(index % 200) * 5, (int)(index / 200) * 5, 4, 4), MyGUI::Align::Default));
+
+		// every widget fades and moves, animations last longer than measured frames
+		const float time = 2.0f;
+		const float frameTime = 1.0f / TweenFrameCount;
+		std::string info = MyGUI::utility::toString(TweenItemCount * 2, " properties x ", TweenFrameCount, " frames");
+
+		MyGUI::ControllerManager& controllers = MyGUI::ControllerManager::getInstance();
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t index = 0; index < items.size(); ++index)
+		{
+			MyGUI::Widget* item = items[index];
+			item->setAlpha(0.0f);
+
+			MyGUI::ControllerFadeAlpha* fade = controllers.createItem(MyGUI::ControllerFadeAlpha::getClassTypeName())->castType<MyGUI::ControllerFadeAlpha>();
+			fade->setAlpha(1.0f);
+			fade->setCoef(1.0f / time);
+			controllers.addItem(item, fade);
+
+			MyGUI::ControllerPosition* move = controllers.createItem(MyGUI::ControllerPosition::getClassTypeName())->castType<MyGUI::ControllerPosition>();
+			move->setPosition(item->getPosition() + MyGUI::IntPoint(50, 50));
+			move->setTime(time);
+			controllers.addItem(item, move);
+		}
+		addResult("Controllers add", timer.getMilliseconds(), info);
+
+		timer.reset();
+		for (size_t frame = 0; frame < TweenFrameCount; ++frame)
+			gui.frameEvent(frameTime);
+		addResult("Controllers update", timer.getMilliseconds(), info);
+
+		// removed controllers are deleted on next frame
+		timer.reset();
+		for (size_t index = 0; index < items.size(); ++index)
+			controllers.removeItem(items[index]);
+		gui.frameEvent(frameTime);
+		addResult("Controllers remove", timer.getMilliseconds(), info);
+
+		for (size_t index = 0; index < items.size(); ++index)
+			items[index]->setPosition((int)(index % 200) * 5, (int)(index / 200) * 5);
+
+		MyGUI::TweenManager& tweens = MyGUI::TweenManager::getInstance();
+		timer.reset();
+		for (size_t index = 0; index < items.size(); ++index)
+		{
+			MyGUI::Widget* item = items[index];
+			MyGUI::IntPoint point = item->getPosition();
+			tweens.addAlpha(item, 0.0f, 1.0f, time);
+			tweens.addPosition(item, point, point + MyGUI::IntPoint(50, 50), time);
+		}
+		addResult("Tweens add", timer.getMilliseconds(), info);
+
+		timer.reset();
+		for (size_t frame = 0; frame < TweenFrameCount; ++frame)
+			gui.frameEvent(frameTime);
+		addResult("Tweens update", timer.getMilliseconds(), info);
+
+		timer.reset();
+		for (size_t index = 0; index < items.size(); ++index)
+			tweens.removeAllTracks(items[index]);
+		gui.frameEvent(frameTime);
+		addResult("Tweens remove", timer.getMilliseconds(), info);
+
+		gui.destroyWidget(panel);
+	}
+
+	void DemoKeeper::measureLayoutPool(const std::string& _name, const std::string& _layout)
+	{
+		MyGUI::LayoutManager& layouts = MyGUI::LayoutManager::getInstance();
+		layouts.resetLayoutPoolStatistics();
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t cycle = 0; cycle < PoolCycleCount; ++cycle)
+		{
+			MyGUI::VectorWidgetPtr widgets = layouts.loadLayout(_layout);
+			layouts.unloadLayout(widgets);
+		}
+		unsigned long result = timer.getMilliseconds();
+
+		const MyGUI::LayoutManager::LayoutPoolStatistics& statistics = layouts.getLayoutPoolStatistics();
+		size_t loads = statistics.hitCount + statistics.missCount;
+		std::string info = MyGUI::utility::toString(PoolCycleCount, " open/close cycles of ", PoolRowCount * 3 + 1, " widgets, ");
+		if (loads != 0)
+			info += MyGUI::utility::toString(statistics.hitCount * 100 / loads, "% pool hits, ", statistics.releaseCount, " returned to pool");
+		else
+			info += "pool disabled";
+		addResult(_name, result, info);
+	}
+
+	void DemoKeeper::benchmarkLayoutPool()
+	{
+		// dialog with rows of caption, value and button
+		std::string layout = "<MyGUI type=\"Layout\" version=\"3.2.0\">";
+		layout += "<Widget type=\"Window\" skin=\"WindowCS\" position=\"100 100 400 360\" layer=\"Overlapped\" name=\"Dialog\">";
+		layout += "<Property key=\"Caption\" value=\"Dialog\"/>";
+		for (size_t row = 0; row < PoolRowCount; ++row)
+		{
+			layout += MyGUI::utility::toString("<Widget type=\"TextBox\" skin=\"TextBox\" position=\"10 ", row * 30 + 10, " 120 24\"><Property key=\"Caption\" value=\"Row ", row, "\"/></Widget>");
+			layout += MyGUI::utility::toString("<Widget type=\"EditBox\" skin=\"EditBox\" position=\"140 ", row * 30 + 10, " 150 24\"/>");
+			layout += MyGUI::utility::toString("<Widget type=\"Button\" skin=\"Button\" position=\"300 ", row * 30 + 10, " 80 24\"><Property key=\"Caption\" value=\"Apply\"/></Widget>");
+		}
+		layout += "</Widget></MyGUI>";
+
+		MyGUI::xml::Document doc;
+		std::istringstream stream(layout);
+		doc.open(stream);
+		const std::string name = "BenchmarkDialog.layout";
+		MyGUI::ResourceManager::getInstance().addResource(new MyGUI::ResourceLayout(doc.getRoot(), name));
+
+		measureLayoutPool("Layout open/close", name);
+
+		MyGUI::LayoutManager::getInstance().setLayoutPoolSize(name, 1);
+		measureLayoutPool("Layout open/close pooled", name);
+		MyGUI::LayoutManager::getInstance().setLayoutPoolSize(name, 0);
+
+		MyGUI::ResourceManager::getInstance().removeByName(name);
+	}
+
+	void DemoKeeper::measureCompiledLayout(const std::string& _name, MyGUI::ResourceLayout* _layout)
+	{
+		// время только создания, удаление пачками вне замера
+		unsigned long result = 0;
+		MyGUI::Timer timer;
+		for (size_t batch = 0; batch < CompiledInstanceCount / CompiledBatchSize; ++batch)
+		{
+			std::vector<MyGUI::VectorWidgetPtr> instances;
+			timer.reset();
+			for (size_t index = 0; index < CompiledBatchSize; ++index)
+				instances.push_back(_layout->createLayout());
+			result += timer.getMilliseconds();
+
+			for (size_t index = 0; index < instances.size(); ++index)
+				MyGUI::LayoutManager::getInstance().unloadLayout(instances[index]);
+			// удаленные виджеты освобождаются в начале кадра
+			MyGUI::Gui::getInstance().frameEvent(0);
+		}
+
+		addResult(_name, result, MyGUI::utility::toString(CompiledInstanceCount, " instances of ", CompiledRowCount * 3 + 2, " widgets"));
+	}
+
+	void DemoKeeper::benchmarkCompiledLayout()
+	{
+		// panel with rows of caption, button and separator
+		std::string layout = "<MyGUI type=\"Layout\" version=\"3.2.0\">";
+		layout += "<Widget type=\"Widget\" skin=\"PanelEmpty\" position=\"0 0 600 2000\" layer=\"Overlapped\" name=\"Panel\">";
+		layout += "<Widget type=\"Widget\" skin=\"PanelEmpty\" position=\"0 0 600 2000\" align=\"Stretch\" name=\"Client\">";
+		for (size_t row = 0; row < CompiledRowCount; ++row)
+		{
+			layout += MyGUI::utility::toString("<Widget type=\"TextBox\" skin=\"TextBox\" position=\"10 ", row * 30 + 10, " 120 24\" name=\"Caption", row, "\"><Property key=\"Caption\" value=\"Row ", row, "\"/><Property key=\"TextAlign\" value=\"Left VCenter\"/></Widget>");
+			layout += MyGUI::utility::toString("<Widget type=\"Button\" skin=\"Button\" position=\"140 ", row * 30 + 10, " 80 24\" align=\"Right Top\"><Property key=\"Caption\" value=\"Apply\"/><UserString key=\"Row\" value=\"", row, "\"/></Widget>");
+			layout += MyGUI::utility::toString("<Widget type=\"Widget\" skin=\"PanelEmpty\" position_real=\"0 ", (float)(row * 30 + 36) / 2000, " 1 0.001\"><Property key=\"Alpha\" value=\"0.5\"/></Widget>");
+		}
+		layout += "</Widget></Widget></MyGUI>";
+
+		MyGUI::xml::Document doc;
+		std::istringstream stream(layout);
+		doc.open(stream);
+		MyGUI::ResourceLayout* resource = new MyGUI::ResourceLayout(doc.getRoot(), "BenchmarkPanel.layout");
+		MyGUI::ResourceManager::getInstance().addResource(resource);
+
+		measureCompiledLayout("Layout instantiate", resource);
+
+		resource->compile();
+		measureCompiledLayout("Layout instantiate compiled", resource);
+
+		MyGUI::ResourceManager::getInstance().removeByName(resource->getResourceName());
+	}
+
+	void DemoKeeper::benchmarkStringIds()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::Widget* panel = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+		size_t internedCount = MyGUI::StringId::getInternedCount();
+		size_t internedBytes = MyGUI::StringId::getInternedBytes();
+
+		MyGUI::VectorWidgetPtr items;
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t row = 0; row < InternRowCount; ++row)
+		{
+			MyGUI::Widget* line = panel->createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, (int)row * 8, 1000, 8), MyGUI::Align::Default);
+			for (size_t column = 0; column < InternColumnCount; ++column)
+			{
+				MyGUI::Button* item = line->createWidget<MyGUI::Button>("Button", MyGUI::IntCoord((int)column * 5, 0, 4, 4), MyGUI::Align::Default);
+				item->setPointer("hand");
+				item->setUserString("Row", MyGUI::utility::toString(row));
+				item->setUserString("Column", MyGUI::utility::toString(column));
+				items.push_back(item);
+			}
+		}
+		std::string info = MyGUI::utility::toString(items.size(), " buttons, sizeof(Widget) ", sizeof(MyGUI::Widget), ", sizeof(Button) ", sizeof(MyGUI::Button));
+		addResult("Interned names create", timer.getMilliseconds(), info);
+
+		size_t found = 0;
+		timer.reset();
+		for (size_t pass = 0; pass < InternLookupPassCount; ++pass)
+		{
+			for (size_t index = 0; index < items.size(); ++index)
+				found += items[index]->getUserString("Column").size();
+		}
+		addResult("User string lookup", timer.getMilliseconds(), MyGUI::utility::toString(items.size() * InternLookupPassCount, " lookups"));
+
+		MyGUI::StringId key("Column");
+		timer.reset();
+		for (size_t pass = 0; pass < InternLookupPassCount; ++pass)
+		{
+			for (size_t index = 0; index < items.size(); ++index)
+				found += items[index]->getUserString(key).size();
+		}
+		addResult("User string lookup by id", timer.getMilliseconds(), MyGUI::utility::toString(items.size() * InternLookupPassCount, " lookups, ", found, " chars"));
+
+		addResult("Interned strings", 0, MyGUI::utility::toString(MyGUI::StringId::getInternedCount() - internedCount, " new strings, ", MyGUI::StringId::getInternedBytes() - internedBytes, " new bytes"));
+
+		gui.destroyWidget(panel);
+		gui.frameEvent(0);
+	}
+
+	void DemoKeeper::benchmarkWidgetMemory()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::Widget* panel = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t row = 0; row < MemoryRowCount; ++row)
+		{
+			MyGUI::Widget* line = panel->createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, (int)row * 8, 1000, 8), MyGUI::Align::Default);
+			for (size_t column = 0; column < MemoryColumnCount; ++column)
+				line->createWidget<MyGUI::Button>("Button", MyGUI::IntCoord((int)column * 5, 0, 4, 4), MyGUI::Align::Default)->setCaption("OK");
+		}
+		addResult("Buttons create", timer.getMilliseconds(), MyGUI::utility::toString(MemoryRowCount * MemoryColumnCount, " buttons"));
+
+		MyGUI::WidgetManager::MemoryReport report;
+		timer.reset();
+		MyGUI::WidgetManager::getInstance().getMemoryReport(report);
+		unsigned long time = timer.getMilliseconds();
+
+		const MyGUI::WidgetManager::MemoryReport::Item& buttons = report.types[MyGUI::Button::getClassTypeName()];
+		addResult("Memory report", time, MyGUI::utility::toString(report.total.count, " widgets, ", report.total.bytes / 1024, " KB, ", buttons.bytes / std::max(buttons.count, (size_t)1), " bytes per button"));
+		MyGUI::WidgetManager::getInstance().logMemoryReport();
+
+		timer.reset();
+		gui.destroyWidget(panel);
+		gui.frameEvent(0);
+		addResult("Buttons destroy", timer.getMilliseconds(), MyGUI::utility::toString(MemoryRowCount * MemoryColumnCount, " buttons"));
+	}
+
+	void notifyBenchmarkClick(MyGUI::Widget* _sender)
+	{
+	}
+
+	void DemoKeeper::benchmarkWidgetEvents()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		std::string info = MyGUI::utility::toString(EventPassCount, " x ", EventWidgetCount, " widgets, every ", EventSubscribeStep, " subscribed");
+
+		unsigned long createTime = 0;
+		unsigned long invokeTime = 0;
+		unsigned long destroyTime = 0;
+		MyGUI::Timer timer;
+		for (size_t pass = 0; pass < EventPassCount; ++pass)
+		{
+			MyGUI::Widget* panel = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+
+			timer.reset();
+			MyGUI::VectorWidgetPtr items;
+			for (size_t index = 0; index < EventWidgetCount; ++index)
+			{
+				MyGUI::Widget* item = panel->createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord((int)(index % 200) * 5, (int)(index / 200) * 5, 4, 4), MyGUI::Align::Default);
+				if (index % EventSubscribeStep == 0)
+					item->eventMouseButtonClick += MyGUI::newDelegate(notifyBenchmarkClick);
+				items.push_back(item);
+			}
+			createTime += timer.getMilliseconds();
+
+			timer.reset();
+			for (size_t index = 0; index < items.size(); ++index)
+			{
+				items[index]->eventMouseButtonClick(items[index]);
+				items[index]->eventMouseSetFocus(items[index], nullptr);
+			}
+			invokeTime += timer.getMilliseconds();
+
+			timer.reset();
+			gui.destroyWidget(panel);
+			gui.frameEvent(0);
+			destroyTime += timer.getMilliseconds();
+		}
+
+		addResult("Event widgets create", createTime, info);
+		addResult("Event widgets invoke", invokeTime, info);
+		addResult("Event widgets destroy", destroyTime, info);
+		addResult("Widget sizes", 0, MyGUI::utility::toString("Widget ", sizeof(MyGUI::Widget), ", Button ", sizeof(MyGUI::Button), ", EditBox ", sizeof(MyGUI::EditBox), ", Window ", sizeof(MyGUI::Window)));
+	}
+
+	void DemoKeeper::benchmarkTextureBudget()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::TextureMemoryManager& textures = MyGUI::TextureMemoryManager::getInstance();
+		const MyGUI::VectorString& names = MyGUI::DataManager::getInstance().getDataListNames("*.png");
+
+		MyGUI::Widget* panel = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(0, 0, 1000, 800), MyGUI::Align::Default, "Back");
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t index = 0; index < names.size(); ++index)
+			panel->createWidget<MyGUI::ImageBox>("ImageBox", MyGUI::IntCoord((int)(index % 50) * 20, (int)(index / 50) * 20, 16, 16), MyGUI::Align::Default)->setImageTexture(names[index]);
+		addResult("Textures load", timer.getMilliseconds(), MyGUI::utility::toString(textures.getTextureCount(), " textures, ", textures.getUsedBytes() / 1024, " KB"));
+
+		size_t usedBytes = textures.getUsedBytes();
+		size_t evictCount = textures.getEvictCount();
+		textures.setBudget(usedBytes / 2);
+		timer.reset();
+		for (size_t frame = 0; frame < TextureFrameCount; ++frame)
+			gui.frameEvent(0);
+		addResult("Textures evict", timer.getMilliseconds(), MyGUI::utility::toString(textures.getEvictCount() - evictCount, " textures, ", textures.getUsedBytes() / 1024, " KB of ", textures.getBudget() / 1024, " KB budget"));
+
+		size_t reloadCount = textures.getReloadCount();
+		textures.setBudget(0);
+		timer.reset();
+		for (size_t index = 0; index < names.size(); ++index)
+			MyGUI::texture_utility::getTextureSize(names[index], false);
+		addResult("Textures reload", timer.getMilliseconds(), MyGUI::utility::toString(textures.getReloadCount() - reloadCount, " textures, ", textures.getUsedBytes() / 1024, " KB"));
+
+		gui.destroyWidget(panel);
+	}
+
+	MyGUI::IntRect getCanvasTile(size_t _index)
+	{
+		// tiles are spread over the whole texture
+		const int tilesInRow = CanvasSize / CanvasTileSize;
+		int index = (int)(_index * 7919 % (tilesInRow * tilesInRow));
+		int left = index % tilesInRow * CanvasTileSize;
+		int top = index / tilesInRow * CanvasTileSize;
+		return MyGUI::IntRect(left, top, left + CanvasTileSize, top + CanvasTileSize);
+	}
+
+	void fillCanvasTile(MyGUI::uint8* _data, const MyGUI::IntRect& _rect, MyGUI::uint8 _value)
+	{
+		for (int y = _rect.top; y < _rect.bottom; ++y)
+			memset(_data + (y * CanvasSize + _rect.left) * 4, _value, _rect.width() * 4);
+	}
+
+	void DemoKeeper::benchmarkCanvasUpdate()
+	{
+		MyGUI::Canvas* canvas = MyGUI::Gui::getInstance().createWidget<MyGUI::Canvas>("Canvas", MyGUI::IntCoord(0, 0, 512, 512), MyGUI::Align::Default, "Back");
+		canvas->createTexture(CanvasSize, CanvasSize, MyGUI::Canvas::TRM_PT_CONST_SIZE, MyGUI::TextureUsage::Stream | MyGUI::TextureUsage::Write, MyGUI::PixelFormat::R8G8B8A8);
+
+		std::string info = MyGUI::utility::toString(CanvasFrameCount, " frames, ", CanvasTileCount, " tiles of ", CanvasTileSize, " px on ", CanvasSize, " px canvas");
+
+		MyGUI::Timer timer;
+		timer.reset();
+		for (size_t frame = 0; frame < CanvasFrameCount; ++frame)
+		{
+			MyGUI::uint8* data = static_cast<MyGUI::uint8*>(canvas->lock());
+			for (size_t tile = 0; tile < CanvasTileCount; ++tile)
+			{
+				MyGUI::IntRect rect = getCanvasTile(frame * CanvasTileCount + tile);
+				fillCanvasTile(data, rect, (MyGUI::uint8)frame);
+			}
+			canvas->unlock();
+		}
+		addResult("Canvas whole upload", timer.getMilliseconds(), info);
+
+		timer.reset();
+		for (size_t frame = 0; frame < CanvasFrameCount; ++frame)
+		{
+			for (size_t tile = 0; tile < CanvasTileCount; ++tile)
+			{
+				MyGUI::IntRect rect = getCanvasTile(frame * CanvasTileCount + tile);
+				fillCanvasTile(static_cast<MyGUI::uint8*>(canvas->lock(rect)), rect, (MyGUI::uint8)frame);
+				canvas->unlock();
+			}
+		}
+		addResult("Canvas dirty rect upload", timer.getMilliseconds(), info);
+
+		MyGUI::Gui::getInstance().destroyWidget(canvas);
+	}
+
+} // namespace demo
+
+MYGUI_APP(demo::DemoKeeper)
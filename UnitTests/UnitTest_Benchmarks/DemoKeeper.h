@@ -0,0 +1,57 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#ifndef DEMO_KEEPER_H_
+#define DEMO_KEEPER_H_
+
+#include "Base/BaseDemoManager.h"
+
+namespace demo
+{
+
+	class DemoKeeper :
+		public base::BaseDemoManager
+	{
+	public:
+		DemoKeeper();
+
+		virtual void createScene();
+		virtual void destroyScene();
+
+	private:
+		virtual void setupResources();
+
+		void addResult(const std::string& _name, unsigned long _time, const std::string& _info = "");
+
+		void benchmarkHudUpdate();
+		void benchmarkCachedLayer();
+		void benchmarkLogging();
+		void benchmarkScrollView();
+		void benchmarkRichText();
+		void benchmarkTreeControl();
+		void benchmarkTextViewCache();
+		void benchmarkStringConversion();
+		void benchmarkGlyphVertices();
+		void benchmarkVertexUpload();
+		void measureVertexUpload(const std::string& _name);
+		void benchmarkWindowDrag();
+		void measureWindowDrag(const std::string& _name, MyGUI::Widget* _window);
+		void benchmarkTweens();
+		void benchmarkLayoutPool();
+		void measureLayoutPool(const std::string& _name, const std::string& _layout);
+		void benchmarkCompiledLayout();
+		void measureCompiledLayout(const std::string& _name, MyGUI::ResourceLayout* _layout);
+		void benchmarkStringIds();
+		void benchmarkWidgetMemory();
+		void benchmarkWidgetEvents();
+		void benchmarkTextureBudget();
+		void benchmarkCanvasUpdate();
+
+	private:
+		MyGUI::EditBox* mOutput;
+	};
+
+} // namespace demo
+
+#endif // DEMO_KEEPER_H_
@@ -0,0 +1,719 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+// Headless test: frames drawn through FrameSnapshot with one frame latency
+// must produce exactly the same draw calls as single threaded rendering,
+// also when frames are submitted from separate render thread while UI thread
+// recreates, writes and destroys canvas textures.
+
+#include "MyGUI.h"
+#include "MyGUI_FrameSnapshot.h"
+#include "MyGUI_DummyDataManager.h"
+#include <cstdio>
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#	include <windows.h>
+#else
+#	include <pthread.h>
+#endif
+
+namespace test
+{
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+
+	class Mutex
+	{
+	public:
+		Mutex() { InitializeCriticalSection(&mHandle); }
+		~Mutex() { DeleteCriticalSection(&mHandle); }
+		void lock() { EnterCriticalSection(&mHandle); }
+		void unlock() { LeaveCriticalSection(&mHandle); }
+
+	private:
+		CRITICAL_SECTION mHandle;
+	};
+
+	class Event
+	{
+	public:
+		Event() { mHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr); }
+		~Event() { CloseHandle(mHandle); }
+		void signal() { SetEvent(mHandle); }
+		void wait() { WaitForSingleObject(mHandle, INFINITE); }
+
+	private:
+		HANDLE mHandle;
+	};
+
+	class Thread
+	{
+	public:
+		typedef void (*Function)(void*);
+
+		void start(Function _function, void* _data)
+		{
+			mFunction = _function;
+			mData = _data;
+			mHandle = CreateThread(nullptr, 0, entry, this, 0, nullptr);
+		}
+
+		void join()
+		{
+			WaitForSingleObject(mHandle, INFINITE);
+			CloseHandle(mHandle);
+		}
+
+	private:
+		static DWORD WINAPI entry(LPVOID _data)
+		{
+			Thread* thread = static_cast<Thread*>(_data);
+			thread->mFunction(thread->mData);
+			return 0;
+		}
+
+		HANDLE mHandle;
+		Function mFunction;
+		void* mData;
+	};
+
+#else
+
+	class Mutex
+	{
+	public:
+		Mutex() { pthread_mutex_init(&mHandle, nullptr); }
+		~Mutex() { pthread_mutex_destroy(&mHandle); }
+		void lock() { pthread_mutex_lock(&mHandle); }
+		void unlock() { pthread_mutex_unlock(&mHandle); }
+
+	private:
+		pthread_mutex_t mHandle;
+	};
+
+	// auto reset event
+	class Event
+	{
+	public:
+		Event() :
+			mSignaled(false)
+		{
+			pthread_mutex_init(&mMutex, nullptr);
+			pthread_cond_init(&mCondition, nullptr);
+		}
+
+		~Event()
+		{
+			pthread_cond_destroy(&mCondition);
+			pthread_mutex_destroy(&mMutex);
+		}
+
+		void signal()
+		{
+			pthread_mutex_lock(&mMutex);
+			mSignaled = true;
+			pthread_cond_signal(&mCondition);
+			pthread_mutex_unlock(&mMutex);
+		}
+
+		void wait()
+		{
+			pthread_mutex_lock(&mMutex);
+			while (!mSignaled)
+				pthread_cond_wait(&mCondition, &mMutex);
+			mSignaled = false;
+			pthread_mutex_unlock(&mMutex);
+		}
+
+	private:
+		pthread_mutex_t mMutex;
+		pthread_cond_t mCondition;
+		bool mSignaled;
+	};
+
+	class Thread
+	{
+	public:
+		typedef void (*Function)(void*);
+
+		void start(Function _function, void* _data)
+		{
+			mFunction = _function;
+			mData = _data;
+			pthread_create(&mHandle, nullptr, entry, this);
+		}
+
+		void join()
+		{
+			pthread_join(mHandle, nullptr);
+		}
+
+	private:
+		static void* entry(void* _data)
+		{
+			Thread* thread = static_cast<Thread*>(_data);
+			thread->mFunction(thread->mData);
+			return nullptr;
+		}
+
+		pthread_t mHandle;
+		Function mFunction;
+		void* mData;
+	};
+
+#endif
+
+	// guards texture registry and texture lock state, shared by UI and render threads
+	Mutex gTextureMutex;
+
+	// vertex buffer uploads, snapshot modes upload only changed render items
+	size_t gUploadCount = 0;
+
+	class TestVertexBuffer :
+		public MyGUI::IVertexBuffer
+	{
+	public:
+		virtual void setVertexCount(size_t _value)
+		{
+			mVertexes.resize(_value);
+		}
+
+		virtual size_t getVertexCount()
+		{
+			return mVertexes.size();
+		}
+
+		virtual MyGUI::Vertex* lock()
+		{
+			return mVertexes.empty() ? nullptr : &mVertexes[0];
+		}
+
+		virtual void unlock()
+		{
+		}
+
+		virtual void setWrittenVertexCount(size_t _value)
+		{
+			gUploadCount ++;
+		}
+
+	private:
+		MyGUI::VectorVertex mVertexes;
+	};
+
+	class TestTexture :
+		public MyGUI::ITexture
+	{
+	public:
+		explicit TestTexture(const std::string& _name) :
+			mName(_name),
+			mWidth(64),
+			mHeight(64),
+			mManual(false),
+			mLocked(false)
+		{
+		}
+
+		virtual const std::string& getName() const
+		{
+			return mName;
+		}
+
+		virtual void createManual(int _width, int _height, MyGUI::TextureUsage _usage, MyGUI::PixelFormat _format)
+		{
+			mWidth = _width;
+			mHeight = _height;
+			mManual = true;
+			mPixels.assign((size_t)_width * (size_t)_height, 0);
+		}
+
+		virtual void loadFromFile(const std::string& _filename) { }
+		virtual void saveToFile(const std::string& _filename) { }
+		virtual void destroy() { }
+
+		virtual void* lock(MyGUI::TextureUsage _access)
+		{
+			gTextureMutex.lock();
+			mLocked = true;
+			gTextureMutex.unlock();
+			return mPixels.empty() ? nullptr : &mPixels[0];
+		}
+
+		virtual void unlock()
+		{
+			gTextureMutex.lock();
+			mLocked = false;
+			gTextureMutex.unlock();
+		}
+
+		virtual bool isLocked() { return mLocked; }
+		virtual int getWidth() { return mWidth; }
+		virtual int getHeight() { return mHeight; }
+		virtual MyGUI::PixelFormat getFormat() { return MyGUI::PixelFormat::R8G8B8A8; }
+		virtual MyGUI::TextureUsage getUsage() { return MyGUI::TextureUsage::Default; }
+		virtual size_t getNumElemBytes() { return 4; }
+
+		// canvas names differ between runs, manual textures are described by content
+		std::string describe() const
+		{
+			if (!mManual)
+				return mName;
+			return MyGUI::utility::toString("manual ", mWidth, "x", mHeight, " ", mPixels[0], " ", mPixels.back());
+		}
+
+	private:
+		std::string mName;
+		int mWidth;
+		int mHeight;
+		bool mManual;
+		bool mLocked;
+		std::vector<MyGUI::uint32> mPixels;
+	};
+
+	// render manager that prints every draw call instead of drawing
+	class TestRenderManager :
+		public MyGUI::RenderManager,
+		public MyGUI::IRenderTarget
+	{
+	public:
+		TestRenderManager() :
+			mViewSize(800, 600),
+			mRendering(nullptr),
+			mSceneUpdated(nullptr),
+			mPaused(false)
+		{
+			mInfo.pixScaleX = 1.0f / float(mViewSize.width);
+			mInfo.pixScaleY = 1.0f / float(mViewSize.height);
+		}
+
+		~TestRenderManager()
+		{
+			for (MapTexture::iterator iter = mTextures.begin(); iter != mTextures.end(); ++iter)
+				delete (*iter).second;
+		}
+
+		virtual MyGUI::IVertexBuffer* createVertexBuffer()
+		{
+			return new TestVertexBuffer();
+		}
+
+		virtual void destroyVertexBuffer(MyGUI::IVertexBuffer* _buffer)
+		{
+			delete _buffer;
+		}
+
+		virtual MyGUI::ITexture* createTexture(const std::string& _name)
+		{
+			TestTexture* texture = new TestTexture(_name);
+			gTextureMutex.lock();
+			if (mTextures.find(_name) != mTextures.end())
+				mErrors.push_back("texture " + _name + " already exist");
+			mTextures[_name] = texture;
+			gTextureMutex.unlock();
+			return texture;
+		}
+
+		virtual void destroyTexture(MyGUI::ITexture* _texture)
+		{
+			gTextureMutex.lock();
+			mTextures.erase(_texture->getName());
+			gTextureMutex.unlock();
+			delete _texture;
+		}
+
+		virtual MyGUI::ITexture* getTexture(const std::string& _name)
+		{
+			gTextureMutex.lock();
+			MapTexture::iterator item = mTextures.find(_name);
+			MyGUI::ITexture* result = item != mTextures.end() ? (*item).second : nullptr;
+			gTextureMutex.unlock();
+			return result;
+		}
+
+		virtual const MyGUI::IntSize& getViewSize() const
+		{
+			return mViewSize;
+		}
+
+		virtual MyGUI::VertexColourType getVertexFormat()
+		{
+			return MyGUI::VertexColourType::ColourARGB;
+		}
+
+		virtual void begin() { }
+		virtual void end() { }
+
+		virtual void doRender(MyGUI::IVertexBuffer* _buffer, MyGUI::ITexture* _texture, size_t _count)
+		{
+			// let UI thread update scene while rest of frame is drawn
+			if (mPaused)
+			{
+				mPaused = false;
+				mRendering->signal();
+				mSceneUpdated->wait();
+			}
+
+			std::string texture;
+			gTextureMutex.lock();
+			if (!isAlive(_texture))
+				mErrors.push_back("destroyed texture is drawn");
+			else if (_texture->isLocked())
+				mErrors.push_back("locked texture " + _texture->getName() + " is drawn");
+			else
+				texture = static_cast<TestTexture*>(_texture)->describe();
+			gTextureMutex.unlock();
+
+			MyGUI::Vertex* vertex = _buffer->lock();
+			mOutput += MyGUI::utility::toString(texture, " ", _count, "\n");
+			for (size_t index = 0; index < _count; ++index)
+				mOutput += MyGUI::utility::toString(vertex[index].x, " ", vertex[index].y, " ", vertex[index].u, " ", vertex[index].v, " ", vertex[index].colour) + "\n";
+			_buffer->unlock();
+		}
+
+		virtual const MyGUI::RenderTargetInfo& getInfo()
+		{
+			return mInfo;
+		}
+
+		void renderFrame()
+		{
+			onRenderToTarget(this, false);
+		}
+
+		std::string takeOutput()
+		{
+			std::string result;
+			std::swap(result, mOutput);
+			return result;
+		}
+
+		// next submit stops after first draw call until scene is updated
+		void pauseNextFrame(Event* _rendering, Event* _sceneUpdated)
+		{
+			mRendering = _rendering;
+			mSceneUpdated = _sceneUpdated;
+			mPaused = true;
+		}
+
+		const MyGUI::VectorString& getErrors() const
+		{
+			return mErrors;
+		}
+
+	private:
+		bool isAlive(MyGUI::ITexture* _texture) const
+		{
+			for (MapTexture::const_iterator iter = mTextures.begin(); iter != mTextures.end(); ++iter)
+			{
+				if ((*iter).second == _texture)
+					return true;
+			}
+			return false;
+		}
+
+	private:
+		MyGUI::IntSize mViewSize;
+		MyGUI::RenderTargetInfo mInfo;
+		typedef std::map<std::string, MyGUI::ITexture*> MapTexture;
+		MapTexture mTextures;
+		std::string mOutput;
+		MyGUI::VectorString mErrors;
+		Event* mRendering;
+		Event* mSceneUpdated;
+		bool mPaused;
+	};
+
+	const char* SkinXml =
+		"<MyGUI type=\"Resource\" version=\"1.1\">"
+		"  <Resource type=\"ResourceSkin\" name=\"TestSkin\" size=\"16 16\" texture=\"test.png\">"
+		"    <BasisSkin type=\"SubSkin\" offset=\"0 0 16 16\" align=\"Stretch\">"
+		"      <State name=\"normal\" offset=\"0 0 16 16\"/>"
+		"    </BasisSkin>"
+		"  </Resource>"
+		"</MyGUI>";
+
+	const size_t FrameCount = 40;
+	const size_t WidgetCount = 50;
+
+	enum Mode
+	{
+		SingleThread,
+		Snapshot,
+		RenderThread
+	};
+
+	struct Scene
+	{
+		Scene() : canvas(nullptr) { }
+		MyGUI::VectorWidgetPtr widgets;
+		MyGUI::Canvas* canvas;
+	};
+
+	void createCanvas(Scene& _scene)
+	{
+		_scene.canvas = _scene.widgets[0]->createWidget<MyGUI::Canvas>("TestSkin", MyGUI::IntCoord(300, 300, 32, 32), MyGUI::Align::Default);
+		_scene.canvas->createTexture(MyGUI::Canvas::TRM_PT_CONST_SIZE);
+	}
+
+	void fillCanvas(MyGUI::Canvas* _canvas, size_t _frame)
+	{
+		MyGUI::uint32 value = (MyGUI::uint32)_frame;
+		if (_frame % 3 == 0)
+		{
+			// region write keeps the rest of texture
+			MyGUI::uint32* data = static_cast<MyGUI::uint32*>(_canvas->lock(MyGUI::IntRect(0, 0, 4, 4)));
+			for (int y = 0; y < 4; ++y)
+				for (int x = 0; x < 4; ++x)
+					data[y * _canvas->getTextureRealWidth() + x] = value * 100;
+		}
+		else
+		{
+			MyGUI::uint32* data = static_cast<MyGUI::uint32*>(_canvas->lock());
+			size_t count = (size_t)_canvas->getTextureRealWidth() * (size_t)_canvas->getTextureRealHeight();
+			for (size_t index = 0; index < count; ++index)
+				data[index] = value;
+		}
+		_canvas->unlock();
+	}
+
+	void updateScene(Scene& _scene, size_t _frame)
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::VectorWidgetPtr& widgets = _scene.widgets;
+
+		if (_frame == 0)
+		{
+			MyGUI::Widget* parent = gui.createWidget<MyGUI::Widget>("TestSkin", MyGUI::IntCoord(0, 0, 400, 400), MyGUI::Align::Default, "Main");
+			widgets.push_back(parent);
+			for (size_t index = 0; index < WidgetCount; ++index)
+				widgets.push_back(parent->createWidget<MyGUI::Widget>("TestSkin", MyGUI::IntCoord((int)index * 5, (int)index * 3, 16, 16), MyGUI::Align::Default));
+			createCanvas(_scene);
+			fillCanvas(_scene.canvas, _frame);
+			return;
+		}
+
+		for (size_t index = 1; index < widgets.size(); ++index)
+		{
+			if ((index + _frame) % 3 == 0)
+				widgets[index]->setPosition((int)(index * 5 + _frame), (int)(index * 3));
+			if ((index + _frame) % 7 == 0)
+				widgets[index]->setAlpha((float)(_frame % 4) / 4.0f);
+		}
+
+		if (_frame % 5 == 0)
+			widgets.push_back(widgets[0]->createWidget<MyGUI::Widget>("TestSkin", MyGUI::IntCoord((int)_frame * 10, 100, 32, 8), MyGUI::Align::Default));
+		if (_frame % 6 == 0)
+		{
+			gui.destroyWidget(widgets.back());
+			widgets.pop_back();
+		}
+
+		// texture of previous frame is destroyed or recreated while it can be drawn
+		if (_frame % 9 == 0)
+		{
+			gui.destroyWidget(_scene.canvas);
+			createCanvas(_scene);
+		}
+		else if (_frame % 4 == 2)
+		{
+			_scene.canvas->createTexture(32 + (int)(_frame % 3), 32, MyGUI::Canvas::TRM_PT_CONST_SIZE);
+		}
+		fillCanvas(_scene.canvas, _frame);
+	}
+
+	void renderThreadEntry(void* _data);
+
+	struct RenderThreadData
+	{
+		RenderThreadData() : snapshot(nullptr), render(nullptr), quit(false) { }
+		MyGUI::FrameSnapshot* snapshot;
+		TestRenderManager* render;
+		Event start;
+		Event done;
+		bool quit;
+	};
+
+	void renderThreadEntry(void* _data)
+	{
+		RenderThreadData* data = static_cast<RenderThreadData*>(_data);
+		while (true)
+		{
+			data->start.wait();
+			if (data->quit)
+				break;
+			data->snapshot->submit(data->render);
+			data->done.signal();
+		}
+
+		// render system buffers belong to render thread
+		delete data->snapshot;
+		data->snapshot = nullptr;
+		data->done.signal();
+	}
+
+	MyGUI::VectorString drawFrames(Mode _mode, MyGUI::VectorString& _errors, size_t& _uploads)
+	{
+		MyGUI::LogManager* log = new MyGUI::LogManager();
+		TestRenderManager* render = new TestRenderManager();
+		MyGUI::DummyDataManager* data = new MyGUI::DummyDataManager();
+		data->initialise();
+
+		render->setFrameSnapshotMode(_mode != SingleThread);
+
+		MyGUI::Gui* gui = new MyGUI::Gui();
+		gui->initialise("");
+
+		MyGUI::LayerManager::getInstance().createLayerAt("Main", "OverlappedLayer", 0);
+
+		MyGUI::xml::Document doc;
+		std::istringstream stream(SkinXml);
+		doc.open(stream);
+		MyGUI::ResourceManager::getInstance().loadFromXmlNode(doc.getRoot(), "", MyGUI::Version(1, 1, 0));
+
+		MyGUI::VectorString result;
+		Scene scene;
+		gUploadCount = 0;
+		if (_mode == SingleThread)
+		{
+			for (size_t frame = 0; frame < FrameCount; ++frame)
+			{
+				updateScene(scene, frame);
+				render->renderFrame();
+				result.push_back(render->takeOutput());
+			}
+		}
+		else if (_mode == Snapshot)
+		{
+			MyGUI::FrameSnapshot* snapshot = new MyGUI::FrameSnapshot();
+
+			updateScene(scene, 0);
+			snapshot->capture(render, false);
+			snapshot->swap();
+
+			// frame N is captured before frame N-1 is submitted, as with separate render thread
+			for (size_t frame = 1; frame < FrameCount; ++frame)
+			{
+				updateScene(scene, frame);
+				snapshot->capture(render, false);
+				snapshot->submit(render);
+				result.push_back(render->takeOutput());
+				snapshot->swap();
+			}
+
+			snapshot->submit(render);
+			result.push_back(render->takeOutput());
+
+			delete snapshot;
+		}
+		else
+		{
+			RenderThreadData thread;
+			thread.snapshot = new MyGUI::FrameSnapshot();
+			thread.render = render;
+			Event rendering;
+			Event sceneUpdated;
+
+			Thread renderThread;
+			renderThread.start(renderThreadEntry, &thread);
+
+			updateScene(scene, 0);
+			thread.snapshot->capture(render, false);
+			thread.snapshot->swap();
+
+			for (size_t frame = 1; frame < FrameCount; ++frame)
+			{
+				// UI thread updates and captures frame N in the middle of frame N-1 submit
+				render->pauseNextFrame(&rendering, &sceneUpdated);
+				thread.start.signal();
+				rendering.wait();
+
+				updateScene(scene, frame);
+				thread.snapshot->capture(render, false);
+
+				sceneUpdated.signal();
+				thread.done.wait();
+
+				result.push_back(render->takeOutput());
+				thread.snapshot->swap();
+			}
+
+			thread.start.signal();
+			thread.done.wait();
+			result.push_back(render->takeOutput());
+
+			thread.quit = true;
+			thread.start.signal();
+			thread.done.wait();
+			renderThread.join();
+		}
+
+		_errors.insert(_errors.end(), render->getErrors().begin(), render->getErrors().end());
+		_uploads = gUploadCount;
+
+		gui->shutdown();
+		delete gui;
+		data->shutdown();
+		delete data;
+		delete render;
+		delete log;
+
+		return result;
+	}
+
+	bool compareFrames(const MyGUI::VectorString& _single, const MyGUI::VectorString& _frames, const char* _name)
+	{
+		if (_single.size() != _frames.size())
+		{
+			printf("FAILED: %d frames drawn in single thread mode and %d in %s mode\n", (int)_single.size(), (int)_frames.size(), _name);
+			return false;
+		}
+
+		for (size_t index = 0; index < _single.size(); ++index)
+		{
+			if (_single[index].empty())
+			{
+				printf("FAILED: frame %d is empty\n", (int)index);
+				return false;
+			}
+			if (_single[index] != _frames[index])
+			{
+				printf("FAILED: frame %d differs in %s mode\n", (int)index, _name);
+				return false;
+			}
+		}
+		return true;
+	}
+
+} // namespace test
+
+int main()
+{
+	MyGUI::VectorString errors;
+	size_t singleUploads = 0;
+	size_t snapshotUploads = 0;
+	size_t threadedUploads = 0;
+	MyGUI::VectorString single = test::drawFrames(test::SingleThread, errors, singleUploads);
+	MyGUI::VectorString snapshot = test::drawFrames(test::Snapshot, errors, snapshotUploads);
+	MyGUI::VectorString threaded = test::drawFrames(test::RenderThread, errors, threadedUploads);
+
+	if (!errors.empty())
+	{
+		printf("FAILED: %s\n", errors.front().c_str());
+		return 1;
+	}
+
+	if (!test::compareFrames(single, snapshot, "snapshot") || !test::compareFrames(single, threaded, "render thread"))
+		return 1;
+
+	if (snapshotUploads > singleUploads || threadedUploads > singleUploads)
+	{
+		printf("FAILED: %d vertex uploads in single thread mode, %d in snapshot mode and %d in render thread mode\n",
+			(int)singleUploads, (int)snapshotUploads, (int)threadedUploads);
+		return 1;
+	}
+
+	printf("PASSED: %d frames are identical\n", (int)single.size());
+	return 0;
+}
@@ -0,0 +1,162 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+// Headless test: layout loaded over several frames must create exactly the same
+// widget tree as synchronous loading, with root widgets hidden until completion.
+
+#include "MyGUI.h"
+#include "MyGUI_DummyPlatform.h"
+#include <cstdio>
+
+namespace test
+{
+
+	const size_t PanelCount = 20;
+	const size_t ItemCount = 5;
+
+	std::string createLayoutXml()
+	{
+		std::string result = "<MyGUI type=\"Layout\" version=\"3.2.0\">";
+		result += "<Widget type=\"Widget\" skin=\"Default\" position=\"10 10 600 400\" layer=\"Main\" name=\"Root\">";
+		result += "<Property key=\"Alpha\" value=\"0.5\"/><UserString key=\"Kind\" value=\"root\"/>";
+		for (size_t panel = 0; panel < PanelCount; ++panel)
+		{
+			result += MyGUI::utility::toString("<Widget type=\"Widget\" skin=\"Default\" position_real=\"0 ", (float)panel / PanelCount, " 1 0.05\" name=\"Panel", panel, "\">");
+			if (panel % 3 == 0)
+				result += "<Property key=\"Visible\" value=\"false\"/>";
+			for (size_t item = 0; item < ItemCount; ++item)
+				result += MyGUI::utility::toString("<Widget type=\"", item % 2 ? "Button" : "ImageBox", "\" skin=\"Default\" position=\"", item * 20, " 0 18 18\" align=\"Right Top\"><UserString key=\"Index\" value=\"", item, "\"/></Widget>");
+			result += "</Widget>";
+		}
+		result += "</Widget>";
+		result += "<Widget type=\"Widget\" skin=\"Default\" position=\"0 0 10 10\" layer=\"Main\" name=\"Hidden\"><Property key=\"Visible\" value=\"false\"/></Widget>";
+		result += "</MyGUI>";
+		return result;
+	}
+
+	void dumpWidget(MyGUI::Widget* _widget, size_t _depth, std::string& _result)
+	{
+		_result += std::string(_depth, ' ') + MyGUI::utility::toString(_widget->getTypeName(), " '", _widget->getName(), "' ", _widget->getCoord().print(), " ", _widget->getAbsoluteCoord().print());
+		_result += MyGUI::utility::toString(" visible=", _widget->getVisible(), " alpha=", _widget->getAlpha());
+		const MyGUI::MapString& strings = _widget->getUserStrings();
+		for (MyGUI::MapString::const_iterator item = strings.begin(); item != strings.end(); ++item)
+			_result += " " + item->first + "=" + item->second;
+		_result += "\n";
+
+		for (size_t index = 0; index < _widget->getChildCount(); ++index)
+			dumpWidget(_widget->getChildAt(index), _depth + 1, _result);
+	}
+
+	std::string dumpWidgets(const MyGUI::VectorWidgetPtr& _widgets)
+	{
+		std::string result;
+		for (size_t index = 0; index < _widgets.size(); ++index)
+			dumpWidget(_widgets[index], 0, result);
+		return result;
+	}
+
+	size_t gLoadedHandle = 0;
+	MyGUI::VectorWidgetPtr gLoadedWidgets;
+
+	void notifyLayoutLoaded(size_t _handle, const MyGUI::VectorWidgetPtr& _widgets)
+	{
+		gLoadedHandle = _handle;
+		gLoadedWidgets = _widgets;
+	}
+
+	int run()
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		MyGUI::LayoutManager& manager = MyGUI::LayoutManager::getInstance();
+
+		MyGUI::xml::Document doc;
+		std::istringstream stream(createLayoutXml());
+		doc.open(stream);
+		MyGUI::ResourceManager::getInstance().addResource(new MyGUI::ResourceLayout(doc.getRoot(), "test.layout"));
+
+		MyGUI::Widget* parent = gui.createWidget<MyGUI::Widget>("Default", MyGUI::IntCoord(0, 0, 800, 600), MyGUI::Align::Default, "Main");
+
+		MyGUI::VectorWidgetPtr widgets = manager.loadLayout("test.layout", "P_", parent);
+		std::string expected = dumpWidgets(widgets);
+		manager.unloadLayout(widgets);
+
+		manager.eventLayoutLoaded += MyGUI::newDelegate(notifyLayoutLoaded);
+		manager.setLoadingFrameBudget(0);
+
+		size_t handle = manager.loadLayoutIncremental("test.layout", "P_", parent);
+		if (handle == 0)
+		{
+			printf("FAILED: layout is not loaded\n");
+			return 1;
+		}
+
+		size_t frames = 0;
+		while (manager.isLayoutLoading(handle))
+		{
+			gui.frameEvent(0.01f);
+			frames ++;
+
+			MyGUI::Widget* root = gui.findWidgetT("P_Root");
+			if (manager.isLayoutLoading(handle) && root != nullptr && root->getVisible())
+			{
+				printf("FAILED: root widget is visible before loading is complete\n");
+				return 1;
+			}
+		}
+
+		if (gLoadedHandle != handle)
+		{
+			printf("FAILED: eventLayoutLoaded is not called\n");
+			return 1;
+		}
+
+		std::string result = dumpWidgets(gLoadedWidgets);
+		if (result != expected)
+		{
+			printf("FAILED: incremental layout differs\n--- synchronous\n%s--- incremental\n%s", expected.c_str(), result.c_str());
+			return 1;
+		}
+		manager.unloadLayout(gLoadedWidgets);
+
+		// destroyed root stops creating its children, cancel destroys the rest
+		handle = manager.loadLayoutIncremental("test.layout", "P_", parent);
+		for (size_t frame = 0; frame < 10; ++frame)
+			gui.frameEvent(0.01f);
+		gui.destroyWidget(gui.findWidgetT("P_Root"));
+		gui.frameEvent(0.01f);
+		manager.cancelLayoutLoading(handle);
+		if (manager.isLayoutLoading(handle) || parent->getChildCount() != 0)
+		{
+			printf("FAILED: cancelled loading left %d widgets\n", (int)parent->getChildCount());
+			return 1;
+		}
+
+		gui.destroyWidget(parent);
+
+		printf("PASSED: %d widgets loaded in %d frames\n", (int)(PanelCount * (ItemCount + 1) + 2), (int)frames);
+		return 0;
+	}
+
+} // namespace test
+
+int main()
+{
+	MyGUI::DummyPlatform* platform = new MyGUI::DummyPlatform();
+	platform->initialise("");
+	platform->getRenderManagerPtr()->setViewSize(1024, 768);
+
+	MyGUI::Gui* gui = new MyGUI::Gui();
+	gui->initialise("");
+	MyGUI::LayerManager::getInstance().createLayerAt("Main", "OverlappedLayer", 0);
+
+	int result = test::run();
+
+	gui->shutdown();
+	delete gui;
+	platform->shutdown();
+	delete platform;
+
+	return result;
+}
@@ -7,8 +7,6 @@
 #include "Base/Main.h"
 
 #include "BaseLayout/BaseLayout.h"
-#include "TreeControl.h"
-#include "TreeControlItem.h"
 
 #include "FileSystemInfo/FileSystemInfo.h"
 
@@ -217,10 +215,6 @@ namespace demo
 	void DemoKeeper::createScene()
 	{
 		base::BaseDemoManager::createScene();
-		MyGUI::FactoryManager& factory = MyGUI::FactoryManager::getInstance();
-		std::string widgetCategory = MyGUI::WidgetManager::getInstance().getCategoryName();
-		factory.registerFactory<MyGUI::TreeControl>(widgetCategory);
-		factory.registerFactory<MyGUI::TreeControlItem>(widgetCategory);
 
 		MyGUI::ResourceManager::getInstance().load("FrameworkFonts.xml");
 		MyGUI::ResourceManager::getInstance().load("TreeControlSkin.xml");
@@ -233,11 +227,6 @@ namespace demo
 	{
 		delete mSampleLayout;
 		mSampleLayout = nullptr;
-
-		MyGUI::FactoryManager& factory = MyGUI::FactoryManager::getInstance();
-		std::string widgetCategory = MyGUI::WidgetManager::getInstance().getCategoryName();
-		factory.unregisterFactory<MyGUI::TreeControl>(widgetCategory);
-		factory.unregisterFactory<MyGUI::TreeControlItem>(widgetCategory);
 	}
 } // namespace demo
 
@@ -22,16 +22,19 @@ namespace Export
 			Convert<size_t&>::Type _layerId,
 			Convert<bool&>::Type _change)
 		{
-			MyGUI::RenderBatchInfo* info = MyGUI::ExportRenderManager::getInstance().getBatchInfo(_index);
+			const MyGUI::DrawCommand* info = MyGUI::ExportRenderManager::getInstance().getBatchInfo(_index);
 			if (info == nullptr)
 				return false;
 
-			_buffer = info->Buffer->lock();
-			_countVertex = info->Count;
-			_vertexId = info->Buffer->getId();
-			_textureId = info->Texture->getId();
-			_layerId = (size_t)info->Layer;
-			_change = info->Buffer->getChange();
+			MyGUI::ExportVertexBuffer* buffer = static_cast<MyGUI::ExportVertexBuffer*>(info->buffer);
+			MyGUI::ExportTexture* texture = static_cast<MyGUI::ExportTexture*>(info->texture);
+
+			_buffer = buffer->lock();
+			_countVertex = info->count;
+			_vertexId = buffer->getId();
+			_textureId = texture->getId();
+			_layerId = (size_t)info->layer;
+			_change = buffer->getChange();
 
 			return true;
 		}
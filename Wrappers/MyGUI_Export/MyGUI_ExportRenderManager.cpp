@@ -24,9 +24,9 @@ namespace MyGUI
 	}
 
 	ExportRenderManager::ExportRenderManager() :
-		mUpdate(false),
-		mCurrentLayer(nullptr)
+		mUpdate(false)
 	{
+		mDrawList.setTarget(this);
 	}
 
 	void ExportRenderManager::initialise()
@@ -43,7 +43,7 @@ namespace MyGUI
 		MYGUI_PLATFORM_LOG(Info, "* Shutdown: " << getClassTypeName());
 
 		destroyAllTextures();
-		mBatchInfo.clear();
+		mDrawList.clear();
 		mExportVertexBuffer.clear();
 
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully shutdown");
@@ -70,10 +70,7 @@ namespace MyGUI
 		if (_texture == nullptr || _buffer == nullptr || _count == 0)
 			return;
 
-		ExportTexture* texture = static_cast<ExportTexture*>(_texture);
-		ExportVertexBuffer* vertexes = static_cast<ExportVertexBuffer*>(_buffer);
-
-		mBatchInfo.push_back(RenderBatchInfo(vertexes, texture, _count, mCurrentLayer));
+		mDrawList.doRender(_buffer, _texture, _count);
 	}
 
 	void ExportRenderManager::drawOneFrame()
@@ -100,7 +97,7 @@ namespace MyGUI
 
 	void ExportRenderManager::begin()
 	{
-		mBatchInfo.clear();
+		mDrawList.clear();
 
 		for (VectorExportVertexBuffer::iterator item = mExportVertexBuffer.begin(); item != mExportVertexBuffer.end(); item ++)
 			(*item)->setChange(false);
@@ -185,10 +182,10 @@ namespace MyGUI
 		return VertexColourType::ColourARGB;
 	}
 
-	RenderBatchInfo* ExportRenderManager::getBatchInfo(size_t _index)
+	const DrawCommand* ExportRenderManager::getBatchInfo(size_t _index) const
 	{
-		if (_index < mBatchInfo.size())
-			return &mBatchInfo[_index];
+		if (_index < mDrawList.getCommandCount())
+			return &mDrawList.getCommandAt(_index);
 		return nullptr;
 	}
 
@@ -204,7 +201,7 @@ namespace MyGUI
 
 	void ExportRenderManager::doRenderLayer(ILayer* _layer)
 	{
-		mCurrentLayer = _layer;
+		mDrawList.setCurrentLayer(_layer);
 	}
 
 }
@@ -12,7 +12,7 @@
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_ExportTexture.h"
 #include "MyGUI_ExportVertexBuffer.h"
-#include "RenderBatchInfo.h"
+#include "MyGUI_DrawList.h"
 
 namespace MyGUI
 {
@@ -66,7 +66,7 @@ namespace MyGUI
 		void drawOneFrame();
 		void setViewSize(int _width, int _height);
 
-		RenderBatchInfo* getBatchInfo(size_t _index);
+		const DrawCommand* getBatchInfo(size_t _index) const;
 		void addTexture(const std::string& _name, size_t _id, int _width, int _height);
 
 		void doRenderLayer(ILayer* _layer);
@@ -80,11 +80,9 @@ namespace MyGUI
 		typedef std::map<std::string, ExportTexture*> MapTexture;
 		MapTexture mTextures;
 		bool mUpdate;
-		typedef std::vector<RenderBatchInfo> VectorBatchInfo;
-		VectorBatchInfo mBatchInfo;
+		DrawList mDrawList;
 		typedef std::vector<ExportVertexBuffer*> VectorExportVertexBuffer;
 		VectorExportVertexBuffer mExportVertexBuffer;
-		ILayer* mCurrentLayer;
 	};
 
 }
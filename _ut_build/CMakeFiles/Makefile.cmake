@@ -0,0 +1,167 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/CMakeLists.txt"
+  "/root/repo/CMake/ConfigureBuild.cmake"
+  "/root/repo/CMake/Dependencies.cmake"
+  "/root/repo/CMake/InstallResources.cmake"
+  "/root/repo/CMake/Packages/FindFreetype.cmake"
+  "/root/repo/CMake/Packages/FindOIS.cmake"
+  "/root/repo/CMake/Packaging.cmake"
+  "/root/repo/CMake/Templates/MYGUI.pc.in"
+  "/root/repo/CMake/Templates/resources.xml.in"
+  "/root/repo/CMake/Utils/FindPkgMacros.cmake"
+  "/root/repo/CMake/Utils/MacroLogFeature.cmake"
+  "/root/repo/CMake/Utils/MyGUIConfigTargets.cmake"
+  "/root/repo/CMake/Utils/MyGUIGetVersion.cmake"
+  "/root/repo/CMake/Utils/PrecompiledHeader.cmake"
+  "/root/repo/CMake/Utils/PreprocessorUtils.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Common/CMakeLists.txt"
+  "/root/repo/MyGUIEngine/CMakeLists.txt"
+  "/root/repo/MyGUIEngine/MyGUIEngine.list"
+  "/root/repo/Platforms/CMakeLists.txt"
+  "/root/repo/Platforms/Dummy/DummyPlatform/CMakeLists.txt"
+  "/root/repo/Platforms/Dummy/DummyPlatform/MyGUI.DummyPlatform.list"
+  "/root/repo/Plugins/CMakeLists.txt"
+  "/root/repo/Plugins/Plugin_StrangeButton/CMakeLists.txt"
+  "/root/repo/Plugins/Plugin_StrangeButton/Plugin_StrangeButton.list"
+  "/root/repo/UnitTests/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_AttachDetach/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_AttachDetach/UnitTest_AttachDetach.list"
+  "/root/repo/UnitTests/UnitTest_BatchedUpdate/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_Benchmarks/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_Benchmarks/UnitTest_Benchmarks.list"
+  "/root/repo/UnitTests/UnitTest_ChildAttach/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_ChildAttach/UnitTest_ChildAttach.list"
+  "/root/repo/UnitTests/UnitTest_Delegates/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_Delegates/UnitTest_Delegates.list"
+  "/root/repo/UnitTests/UnitTest_FrameSnapshot/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_HyperTextBox/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_HyperTextBox/UnitTest_HyperTextBox.list"
+  "/root/repo/UnitTests/UnitTest_IncrementalLayout/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_ItemBox_Info/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_ItemBox_Info/UnitTest_ItemBox_Info.list"
+  "/root/repo/UnitTests/UnitTest_Layers/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_Layers/UnitTest_Layers.list"
+  "/root/repo/UnitTests/UnitTest_MultiList/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_MultiList/UnitTest_MultiList.list"
+  "/root/repo/UnitTests/UnitTest_RTTLayer/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_RTTLayer/UnitTest_RTTLayer.list"
+  "/root/repo/UnitTests/UnitTest_RotatingSkin/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_RotatingSkin/UnitTest_RotatingSkin.list"
+  "/root/repo/UnitTests/UnitTest_Spline/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_Spline/UnitTest_Spline.list"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/UnitTest_TextureAnimations.list"
+  "/root/repo/UnitTests/UnitTest_TreeControl/CMakeLists.txt"
+  "/root/repo/UnitTests/UnitTest_TreeControl/UnitTest_TreeControl.list"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFontconfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindX11.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "pkgconfig/MYGUI.pc"
+  "bin/resources.xml"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "MyGUIEngine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Platforms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Platforms/Dummy/DummyPlatform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Plugins/Plugin_StrangeButton/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_AttachDetach/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_BatchedUpdate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_Benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_ChildAttach/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_Delegates/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_FrameSnapshot/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_HyperTextBox/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_IncrementalLayout/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_ItemBox_Info/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_Layers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_MultiList/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_RotatingSkin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_RTTLayer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_Spline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_TextureAnimations/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/UnitTest_TreeControl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMake/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/DependInfo.cmake"
+  "Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/DependInfo.cmake"
+  "Common/CMakeFiles/Common.dir/DependInfo.cmake"
+  "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_AttachDetach/CMakeFiles/UnitTest_AttachDetach.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_BatchedUpdate/CMakeFiles/UnitTest_BatchedUpdate.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_Benchmarks/CMakeFiles/UnitTest_Benchmarks.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_ChildAttach/CMakeFiles/UnitTest_ChildAttach.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_Delegates/CMakeFiles/UnitTest_Delegates.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_FrameSnapshot/CMakeFiles/UnitTest_FrameSnapshot.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_HyperTextBox/CMakeFiles/UnitTest_HyperTextBox.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_IncrementalLayout/CMakeFiles/UnitTest_IncrementalLayout.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_ItemBox_Info/CMakeFiles/UnitTest_ItemBox_Info.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_Layers/CMakeFiles/UnitTest_Layers.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_MultiList/CMakeFiles/UnitTest_MultiList.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_RotatingSkin/CMakeFiles/UnitTest_RotatingSkin.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_RTTLayer/CMakeFiles/UnitTest_RTTLayer.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_Spline/CMakeFiles/UnitTest_Spline.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/DependInfo.cmake"
+  "UnitTests/UnitTest_TreeControl/CMakeFiles/UnitTest_TreeControl.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../lib/libCommon.a"
+  "../lib/libCommon.pdb"
+  "CMakeFiles/Common.dir/Base/Dummy/BaseManager.cpp.o"
+  "CMakeFiles/Common.dir/Base/Dummy/BaseManager.cpp.o.d"
+  "CMakeFiles/Common.dir/Input/OIS/InputManager.cpp.o"
+  "CMakeFiles/Common.dir/Input/OIS/InputManager.cpp.o.d"
+  "CMakeFiles/Common.dir/Input/OIS/PointerManager.cpp.o"
+  "CMakeFiles/Common.dir/Input/OIS/PointerManager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,134 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MyGUIEngine/src/MyGUI_ActionController.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ActionController.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ActionController.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Any.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Any.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Any.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_AsyncLogListener.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_AsyncLogListener.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_AsyncLogListener.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_BackwardCompatibility.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_BackwardCompatibility.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_BackwardCompatibility.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_BiIndexBase.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_BiIndexBase.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_BiIndexBase.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Button.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Button.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Button.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_CachedLayer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_CachedLayer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_CachedLayer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Canvas.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Canvas.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Canvas.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ChildSkinInfo.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ChildSkinInfo.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ChildSkinInfo.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ClipboardManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ClipboardManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ClipboardManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Colour.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Colour.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Colour.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ComboBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ComboBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ComboBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ConsoleLogListener.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ConsoleLogListener.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ConsoleLogListener.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Constants.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Constants.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Constants.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ControllerEdgeHide.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerEdgeHide.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerEdgeHide.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ControllerFadeAlpha.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerFadeAlpha.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerFadeAlpha.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ControllerManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ControllerPosition.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerPosition.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerPosition.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ControllerRepeatClick.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerRepeatClick.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerRepeatClick.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DDContainer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DDContainer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DDContainer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DataFileStream.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataFileStream.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataFileStream.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DataManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DataMemoryStream.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataMemoryStream.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataMemoryStream.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DataStream.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataStream.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataStream.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DrawList.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DrawList.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DrawList.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DynLib.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLib.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLib.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_DynLibManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLibManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLibManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_EditBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_EditText.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditText.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditText.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Exception.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Exception.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Exception.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_FactoryManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FactoryManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FactoryManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_FileLogListener.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FileLogListener.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FileLogListener.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_FontManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FontManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FontManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_FrameSnapshot.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FrameSnapshot.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_FrameSnapshot.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_GeometryUtility.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_GeometryUtility.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_GeometryUtility.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Gui.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Gui.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Gui.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ImageBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ImageBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ImageBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_InputManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_InputManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_InputManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ItemBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ItemBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ItemBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LanguageManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LanguageManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LanguageManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LayerItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LayerManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LayerNode.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerNode.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerNode.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LayoutManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayoutManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayoutManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LevelLogFilter.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LevelLogFilter.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LevelLogFilter.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ListBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ListBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ListBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LogManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_LogSource.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogSource.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogSource.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MainSkin.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MainSkin.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MainSkin.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MaskPickInfo.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickInfo.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickInfo.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MaskPickManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MenuBar.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuBar.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuBar.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MenuControl.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuControl.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuControl.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MenuItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MultiListBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_MultiListItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_OverlappedLayer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_OverlappedLayer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_OverlappedLayer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_PluginManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PluginManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PluginManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_PointerManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PointerManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PointerManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_PolygonalSkin.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PolygonalSkin.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PolygonalSkin.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_PopupMenu.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PopupMenu.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_PopupMenu.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Precompiled.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Precompiled.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Precompiled.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ProgressBar.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ProgressBar.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ProgressBar.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_RenderItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_RenderManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceImageSet.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSet.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSet.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceImageSetPointer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSetPointer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSetPointer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceLayout.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceLayout.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceLayout.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceManualFont.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualFont.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualFont.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceManualPointer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualPointer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualPointer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceSkin.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceSkin.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceSkin.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ResourceTrueTypeFont.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceTrueTypeFont.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceTrueTypeFont.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_RichText.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RichText.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RichText.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_RotatingSkin.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RotatingSkin.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_RotatingSkin.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ScrollBar.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollBar.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollBar.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ScrollView.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollView.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollView.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ScrollViewBase.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollViewBase.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollViewBase.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SharedLayer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SharedLayerNode.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayerNode.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayerNode.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SimpleText.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SimpleText.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SimpleText.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SkinItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SkinManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_StringId.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_StringId.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_StringId.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SubSkin.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubSkin.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubSkin.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SubWidgetBinding.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetBinding.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetBinding.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_SubWidgetManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TabControl.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabControl.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabControl.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TabItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextBox.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextBox.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextBox.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextIterator.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextIterator.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextIterator.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextView.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextView.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextView.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextViewCache.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextViewCache.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextViewCache.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextureMemoryManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureMemoryManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureMemoryManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TextureUtility.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureUtility.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureUtility.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TileRect.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TileRect.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TileRect.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Timer.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Timer.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Timer.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_ToolTipManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ToolTipManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_ToolTipManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TreeControl.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControl.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControl.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TreeControlItem.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControlItem.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControlItem.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_TweenManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TweenManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_TweenManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_UString.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_UString.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_UString.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_VertexUtility.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_VertexUtility.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_VertexUtility.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Widget.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Widget.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Widget.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_WidgetInput.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetInput.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetInput.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_WidgetManager.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetManager.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetManager.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_WidgetUserData.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetUserData.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetUserData.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_Window.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Window.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_Window.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_WindowsClipboardHandler.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WindowsClipboardHandler.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_WindowsClipboardHandler.cpp.o.d"
+  "/root/repo/MyGUIEngine/src/MyGUI_XmlDocument.cpp" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_XmlDocument.cpp.o" "gcc" "MyGUIEngine/CMakeFiles/MyGUIEngine.dir/src/MyGUI_XmlDocument.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ut_build/lib/libMyGUIEngine.so" "/root/repo/_ut_build/lib/libMyGUIEngine.so.3.2.2"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,230 @@
+file(REMOVE_RECURSE
+  "../lib/libMyGUIEngine.pdb"
+  "../lib/libMyGUIEngine.so"
+  "../lib/libMyGUIEngine.so.3.2.2"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ActionController.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ActionController.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Any.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Any.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_AsyncLogListener.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_AsyncLogListener.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_BackwardCompatibility.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_BackwardCompatibility.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_BiIndexBase.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_BiIndexBase.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Button.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Button.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_CachedLayer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_CachedLayer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Canvas.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Canvas.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ChildSkinInfo.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ChildSkinInfo.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ClipboardManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ClipboardManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Colour.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Colour.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ComboBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ComboBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ConsoleLogListener.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ConsoleLogListener.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Constants.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Constants.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerEdgeHide.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerEdgeHide.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerFadeAlpha.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerFadeAlpha.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerPosition.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerPosition.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerRepeatClick.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ControllerRepeatClick.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DDContainer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DDContainer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataFileStream.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataFileStream.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataMemoryStream.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataMemoryStream.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataStream.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DataStream.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DrawList.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DrawList.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLib.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLib.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLibManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_DynLibManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditText.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_EditText.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Exception.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Exception.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FactoryManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FactoryManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FileLogListener.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FileLogListener.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FontManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FontManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FrameSnapshot.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_FrameSnapshot.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_GeometryUtility.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_GeometryUtility.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Gui.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Gui.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ImageBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ImageBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_InputManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_InputManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ItemBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ItemBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LanguageManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LanguageManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerNode.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayerNode.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayoutManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LayoutManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LevelLogFilter.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LevelLogFilter.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ListBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ListBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogSource.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_LogSource.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MainSkin.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MainSkin.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickInfo.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickInfo.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MaskPickManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuBar.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuBar.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuControl.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuControl.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MenuItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_MultiListItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_OverlappedLayer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_OverlappedLayer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PluginManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PluginManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PointerManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PointerManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PolygonalSkin.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PolygonalSkin.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PopupMenu.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_PopupMenu.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Precompiled.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Precompiled.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ProgressBar.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ProgressBar.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RenderManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSet.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSet.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSetPointer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceImageSetPointer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceLayout.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceLayout.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualFont.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualFont.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualPointer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceManualPointer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceSkin.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceSkin.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceTrueTypeFont.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ResourceTrueTypeFont.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RichText.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RichText.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RotatingSkin.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_RotatingSkin.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollBar.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollBar.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollView.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollView.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollViewBase.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ScrollViewBase.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayerNode.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SharedLayerNode.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SimpleText.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SimpleText.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SkinManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_StringId.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_StringId.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubSkin.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubSkin.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetBinding.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetBinding.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_SubWidgetManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabControl.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabControl.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TabItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextBox.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextBox.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextIterator.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextIterator.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextView.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextView.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextViewCache.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextViewCache.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureMemoryManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureMemoryManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureUtility.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TextureUtility.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TileRect.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TileRect.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Timer.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Timer.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ToolTipManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_ToolTipManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControl.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControl.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControlItem.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TreeControlItem.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TweenManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_TweenManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_UString.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_UString.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_VertexUtility.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_VertexUtility.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Widget.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Widget.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetInput.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetInput.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetManager.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetManager.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetUserData.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WidgetUserData.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Window.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_Window.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WindowsClipboardHandler.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_WindowsClipboardHandler.cpp.o.d"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_XmlDocument.cpp.o"
+  "CMakeFiles/MyGUIEngine.dir/src/MyGUI_XmlDocument.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MyGUIEngine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,381 @@
+# Install script for directory: /root/repo/MyGUIEngine
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee]|[Nn][Oo][Nn][Ee]|)$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so.3.2.2")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee]|[Nn][Oo][Nn][Ee]|)$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ww][Ii][Tt][Hh][Dd][Ee][Bb][Ii][Nn][Ff][Oo])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so.3.2.2")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ww][Ii][Tt][Hh][Dd][Ee][Bb][Ii][Nn][Ff][Oo])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Mm][Ii][Nn][Ss][Ii][Zz][Ee][Rr][Ee][Ll])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so.3.2.2")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Mm][Ii][Nn][Ss][Ii][Zz][Ee][Rr][Ee][Ll])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Dd][Ee][Bb][Uu][Gg])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so.3.2.2")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so.3.2.2")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Dd][Ee][Bb][Uu][Gg])$")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      file(RPATH_CHECK
+           FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so"
+           RPATH "")
+    endif()
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_ut_build/lib/libMyGUIEngine.so")
+    if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so" AND
+       NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMyGUIEngine.so")
+      endif()
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/MYGUI" TYPE FILE FILES
+    "/root/repo/MyGUIEngine/include/MyGUI.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ActionController.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Align.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Allocator.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Any.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_AsyncLogListener.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_BackwardCompatibility.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_BiIndexBase.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Bitwise.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Button.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_CachedLayer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Canvas.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ChildSkinInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ClipboardManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WindowsClipboardHandler.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Colour.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ComboBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Common.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_CommonStateInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ConsoleLogListener.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Constants.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerEdgeHide.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerFadeAlpha.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerPosition.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ControllerRepeatClick.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_CoordConverter.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_CustomAllocator.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DDContainer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DDItemInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DataFileStream.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DataManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DataMemoryStream.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DataStream.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DataStreamHolder.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Delegate.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DelegateImplement.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DeprecatedTypes.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DeprecatedWidgets.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Diagnostic.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DrawList.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DynLib.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_DynLibManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_EditBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_EditText.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Enumerator.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_EventPair.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Exception.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FactoryManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FileLogListener.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FlowDirection.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FontData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FontManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_FrameSnapshot.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_GenericFactory.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_GeometryUtility.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Gui.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IBItemInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ICroppedRectangle.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IDataStream.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IFont.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IItemContainer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ILayer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ILayerItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ILayerNode.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ILogFilter.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ILogListener.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IObject.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IPointer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IRenderTarget.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IResource.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ISerializable.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IStateInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ISubWidget.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ISubWidgetRect.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ISubWidgetText.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ITexture.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IUnlinkWidget.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_IVertexBuffer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ImageBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ImageInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_InputManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ItemBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_KeyCode.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LanguageManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LayerItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LayerManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LayerNode.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LayoutData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LayoutManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LevelLogFilter.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ListBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LogLevel.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LogManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LogSource.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_LogStream.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Macros.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MainSkin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MaskPickInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MaskPickManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MenuBar.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MenuControl.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MenuItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MenuItemType.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MouseButton.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MultiListBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_MultiListItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_OverlappedLayer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Platform.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Plugin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_PluginManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_PointerManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_PolygonalSkin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_PopupMenu.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Precompiled.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Prerequest.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ProgressBar.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RTTI.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RenderFormat.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RenderItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RenderManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RenderTargetInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResizingPolicy.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResolvedWidgetType.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceImageSet.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceImageSetData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceImageSetPointer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceLayout.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceManualFont.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceManualPointer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceSkin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ResourceTrueTypeFont.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RichText.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_RotatingSkin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ScrollBar.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ScrollView.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ScrollViewBase.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SharedLayer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SharedLayerNode.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SimpleText.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Singleton.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SkinItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SkinManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_StringId.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_StringUtility.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SubSkin.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SubWidgetBinding.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SubWidgetInfo.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_SubWidgetManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TCoord.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TPoint.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TRect.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TSize.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TabControl.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TabItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextBox.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextChangeHistory.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextIterator.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextView.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextViewCache.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextViewData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextureMemoryManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TextureUtility.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TileRect.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Timer.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_ToolTipManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TreeControl.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TreeControlItem.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_TweenManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Types.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_UString.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_UTF8Iterator.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Version.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_VertexData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_VertexUtility.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Widget.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetDefines.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetInput.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetManager.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetStyle.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetToolTip.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetTranslate.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_WidgetUserData.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_Window.h"
+    "/root/repo/MyGUIEngine/include/MyGUI_XmlDocument.h"
+    )
+endif()
+
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Platforms/Dummy/DummyPlatform/src/MyGUI_DummyDataManager.cpp" "Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyDataManager.cpp.o" "gcc" "Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyDataManager.cpp.o.d"
+  "/root/repo/Platforms/Dummy/DummyPlatform/src/MyGUI_DummyRenderManager.cpp" "Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyRenderManager.cpp.o" "gcc" "Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyRenderManager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/MyGUIEngine/CMakeFiles/MyGUIEngine.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
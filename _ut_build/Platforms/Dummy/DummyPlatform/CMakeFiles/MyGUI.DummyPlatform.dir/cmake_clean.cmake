@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libMyGUI.DummyPlatform.a"
+  "../../../lib/libMyGUI.DummyPlatform.pdb"
+  "CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyDataManager.cpp.o"
+  "CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyDataManager.cpp.o.d"
+  "CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyRenderManager.cpp.o"
+  "CMakeFiles/MyGUI.DummyPlatform.dir/src/MyGUI_DummyRenderManager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MyGUI.DummyPlatform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
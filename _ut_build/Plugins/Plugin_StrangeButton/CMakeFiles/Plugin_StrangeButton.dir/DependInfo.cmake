@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Plugins/Plugin_StrangeButton/Plugin.cpp" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/Plugin.cpp.o" "gcc" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/Plugin.cpp.o.d"
+  "/root/repo/Plugins/Plugin_StrangeButton/Plugin_Export.cpp" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/Plugin_Export.cpp.o" "gcc" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/Plugin_Export.cpp.o.d"
+  "/root/repo/Plugins/Plugin_StrangeButton/StrangeButton.cpp" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/StrangeButton.cpp.o" "gcc" "Plugins/Plugin_StrangeButton/CMakeFiles/Plugin_StrangeButton.dir/StrangeButton.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/MyGUIEngine/CMakeFiles/MyGUIEngine.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
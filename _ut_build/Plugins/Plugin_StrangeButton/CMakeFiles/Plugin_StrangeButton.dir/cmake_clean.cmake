@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/Plugin_StrangeButton.pdb"
+  "../../bin/Plugin_StrangeButton.so"
+  "CMakeFiles/Plugin_StrangeButton.dir/Plugin.cpp.o"
+  "CMakeFiles/Plugin_StrangeButton.dir/Plugin.cpp.o.d"
+  "CMakeFiles/Plugin_StrangeButton.dir/Plugin_Export.cpp.o"
+  "CMakeFiles/Plugin_StrangeButton.dir/Plugin_Export.cpp.o.d"
+  "CMakeFiles/Plugin_StrangeButton.dir/StrangeButton.cpp.o"
+  "CMakeFiles/Plugin_StrangeButton.dir/StrangeButton.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Plugin_StrangeButton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
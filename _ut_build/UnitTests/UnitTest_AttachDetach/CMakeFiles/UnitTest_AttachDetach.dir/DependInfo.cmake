@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UnitTests/UnitTest_AttachDetach/DemoKeeper.cpp" "UnitTests/UnitTest_AttachDetach/CMakeFiles/UnitTest_AttachDetach.dir/DemoKeeper.cpp.o" "gcc" "UnitTests/UnitTest_AttachDetach/CMakeFiles/UnitTest_AttachDetach.dir/DemoKeeper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/Common/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/MyGUIEngine/CMakeFiles/MyGUIEngine.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
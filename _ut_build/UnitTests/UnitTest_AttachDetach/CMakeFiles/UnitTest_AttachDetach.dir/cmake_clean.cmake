@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_AttachDetach"
+  "../../bin/UnitTest_AttachDetach.pdb"
+  "CMakeFiles/UnitTest_AttachDetach.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_AttachDetach.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_AttachDetach.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
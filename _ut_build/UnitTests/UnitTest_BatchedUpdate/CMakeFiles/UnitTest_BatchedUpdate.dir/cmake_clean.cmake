@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_BatchedUpdate"
+  "../../bin/UnitTest_BatchedUpdate.pdb"
+  "CMakeFiles/UnitTest_BatchedUpdate.dir/BatchedUpdateTest.cpp.o"
+  "CMakeFiles/UnitTest_BatchedUpdate.dir/BatchedUpdateTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_BatchedUpdate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
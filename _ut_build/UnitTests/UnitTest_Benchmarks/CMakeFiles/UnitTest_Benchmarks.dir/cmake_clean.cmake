@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_Benchmarks"
+  "../../bin/UnitTest_Benchmarks.pdb"
+  "CMakeFiles/UnitTest_Benchmarks.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_Benchmarks.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_Benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_ChildAttach"
+  "../../bin/UnitTest_ChildAttach.pdb"
+  "CMakeFiles/UnitTest_ChildAttach.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_ChildAttach.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_ChildAttach.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_Delegates"
+  "../../bin/UnitTest_Delegates.pdb"
+  "CMakeFiles/UnitTest_Delegates.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_Delegates.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_Delegates.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_FrameSnapshot"
+  "../../bin/UnitTest_FrameSnapshot.pdb"
+  "CMakeFiles/UnitTest_FrameSnapshot.dir/FrameSnapshotTest.cpp.o"
+  "CMakeFiles/UnitTest_FrameSnapshot.dir/FrameSnapshotTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_FrameSnapshot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_HyperTextBox"
+  "../../bin/UnitTest_HyperTextBox.pdb"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/DemoKeeper.cpp.o.d"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/HyperTextBox.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/HyperTextBox.cpp.o.d"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/Panel.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/Panel.cpp.o.d"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/ScrollViewPanel.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/ScrollViewPanel.cpp.o.d"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/StackPanel.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/StackPanel.cpp.o.d"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/WrapPanel.cpp.o"
+  "CMakeFiles/UnitTest_HyperTextBox.dir/WrapPanel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_HyperTextBox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_IncrementalLayout"
+  "../../bin/UnitTest_IncrementalLayout.pdb"
+  "CMakeFiles/UnitTest_IncrementalLayout.dir/IncrementalLayoutTest.cpp.o"
+  "CMakeFiles/UnitTest_IncrementalLayout.dir/IncrementalLayoutTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_IncrementalLayout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_ItemBox_Info"
+  "../../bin/UnitTest_ItemBox_Info.pdb"
+  "CMakeFiles/UnitTest_ItemBox_Info.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_ItemBox_Info.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_ItemBox_Info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_Layers"
+  "../../bin/UnitTest_Layers.pdb"
+  "CMakeFiles/UnitTest_Layers.dir/CommandManager.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/CommandManager.cpp.o.d"
+  "CMakeFiles/UnitTest_Layers.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/DemoKeeper.cpp.o.d"
+  "CMakeFiles/UnitTest_Layers.dir/KeyboardPanel.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/KeyboardPanel.cpp.o.d"
+  "CMakeFiles/UnitTest_Layers.dir/MonitorPanel.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/MonitorPanel.cpp.o.d"
+  "CMakeFiles/UnitTest_Layers.dir/MyGUI_RTTLayer.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/MyGUI_RTTLayer.cpp.o.d"
+  "CMakeFiles/UnitTest_Layers.dir/SceneObject.cpp.o"
+  "CMakeFiles/UnitTest_Layers.dir/SceneObject.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_Layers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_MultiList"
+  "../../bin/UnitTest_MultiList.pdb"
+  "CMakeFiles/UnitTest_MultiList.dir/BiIndexData.cpp.o"
+  "CMakeFiles/UnitTest_MultiList.dir/BiIndexData.cpp.o.d"
+  "CMakeFiles/UnitTest_MultiList.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_MultiList.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_MultiList.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_RTTLayer"
+  "../../bin/UnitTest_RTTLayer.pdb"
+  "CMakeFiles/UnitTest_RTTLayer.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_RTTLayer.dir/DemoKeeper.cpp.o.d"
+  "CMakeFiles/UnitTest_RTTLayer.dir/MyGUI_RTTLayer.cpp.o"
+  "CMakeFiles/UnitTest_RTTLayer.dir/MyGUI_RTTLayer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_RTTLayer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_RotatingSkin"
+  "../../bin/UnitTest_RotatingSkin.pdb"
+  "CMakeFiles/UnitTest_RotatingSkin.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_RotatingSkin.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_RotatingSkin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_Spline"
+  "../../bin/UnitTest_Spline.pdb"
+  "CMakeFiles/UnitTest_Spline.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_Spline.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_Spline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/DemoKeeper.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/DemoKeeper.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/DemoKeeper.cpp.o.d"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/FadeNodeAnimator.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/FadeNodeAnimator.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/FadeNodeAnimator.cpp.o.d"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/MyGUI_RTTLayer.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayer.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayer.cpp.o.d"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/MyGUI_RTTLayerNode.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayerNode.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayerNode.cpp.o.d"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/Tesselator.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/Tesselator.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/Tesselator.cpp.o.d"
+  "/root/repo/UnitTests/UnitTest_TextureAnimations/WobbleNodeAnimator.cpp" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/WobbleNodeAnimator.cpp.o" "gcc" "UnitTests/UnitTest_TextureAnimations/CMakeFiles/UnitTest_TextureAnimations.dir/WobbleNodeAnimator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/Common/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Platforms/Dummy/DummyPlatform/CMakeFiles/MyGUI.DummyPlatform.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/MyGUIEngine/CMakeFiles/MyGUIEngine.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
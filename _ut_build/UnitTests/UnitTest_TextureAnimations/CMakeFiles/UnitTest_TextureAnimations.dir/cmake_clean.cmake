@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_TextureAnimations"
+  "../../bin/UnitTest_TextureAnimations.pdb"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/DemoKeeper.cpp.o.d"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/FadeNodeAnimator.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/FadeNodeAnimator.cpp.o.d"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayer.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayer.cpp.o.d"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayerNode.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/MyGUI_RTTLayerNode.cpp.o.d"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/Tesselator.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/Tesselator.cpp.o.d"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/WobbleNodeAnimator.cpp.o"
+  "CMakeFiles/UnitTest_TextureAnimations.dir/WobbleNodeAnimator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_TextureAnimations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
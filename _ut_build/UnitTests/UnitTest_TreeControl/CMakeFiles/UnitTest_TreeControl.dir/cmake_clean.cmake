@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/UnitTest_TreeControl"
+  "../../bin/UnitTest_TreeControl.pdb"
+  "CMakeFiles/UnitTest_TreeControl.dir/DemoKeeper.cpp.o"
+  "CMakeFiles/UnitTest_TreeControl.dir/DemoKeeper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest_TreeControl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
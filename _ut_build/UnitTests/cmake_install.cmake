@@ -0,0 +1,65 @@
+# Install script for directory: /root/repo/UnitTests
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_ut_build/UnitTests/UnitTest_AttachDetach/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_BatchedUpdate/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_Benchmarks/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_ChildAttach/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_Delegates/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_FrameSnapshot/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_HyperTextBox/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_IncrementalLayout/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_ItemBox_Info/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_Layers/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_MultiList/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_RotatingSkin/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_RTTLayer/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_Spline/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_TextureAnimations/cmake_install.cmake")
+  include("/root/repo/_ut_build/UnitTests/UnitTest_TreeControl/cmake_install.cmake")
+
+endif()
+